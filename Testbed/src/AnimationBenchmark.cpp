@@ -0,0 +1,108 @@
+#include "AnimationBenchmark.h"
+
+#include <chrono>
+
+using namespace Vortex;
+
+AnimationBenchmark::AnimationBenchmark()
+	: Layer("AnimationBenchmark")
+{
+}
+
+void AnimationBenchmark::OnGuiRender()
+{
+	Gui::Begin("Animation Benchmark");
+
+	UI::BeginPropertyGrid();
+	UI::Property("Bones", m_BoneCount, 1.0f, 1, 1024);
+	UI::Property("Characters", m_CharacterCount, 1.0f, 1, 4096);
+	UI::Property("Frames", m_FrameCount, 1.0f, 1, 10000);
+	UI::Property("Keyframes", m_KeyframeCount, 1.0f, 2, 1000);
+	UI::EndPropertyGrid();
+
+	if (Gui::Button("Run"))
+	{
+		Run();
+	}
+
+	if (m_HasResults)
+	{
+		Gui::Text("Total: %.3f ms", m_TotalMilliseconds);
+		Gui::Text("Per character update: %.3f us", m_MicrosecondsPerCharacter);
+	}
+
+	Gui::End();
+}
+
+void AnimationBenchmark::Run()
+{
+	SharedRef<Animation> animation = CreateSyntheticAnimation(m_BoneCount, m_KeyframeCount);
+
+	std::vector<SharedRef<Animator>> animators;
+	animators.reserve(m_CharacterCount);
+
+	for (uint32_t i = 0; i < m_CharacterCount; i++)
+	{
+		SharedRef<Animator> animator = Animator::Create(animation);
+		animator->PlayAnimation();
+
+		// Spread the characters out over the clip so they don't all sample the same keys
+		animator->UpdateAnimation((float)i / (float)m_CharacterCount);
+		animators.push_back(animator);
+	}
+
+	const float delta = 1.0f / 60.0f;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t frame = 0; frame < m_FrameCount; frame++)
+	{
+		for (const SharedRef<Animator>& animator : animators)
+		{
+			animator->UpdateAnimation(delta);
+		}
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	m_TotalMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+	m_MicrosecondsPerCharacter = (m_TotalMilliseconds * 1000.0) / ((double)m_FrameCount * (double)m_CharacterCount);
+	m_HasResults = true;
+
+	VX_INFO("Animation Benchmark: {} bones, {} characters, {} frames, {:.3f} ms total, {:.3f} us per character",
+		m_BoneCount, m_CharacterCount, m_FrameCount, m_TotalMilliseconds, m_MicrosecondsPerCharacter);
+}
+
+SharedRef<Animation> AnimationBenchmark::CreateSyntheticAnimation(uint32_t boneCount, uint32_t keyframeCount)
+{
+	Skeleton skeleton;
+
+	// Branch every few bones so the hierarchy is roughly as deep as a humanoid rig
+	for (uint32_t i = 0; i < boneCount; i++)
+	{
+		const int32_t parent = i == 0 ? Skeleton::InvalidIndex : (int32_t)((i - 1) / 3);
+		const int32_t node = skeleton.AddNode("Bone" + std::to_string(i), parent, Math::Translate(Math::vec3(0.0f, 0.1f, 0.0f)));
+		skeleton.SetNodeChannel(node, (int32_t)i);
+		skeleton.SetNodeBone(node, (int32_t)i, Math::Identity());
+	}
+
+	const float duration = (float)keyframeCount;
+	SharedRef<Animation> animation = CreateShared<Animation>(skeleton, duration, 30.0f);
+
+	for (uint32_t i = 0; i < boneCount; i++)
+	{
+		animation->AddChannel();
+
+		for (uint32_t key = 0; key < keyframeCount; key++)
+		{
+			const float time = (float)key;
+			const float angle = Math::Sin(time * 0.25f + (float)i);
+
+			animation->AddPositionKey(time, Math::vec3(0.0f, 0.1f + angle * 0.01f, 0.0f));
+			animation->AddRotationKey(time, Math::AngleAxis(angle, Math::vec3(0.0f, 0.0f, 1.0f)));
+			animation->AddScaleKey(time, Math::vec3(1.0f));
+		}
+	}
+
+	return animation;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Vortex.h>
+
+// Measures the cost of evaluating skinned poses on the CPU with a synthetic rig
+class AnimationBenchmark : public Vortex::Layer
+{
+public:
+	AnimationBenchmark();
+	~AnimationBenchmark() override = default;
+
+	void OnGuiRender() override;
+
+private:
+	void Run();
+
+	static Vortex::SharedRef<Vortex::Animation> CreateSyntheticAnimation(uint32_t boneCount, uint32_t keyframeCount);
+
+private:
+	uint32_t m_BoneCount = 100;
+	uint32_t m_CharacterCount = 256;
+	uint32_t m_FrameCount = 120;
+	uint32_t m_KeyframeCount = 30;
+
+	double m_TotalMilliseconds = 0.0;
+	double m_MicrosecondsPerCharacter = 0.0;
+	bool m_HasResults = false;
+};
@@ -0,0 +1,362 @@
+#include "PhysicsBenchmark.h"
+
+#include <chrono>
+#include <fstream>
+
+using namespace Vortex;
+
+static const char* s_DefaultProjectFilepath = "Vortex-Editor/SandboxProject/Sandbox.vxproject";
+
+PhysicsBenchmark::PhysicsBenchmark(const std::string& projectFilepath, const std::string& outputFilepath, uint32_t tickCount)
+	: Layer("PhysicsBenchmark"), m_ProjectFilepath(projectFilepath), m_OutputFilepath(outputFilepath), m_TickCount(tickCount)
+{
+}
+
+void PhysicsBenchmark::OnAttach()
+{
+	if (m_OutputFilepath.empty())
+		return;
+
+	RunAll();
+
+	if (!WriteResults(m_OutputFilepath))
+	{
+		VX_ERROR("Physics Benchmark: failed to write results to '{}'", m_OutputFilepath);
+	}
+
+	Application::Get().Close();
+}
+
+void PhysicsBenchmark::OnGuiRender()
+{
+	Gui::Begin("Physics Benchmark");
+
+	UI::BeginPropertyGrid();
+	UI::Property("Ticks", m_TickCount, 1.0f, 1, 100000);
+	UI::Property("Stacked Boxes", m_BoxCount, 1.0f, 1, 100000);
+	UI::Property("Ragdolls", m_RagdollCount, 1.0f, 1, 10000);
+	UI::Property("Character Controllers", m_ControllerCount, 1.0f, 1, 10000);
+	UI::Property("2D Pyramid Base", m_PyramidBaseWidth, 1.0f, 1, 500);
+	UI::EndPropertyGrid();
+
+	if (Gui::Button("Run"))
+	{
+		RunAll();
+	}
+
+	for (const ScenarioResult& result : m_Results)
+	{
+		Gui::Separator();
+		Gui::Text("%s: %u bodies, %.3f ms per tick", result.Name.c_str(), result.BodyCount, result.Total / (double)result.TickCount);
+		Gui::Text("Push %.3f ms, Simulate %.3f ms, Fetch %.3f ms, Contacts %.3f ms, Writeback %.3f ms",
+			result.Push, result.Simulate, result.Fetch, result.ContactCallbacks, result.Writeback);
+		Gui::Text("Transform hash: %016llx", (unsigned long long)result.TransformHash);
+	}
+
+	Gui::End();
+}
+
+void PhysicsBenchmark::RunAll()
+{
+	m_Results.clear();
+
+	// Physics reads its scene settings from the active project
+	if (!Project::GetActive())
+	{
+		const std::string projectFilepath = m_ProjectFilepath.empty() ? s_DefaultProjectFilepath : m_ProjectFilepath;
+
+		if (!Project::Load(projectFilepath))
+		{
+			VX_ERROR("Physics Benchmark: failed to load project '{}'", projectFilepath);
+			return;
+		}
+	}
+
+	const Scenario scenarios[] =
+	{
+		{ ScenarioType::BoxStack, m_BoxCount },
+		{ ScenarioType::RagdollPile, m_RagdollCount },
+		{ ScenarioType::CharacterControllers, m_ControllerCount },
+		{ ScenarioType::Pyramid2D, m_PyramidBaseWidth },
+	};
+
+	for (const Scenario& scenario : scenarios)
+	{
+		const ScenarioResult& result = m_Results.emplace_back(RunScenario(scenario));
+
+		VX_INFO("Physics Benchmark: {}, {} bodies, {} ticks, {:.3f} ms total, hash {:016x}",
+			result.Name, result.BodyCount, result.TickCount, result.Total, result.TransformHash);
+	}
+}
+
+PhysicsBenchmark::ScenarioResult PhysicsBenchmark::RunScenario(const Scenario& scenario)
+{
+	ScenarioResult result;
+	result.Name = ScenarioTypeToString(scenario.Type);
+	result.TickCount = m_TickCount;
+
+	SharedReference<Scene> scene = Scene::Create();
+	result.BodyCount = BuildScene(scenario, scene);
+
+	// One fixed step per tick so every run steps the world exactly the same way
+	const bool is2D = scenario.Type == ScenarioType::Pyramid2D;
+	const float delta = is2D ? 1.0f / (float)Physics2D::GetPhysicsWorldTickRate() : 1.0f / (float)PhysicsScene::GetTickRate();
+
+	std::vector<UUID> controllers;
+
+	auto controllerView = scene->GetAllActorsWith<IDComponent, CharacterControllerComponent>();
+	for (const auto e : controllerView)
+	{
+		controllers.push_back(controllerView.get<IDComponent>(e).ID);
+	}
+
+	std::sort(controllers.begin(), controllers.end());
+
+	scene->OnPhysicsSimulationStart();
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (uint32_t tick = 0; tick < m_TickCount; tick++)
+	{
+		// Walk every controller around its own circle
+		for (uint32_t i = 0; i < (uint32_t)controllers.size(); i++)
+		{
+			const float angle = (float)tick * 0.05f + (float)i;
+			const Math::vec3 displacement = Math::vec3(Math::Cos(angle), 0.0f, Math::Sin(angle)) * 2.0f * delta;
+			Physics::RT_DisplaceCharacterController(delta, controllers[i], displacement);
+		}
+
+		scene->OnPhysicsSimulationUpdate(delta);
+		scene->OnPhysicsSimulationFetchResults();
+
+		const PhysicsStepTimings& timings = Physics::GetStepTimings();
+		const Physics2DStepTimings& timings2D = Physics2D::GetStepTimings();
+
+		result.Push += timings.Push + timings2D.Push;
+		result.Simulate += timings.Simulate + timings2D.Simulate;
+		result.Fetch += timings.Fetch;
+		result.ContactCallbacks += timings.ContactCallbacks;
+		result.Writeback += timings.Writeback + timings2D.Writeback;
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+	result.Total = std::chrono::duration<double, std::milli>(end - start).count();
+
+	result.TransformHash = HashTransforms(scene);
+
+	scene->OnPhysicsSimulationStop();
+
+	return result;
+}
+
+bool PhysicsBenchmark::WriteResults(const std::string& filepath) const
+{
+	std::ofstream stream(filepath, std::ios::trunc);
+	if (!stream)
+		return false;
+
+	stream << "{\n";
+	stream << fmt::format("\t\"ticks\": {},\n", m_TickCount);
+	stream << "\t\"scenarios\": [\n";
+
+	for (size_t i = 0; i < m_Results.size(); i++)
+	{
+		const ScenarioResult& result = m_Results[i];
+
+		stream << "\t\t{\n";
+		stream << fmt::format("\t\t\t\"name\": \"{}\",\n", result.Name);
+		stream << fmt::format("\t\t\t\"bodies\": {},\n", result.BodyCount);
+		stream << fmt::format("\t\t\t\"totalMs\": {:.4f},\n", result.Total);
+		stream << fmt::format("\t\t\t\"tickMs\": {:.4f},\n", result.Total / (double)result.TickCount);
+		stream << "\t\t\t\"phasesMs\": {\n";
+		stream << fmt::format("\t\t\t\t\"push\": {:.4f},\n", result.Push);
+		stream << fmt::format("\t\t\t\t\"simulate\": {:.4f},\n", result.Simulate);
+		stream << fmt::format("\t\t\t\t\"fetch\": {:.4f},\n", result.Fetch);
+		stream << fmt::format("\t\t\t\t\"contactCallbacks\": {:.4f},\n", result.ContactCallbacks);
+		stream << fmt::format("\t\t\t\t\"writeback\": {:.4f}\n", result.Writeback);
+		stream << "\t\t\t},\n";
+		stream << fmt::format("\t\t\t\"transformHash\": \"{:016x}\"\n", result.TransformHash);
+		stream << (i + 1 < m_Results.size() ? "\t\t},\n" : "\t\t}\n");
+	}
+
+	stream << "\t]\n";
+	stream << "}\n";
+
+	return true;
+}
+
+uint32_t PhysicsBenchmark::BuildScene(const Scenario& scenario, SharedReference<Scene>& scene)
+{
+	// Fixed ids so the same scenario hashes the same way on every run
+	uint64_t nextUUID = 1;
+	uint32_t bodyCount = 0;
+
+	auto createActor = [&](const char* name, const Math::vec3& translation)
+	{
+		Actor actor = scene->CreateActorWithUUID(nextUUID++, name);
+		actor.GetTransform().Translation = translation;
+		return actor;
+	};
+
+	auto createBody = [&](const char* name, const Math::vec3& translation)
+	{
+		Actor actor = createActor(name, translation);
+		RigidBodyComponent& rigidbody = actor.AddComponent<RigidBodyComponent>();
+		rigidbody.Type = RigidBodyType::Dynamic;
+		bodyCount++;
+		return actor;
+	};
+
+	if (scenario.Type == ScenarioType::Pyramid2D)
+	{
+		Actor ground = createActor("Ground", Math::vec3(0.0f, -0.5f, 0.0f));
+		ground.AddComponent<RigidBody2DComponent>();
+		ground.AddComponent<BoxCollider2DComponent>().Size = Math::vec2((float)scenario.Count + 10.0f, 0.5f);
+
+		for (uint32_t row = 0; row < scenario.Count; row++)
+		{
+			const uint32_t rowWidth = scenario.Count - row;
+
+			for (uint32_t i = 0; i < rowWidth; i++)
+			{
+				const float x = (float)i - (float)(rowWidth - 1) * 0.5f;
+				Actor box = createActor("Box", Math::vec3(x, 0.5f + (float)row, 0.0f));
+				box.AddComponent<RigidBody2DComponent>().Type = RigidBody2DType::Dynamic;
+				box.AddComponent<BoxCollider2DComponent>();
+				bodyCount++;
+			}
+		}
+
+		return bodyCount;
+	}
+
+	Actor ground = createActor("Ground", Math::vec3(0.0f, -0.5f, 0.0f));
+	ground.AddComponent<RigidBodyComponent>();
+	ground.AddComponent<BoxColliderComponent>().HalfSize = Math::vec3(200.0f, 0.5f, 200.0f);
+
+	switch (scenario.Type)
+	{
+		case ScenarioType::BoxStack:
+		{
+			const uint32_t towerHeight = 10;
+			const uint32_t towerCount = (scenario.Count + towerHeight - 1) / towerHeight;
+			const uint32_t gridWidth = (uint32_t)std::ceil(Math::Sqrt((float)towerCount));
+
+			for (uint32_t i = 0; i < scenario.Count; i++)
+			{
+				const uint32_t tower = i / towerHeight;
+				const float x = (float)(tower % gridWidth) * 2.0f - (float)gridWidth;
+				const float z = (float)(tower / gridWidth) * 2.0f - (float)gridWidth;
+
+				Actor box = createBody("Box", Math::vec3(x, 0.5f + (float)(i % towerHeight), z));
+				box.AddComponent<BoxColliderComponent>();
+			}
+
+			break;
+		}
+		case ScenarioType::RagdollPile:
+		{
+			// Six parts held to the torso by unbreakable fixed joints, dropped on top of each other
+			for (uint32_t i = 0; i < scenario.Count; i++)
+			{
+				const Math::vec3 origin = Math::vec3((float)(i % 3) - 1.0f, 2.0f + (float)i * 1.5f, (float)((i / 3) % 3) - 1.0f);
+
+				Actor torso = createBody("Torso", origin);
+				torso.AddComponent<BoxColliderComponent>().HalfSize = Math::vec3(0.3f, 0.4f, 0.15f);
+
+				Actor head = createBody("Head", origin + Math::vec3(0.0f, 0.65f, 0.0f));
+				head.AddComponent<SphereColliderComponent>().Radius = 0.2f;
+
+				const Math::vec3 limbOffsets[] =
+				{
+					Math::vec3(-0.45f, 0.0f, 0.0f), Math::vec3(0.45f, 0.0f, 0.0f),
+					Math::vec3(-0.15f, -0.85f, 0.0f), Math::vec3(0.15f, -0.85f, 0.0f),
+				};
+
+				std::vector<Actor> parts = { head };
+
+				for (const Math::vec3& offset : limbOffsets)
+				{
+					Actor limb = createBody("Limb", origin + offset);
+					CapsuleColliderComponent& capsuleCollider = limb.AddComponent<CapsuleColliderComponent>();
+					capsuleCollider.Radius = 0.1f;
+					capsuleCollider.Height = 0.5f;
+					parts.push_back(limb);
+				}
+
+				for (Actor part : parts)
+				{
+					FixedJointComponent& fixedJoint = part.AddComponent<FixedJointComponent>();
+					fixedJoint.ConnectedActor = torso.GetUUID();
+					fixedJoint.IsBreakable = false;
+				}
+			}
+
+			break;
+		}
+		case ScenarioType::CharacterControllers:
+		{
+			const uint32_t gridWidth = (uint32_t)std::ceil(Math::Sqrt((float)scenario.Count));
+
+			for (uint32_t i = 0; i < scenario.Count; i++)
+			{
+				const float x = (float)(i % gridWidth) * 3.0f - (float)gridWidth * 1.5f;
+				const float z = (float)(i / gridWidth) * 3.0f - (float)gridWidth * 1.5f;
+
+				Actor controller = createBody("Controller", Math::vec3(x, 1.0f, z));
+				controller.AddComponent<CapsuleColliderComponent>();
+				controller.AddComponent<CharacterControllerComponent>();
+			}
+
+			break;
+		}
+	}
+
+	return bodyCount;
+}
+
+uint64_t PhysicsBenchmark::HashTransforms(SharedReference<Scene>& scene)
+{
+	struct TransformEntry
+	{
+		uint64_t ID;
+		Math::vec3 Translation;
+		Math::quaternion Rotation;
+	};
+
+	std::vector<TransformEntry> entries;
+
+	auto view = scene->GetAllActorsWith<IDComponent, TransformComponent>();
+	for (const auto e : view)
+	{
+		const TransformComponent& transform = view.get<TransformComponent>(e);
+		entries.push_back({ (uint64_t)view.get<IDComponent>(e).ID, transform.Translation, transform.GetRotation() });
+	}
+
+	std::sort(entries.begin(), entries.end(), [](const TransformEntry& lhs, const TransformEntry& rhs) { return lhs.ID < rhs.ID; });
+
+	// Hashes the exact bits, any difference at all changes the hash
+	Fnv1a hasher;
+
+	for (const TransformEntry& entry : entries)
+	{
+		hasher.Add(entry.ID);
+		hasher.Add(entry.Translation);
+		hasher.Add(entry.Rotation);
+	}
+
+	return hasher.GetHash();
+}
+
+const char* PhysicsBenchmark::ScenarioTypeToString(ScenarioType type)
+{
+	switch (type)
+	{
+		case ScenarioType::BoxStack:             return "BoxStack";
+		case ScenarioType::RagdollPile:          return "RagdollPile";
+		case ScenarioType::CharacterControllers: return "CharacterControllers";
+		case ScenarioType::Pyramid2D:            return "Pyramid2D";
+	}
+
+	return "Unknown";
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Vortex.h>
+
+// Steps synthetic physics scenes for a fixed number of ticks and reports where the time went
+// Passing an output path runs every scenario on attach, writes the results as JSON and closes the app
+class PhysicsBenchmark : public Vortex::Layer
+{
+public:
+	enum class ScenarioType
+	{
+		BoxStack, RagdollPile, CharacterControllers, Pyramid2D,
+	};
+
+	struct Scenario
+	{
+		ScenarioType Type = ScenarioType::BoxStack;
+		uint32_t Count = 0;
+	};
+
+	// Totals over every tick, in milliseconds
+	struct ScenarioResult
+	{
+		std::string Name;
+		uint32_t BodyCount = 0;
+		uint32_t TickCount = 0;
+
+		double Total = 0.0;
+		double Push = 0.0;
+		double Simulate = 0.0;
+		double Fetch = 0.0;
+		double ContactCallbacks = 0.0;
+		double Writeback = 0.0;
+
+		// Final transforms, a different hash for the same build means the simulation changed behaviour
+		uint64_t TransformHash = 0;
+	};
+
+public:
+	PhysicsBenchmark(const std::string& projectFilepath = std::string(), const std::string& outputFilepath = std::string(), uint32_t tickCount = 600);
+	~PhysicsBenchmark() override = default;
+
+	void OnAttach() override;
+	void OnGuiRender() override;
+
+private:
+	void RunAll();
+	ScenarioResult RunScenario(const Scenario& scenario);
+
+	bool WriteResults(const std::string& filepath) const;
+
+	static uint32_t BuildScene(const Scenario& scenario, Vortex::SharedReference<Vortex::Scene>& scene);
+	static uint64_t HashTransforms(Vortex::SharedReference<Vortex::Scene>& scene);
+	static const char* ScenarioTypeToString(ScenarioType type);
+
+private:
+	std::string m_ProjectFilepath;
+	std::string m_OutputFilepath;
+
+	uint32_t m_TickCount = 600;
+	uint32_t m_BoxCount = 1000;
+	uint32_t m_RagdollCount = 50;
+	uint32_t m_ControllerCount = 100;
+	uint32_t m_PyramidBaseWidth = 40;
+
+	std::vector<ScenarioResult> m_Results;
+};
@@ -1,7 +1,37 @@
 #include <Vortex.h>
 #include <Vortex/Core/EntryPoint.h>
 
+#include <charconv>
+
 #include "Sandbox.h"
+#include "AnimationBenchmark.h"
+#include "PhysicsBenchmark.h"
+
+// Testbed --physics-benchmark <output.json> [project.vxproject] [ticks]
+static bool IsPhysicsBenchmarkRun(const Vortex::ApplicationCommandLineArgs& args)
+{
+	return args.Count > 2 && std::string_view(args[1]) == "--physics-benchmark";
+}
+
+static uint32_t ParseTickCount(const Vortex::ApplicationCommandLineArgs& args)
+{
+	const uint32_t defaultTickCount = 600;
+
+	if (args.Count <= 4)
+		return defaultTickCount;
+
+	const std::string_view arg(args[4]);
+	uint32_t tickCount = 0;
+	const auto [end, error] = std::from_chars(arg.data(), arg.data() + arg.size(), tickCount);
+
+	if (error != std::errc() || end != arg.data() + arg.size() || tickCount == 0)
+	{
+		VX_ERROR("Physics Benchmark: invalid tick count '{}', using {}", arg, defaultTickCount);
+		return defaultTickCount;
+	}
+
+	return tickCount;
+}
 
 class SandboxApp : public Vortex::Application
 {
@@ -9,20 +39,33 @@ public:
 	SandboxApp(const Vortex::ApplicationProperties& properties)
 		: Application(properties)
 	{
+		const Vortex::ApplicationCommandLineArgs& args = properties.CommandLineArgs;
+
+		if (IsPhysicsBenchmarkRun(args))
+		{
+			const std::string projectFilepath = args.Count > 3 ? args[3] : "";
+			PushLayer(new PhysicsBenchmark(projectFilepath, args[2], ParseTickCount(args)));
+			return;
+		}
+
 		PushLayer(new Sandbox());
+		PushLayer(new AnimationBenchmark());
+		PushLayer(new PhysicsBenchmark());
 	}
 };
 
 Vortex::Application* Vortex::CreateApplication(ApplicationCommandLineArgs args)
 {
+	const bool headless = IsPhysicsBenchmarkRun(args);
+
 	ApplicationProperties props;
 	props.Name = "Sandbox";
 	props.WindowWidth = 1600;
 	props.WindowHeight = 900;
 	props.MaximizeWindow = false;
 	props.WindowDecorated = true;
-	props.VSync = true;
-	props.EnableGUI = true;
+	props.VSync = !headless;
+	props.EnableGUI = !headless;
 	props.IsRuntime = false;
 	props.GraphicsAPI = RendererAPI::API::OpenGL;
 
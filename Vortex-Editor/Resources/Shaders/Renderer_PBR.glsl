@@ -24,10 +24,8 @@ layout (location = 2) in vec3  a_Normal;
 layout (location = 3) in vec3  a_Tangent;
 layout (location = 4) in vec3  a_BiTangent;
 layout (location = 5) in vec2  a_TexCoord;
-layout (location = 6) in vec2  a_TexScale;
-layout (location = 7) in ivec4 a_BoneIDs;
-layout (location = 8) in vec4  a_BoneWeights;
-layout (location = 9) in int   a_EntityID;
+layout (location = 6) in ivec4 a_BoneIDs;
+layout (location = 7) in vec4  a_BoneWeights;
 
 out DATA
 {
@@ -35,7 +33,6 @@ out DATA
 	vec4       Color;
 	vec3       Normal;
 	vec2       TexCoord;
-	vec2       TexScale;
 	flat int   EntityID;
 
 	float      Visibility;
@@ -46,6 +43,7 @@ out DATA
 } vertexOut;
 
 uniform mat4 u_Model;
+uniform int u_EntityID;
 uniform mat4 u_ViewProjection;
 uniform mat4 u_View;
 uniform mat4 u_SkyLightProjection;
@@ -53,7 +51,13 @@ uniform vec2 u_FogProperties; // (Density, Gradient)
 
 #define MAX_BONES 100
 #define MAX_BONE_INFLUENCE 4
-uniform mat4 u_FinalBoneMatrices[MAX_BONES];
+// Bones of every skinned mesh drawn this frame, u_BoneOffset is where ours start
+layout (std430, binding = 0) readonly buffer BonePalette
+{
+	mat4 u_FinalBoneMatrices[];
+};
+
+uniform int u_BoneOffset;
 uniform bool u_HasAnimations;
 
 void main()
@@ -74,9 +78,9 @@ void main()
 				break;
 			}
 
-			vec4 localPosition = u_FinalBoneMatrices[a_BoneIDs[i]] * vec4(a_Position, 1.0);
+			vec4 localPosition = u_FinalBoneMatrices[u_BoneOffset + a_BoneIDs[i]] * vec4(a_Position, 1.0);
 			totalPosition += localPosition * a_BoneWeights[i];
-			localNormal = mat3(u_FinalBoneMatrices[a_BoneIDs[i]]) * a_Normal;
+			localNormal = mat3(u_FinalBoneMatrices[u_BoneOffset + a_BoneIDs[i]]) * a_Normal;
 		}
 
 		vertexOut.Position = vec3(u_Model * totalPosition);
@@ -93,8 +97,7 @@ void main()
 	mat3 model = mat3(u_Model);
 	vertexOut.Normal = normalize(model * a_Normal);
 	vertexOut.TexCoord = a_TexCoord;
-	vertexOut.TexScale = a_TexScale;
-	vertexOut.EntityID = a_EntityID;
+	vertexOut.EntityID = u_EntityID;
 
 	// Fog Calculation
 	vec4 positionRelativeToCam = u_View * vec4(vertexOut.Position, 1.0);
@@ -124,7 +127,6 @@ in DATA
 	vec4       Color;
 	vec3       Normal;
 	vec2       TexCoord;
-	vec2       TexScale;
 	flat int   EntityID;
 
 	float      Visibility;
@@ -151,6 +153,8 @@ struct Material
 
 	float Opacity;
 
+	vec2 UV;
+
 	bool HasAlbedoMap;
 	bool HasNormalMap;
 	bool HasMetallicMap;
@@ -171,12 +175,12 @@ struct SkyLight
 	bool SoftShadows;
 };
 
+// vec3s are paired with a float so the std430 layout has no hidden padding
 struct PointLight
 {
 	vec3 Radiance;
-	vec3 Position;
 	float Intensity;
-
+	vec3 Position;
 	float ShadowBias;
 	float FarPlane;
 };
@@ -184,13 +188,11 @@ struct PointLight
 struct SpotLight
 {
 	vec3 Radiance;
-	vec3 Position;
-	vec3 Direction;
 	float Intensity;
-
+	vec3 Position;
 	float CutOff;
+	vec3 Direction;
 	float OuterCutOff;
-
 	float ShadowBias;
 };
 
@@ -227,10 +229,15 @@ struct SceneProperties
 #define MAX_POINT_LIGHTS 50
 #define MAX_SPOT_LIGHTS 50
 
+// Uploaded once per frame, layout must match RendererInternalData::SceneLightsData
+layout (std430, binding = 1) readonly buffer SceneLights
+{
+	PointLight   u_PointLights[MAX_POINT_LIGHTS];
+	SpotLight    u_SpotLights[MAX_SPOT_LIGHTS];
+};
+
 uniform Material        u_Material;
 uniform SkyLight        u_SkyLight;
-uniform PointLight      u_PointLights[MAX_POINT_LIGHTS];
-uniform SpotLight       u_SpotLights[MAX_SPOT_LIGHTS];
 uniform SceneProperties u_SceneProperties;
 uniform samplerCube     u_PointLightShadowMaps[MAX_POINT_LIGHTS];
 uniform sampler2D       u_SpotLightShadowMaps[MAX_SPOT_LIGHTS];
@@ -251,6 +258,7 @@ float gaSchlickGGX(float NdotV, float roughness);
 float GeometrySmith(vec3 N, vec3 V, vec3 L, float roughness);
 vec3 FresnelSchlick(float cosTheta, vec3 F0);
 vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness);
+vec3 SampleNormalMap(vec2 texCoords);
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir);
 float ShadowCalculation(vec4 fragPosLightSpace, float NdotL, sampler2D shadowMap, float shadowBias, bool softShadows);
 float CubemapShadowCalculation(vec3 fragPos, vec3 lightPos, samplerCube shadowMap, float shadowBias, float farPlane);
@@ -258,12 +266,12 @@ float CubemapShadowCalculation(vec3 fragPos, vec3 lightPos, samplerCube shadowMa
 void main()
 {
 	vec3 viewDir = normalize(fragmentIn.TBN * u_SceneProperties.CameraPosition - fragmentIn.TBN * fragmentIn.Position);
-	vec2 textureCoords = ((u_Material.HasPOMap) ? ParallaxOcclusionMapping(fragmentIn.TexCoord * fragmentIn.TexScale, viewDir) : fragmentIn.TexCoord * fragmentIn.TexScale);
+	vec2 textureCoords = ((u_Material.HasPOMap) ? ParallaxOcclusionMapping(fragmentIn.TexCoord * u_Material.UV, viewDir) : fragmentIn.TexCoord * u_Material.UV);
 
 	FragmentProperties properties;
 	properties.Albedo = ((u_Material.HasAlbedoMap) ? pow(texture(u_Material.AlbedoMap, textureCoords).rgb, vec3(u_SceneProperties.Gamma)) * u_Material.Albedo : u_Material.Albedo);
 	properties.Color = fragmentIn.Color;
-	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * (texture(u_Material.NormalMap, textureCoords).rgb * 2.0 - 1.0)) : normalize(fragmentIn.Normal));
+	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * SampleNormalMap(textureCoords)) : normalize(fragmentIn.Normal));
 	properties.Metallic = ((u_Material.HasMetallicMap) ? texture(u_Material.MetallicMap, textureCoords).r : u_Material.Metallic);
 	properties.Roughness = ((u_Material.HasRoughnessMap) ? texture(u_Material.RoughnessMap, textureCoords).r : u_Material.Roughness);
 	properties.EmissionMap = ((u_Material.HasEmissionMap) ? texture(u_Material.EmissionMap, textureCoords).rgb : vec3(0.0));
@@ -534,6 +542,14 @@ vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
 	return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
+// Normal maps can be stored as BC5 with only X and Y, Z is rebuilt from the unit length
+vec3 SampleNormalMap(vec2 texCoords)
+{
+	vec2 xy = texture(u_Material.NormalMap, texCoords).rg * 2.0 - 1.0;
+	float z = sqrt(max(1.0 - dot(xy, xy), 0.0));
+	return vec3(xy, z);
+}
+
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir)
 {
 	const float minLayers = 8.0;
@@ -23,8 +23,10 @@ layout (location = 2) in vec3  a_Normal;
 layout (location = 3) in vec3  a_Tangent;
 layout (location = 4) in vec3  a_BiTangent;
 layout (location = 5) in vec2  a_TexCoord;
-layout (location = 6) in vec2  a_TexScale;
-layout (location = 7) in int   a_EntityID;
+
+// Per instance
+layout (location = 6)  in mat4 a_Model;
+layout (location = 10) in int  a_InstanceEntityID;
 
 out DATA
 {
@@ -32,7 +34,6 @@ out DATA
 	vec4       Color;
 	vec3       Normal;
 	vec2       TexCoord;
-	vec2       TexScale;
 	flat int   EntityID;
 
 	float      Visibility;
@@ -42,7 +43,6 @@ out DATA
 	mat3       TBN;
 } vertexOut;
 
-uniform mat4 u_Model;
 uniform mat4 u_ViewProjection;
 uniform mat4 u_View;
 uniform mat4 u_SkyLightProjection;
@@ -50,14 +50,13 @@ uniform vec2 u_FogProperties; // (Density, Gradient)
 
 void main()
 {
-	vertexOut.Position = vec3(u_Model * vec4(a_Position, 1.0));
+	vertexOut.Position = vec3(a_Model * vec4(a_Position, 1.0));
 	vertexOut.Color = a_Color;
 
-	mat3 model = mat3(u_Model);
+	mat3 model = mat3(a_Model);
 	vertexOut.Normal = normalize(model * a_Normal);
 	vertexOut.TexCoord = a_TexCoord;
-	vertexOut.TexScale = a_TexScale;
-	vertexOut.EntityID = a_EntityID;
+	vertexOut.EntityID = a_InstanceEntityID;
 
 	// Fog Calculation
 	vec4 positionRelativeToCam = u_View * vec4(vertexOut.Position, 1.0);
@@ -89,7 +88,6 @@ in DATA
 	vec4       Color;
 	vec3       Normal;
 	vec2       TexCoord;
-	vec2       TexScale;
 	flat int   EntityID;
 
 	float      Visibility;
@@ -116,6 +114,8 @@ struct Material
 
 	float Opacity;
 
+	vec2 UV;
+
 	bool HasAlbedoMap;
 	bool HasNormalMap;
 	bool HasMetallicMap;
@@ -136,12 +136,12 @@ struct SkyLight
 	bool SoftShadows;
 };
 
+// vec3s are paired with a float so the std430 layout has no hidden padding
 struct PointLight
 {
 	vec3 Radiance;
-	vec3 Position;
 	float Intensity;
-
+	vec3 Position;
 	float ShadowBias;
 	float FarPlane;
 };
@@ -149,21 +149,19 @@ struct PointLight
 struct SpotLight
 {
 	vec3 Radiance;
-	vec3 Position;
-	vec3 Direction;
 	float Intensity;
-
+	vec3 Position;
 	float CutOff;
+	vec3 Direction;
 	float OuterCutOff;
-
 	float ShadowBias;
 };
 
 struct EmissiveMesh
 {
 	vec3 Radiance;
-	vec3 Position;
 	float Intensity;
+	vec3 Position;
 };
 
 struct FragmentProperties
@@ -201,11 +199,16 @@ struct SceneProperties
 #define MAX_SPOT_LIGHTS 50
 #define MAX_EMISSIVE_MESHES 50
 
+// Uploaded once per frame, layout must match RendererInternalData::SceneLightsData
+layout (std430, binding = 1) readonly buffer SceneLights
+{
+	PointLight   u_PointLights[MAX_POINT_LIGHTS];
+	SpotLight    u_SpotLights[MAX_SPOT_LIGHTS];
+	EmissiveMesh u_EmissiveMeshes[MAX_EMISSIVE_MESHES];
+};
+
 uniform Material        u_Material;
 uniform SkyLight        u_SkyLight;
-uniform PointLight      u_PointLights[MAX_POINT_LIGHTS];
-uniform SpotLight       u_SpotLights[MAX_SPOT_LIGHTS];
-uniform EmissiveMesh    u_EmissiveMeshes[MAX_EMISSIVE_MESHES];
 uniform SceneProperties u_SceneProperties;
 uniform samplerCube     u_PointLightShadowMaps[MAX_POINT_LIGHTS];
 uniform sampler2D       u_SpotLightShadowMaps[MAX_SPOT_LIGHTS];
@@ -226,6 +229,7 @@ float gaSchlickGGX(float NdotV, float roughness);
 float GeometrySmith(vec3 N, vec3 V, vec3 L, float roughness);
 vec3 FresnelSchlick(float cosTheta, vec3 F0);
 vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness);
+vec3 SampleNormalMap(vec2 texCoords);
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir);
 float ShadowCalculation(vec4 fragPosLightSpace, float NdotL, sampler2D shadowMap, float shadowBias, bool softShadows);
 float CubemapShadowCalculation(vec3 fragPos, vec3 lightPos, samplerCube shadowMap, float shadowBias, float farPlane);
@@ -233,12 +237,12 @@ float CubemapShadowCalculation(vec3 fragPos, vec3 lightPos, samplerCube shadowMa
 void main()
 {
 	const vec3 viewDir = normalize(fragmentIn.TBN * u_SceneProperties.CameraPosition - fragmentIn.TBN * fragmentIn.Position);
-	const vec2 textureCoords = ((u_Material.HasPOMap) ? ParallaxOcclusionMapping(fragmentIn.TexCoord * fragmentIn.TexScale, viewDir) : fragmentIn.TexCoord * fragmentIn.TexScale);
+	const vec2 textureCoords = ((u_Material.HasPOMap) ? ParallaxOcclusionMapping(fragmentIn.TexCoord * u_Material.UV, viewDir) : fragmentIn.TexCoord * u_Material.UV);
 
 	FragmentProperties properties;
 	properties.Albedo = ((u_Material.HasAlbedoMap) ? pow(texture(u_Material.AlbedoMap, textureCoords).rgb, vec3(u_SceneProperties.Gamma)) * u_Material.Albedo : u_Material.Albedo);
 	properties.Color = fragmentIn.Color;
-	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * (texture(u_Material.NormalMap, textureCoords).rgb * 2.0 - 1.0)) : normalize(fragmentIn.Normal));
+	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * SampleNormalMap(textureCoords)) : normalize(fragmentIn.Normal));
 	properties.Metallic = ((u_Material.HasMetallicMap) ? texture(u_Material.MetallicMap, textureCoords).r : u_Material.Metallic);
 	properties.Roughness = ((u_Material.HasRoughnessMap) ? texture(u_Material.RoughnessMap, textureCoords).r : u_Material.Roughness);
 	properties.EmissionMap = ((u_Material.HasEmissionMap) ? texture(u_Material.EmissionMap, textureCoords).rgb : vec3(0.0));
@@ -538,6 +542,14 @@ vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
 	return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }
 
+// Normal maps can be stored as BC5 with only X and Y, Z is rebuilt from the unit length
+vec3 SampleNormalMap(vec2 texCoords)
+{
+	vec2 xy = texture(u_Material.NormalMap, texCoords).rg * 2.0 - 1.0;
+	float z = sqrt(max(1.0 - dot(xy, xy), 0.0));
+	return vec3(xy, z);
+}
+
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir)
 {
 	const float minLayers = 8.0;
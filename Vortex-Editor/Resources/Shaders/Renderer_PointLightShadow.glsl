@@ -13,7 +13,13 @@ uniform mat4 u_Model;
 
 #define MAX_BONES 100
 #define MAX_BONE_INFLUENCE 4
-uniform mat4 u_FinalBoneMatrices[MAX_BONES];
+// Bones of every skinned mesh drawn this frame, u_BoneOffset is where ours start
+layout (std430, binding = 0) readonly buffer BonePalette
+{
+	mat4 u_FinalBoneMatrices[];
+};
+
+uniform int u_BoneOffset;
 uniform bool u_HasAnimations;
 
 void main()
@@ -37,7 +43,7 @@ void main()
 			break;
 		}
 
-		vec4 localPosition = u_FinalBoneMatrices[a_BoneIDs[i]] * vec4(a_Position, 1.0);
+		vec4 localPosition = u_FinalBoneMatrices[u_BoneOffset + a_BoneIDs[i]] * vec4(a_Position, 1.0);
 		totalPosition += localPosition * a_BoneWeights[i];
 	}
 
@@ -11,17 +11,21 @@ layout (location = 2) in vec3  a_Normal;
 layout (location = 3) in vec3  a_Tangent;
 layout (location = 4) in vec3  a_BiTangent;
 layout (location = 5) in vec2  a_TexCoord;
-layout (location = 6) in vec2  a_TexScale;
-layout (location = 7) in ivec4 a_BoneIDs;
-layout (location = 8) in vec4  a_BoneWeights;
-layout (location = 9) in int   a_EntityID;
+layout (location = 6) in ivec4 a_BoneIDs;
+layout (location = 7) in vec4  a_BoneWeights;
 
 uniform mat4 u_LightProjection;
 uniform mat4 u_Model;
 
 #define MAX_BONES 100
 #define MAX_BONE_INFLUENCE 4
-uniform mat4 u_FinalBoneMatrices[MAX_BONES];
+// Bones of every skinned mesh drawn this frame, u_BoneOffset is where ours start
+layout (std430, binding = 0) readonly buffer BonePalette
+{
+	mat4 u_FinalBoneMatrices[];
+};
+
+uniform int u_BoneOffset;
 uniform bool u_HasAnimations;
 
 void main()
@@ -45,7 +49,7 @@ void main()
 			break;
 		}
 
-		vec4 localPosition = u_FinalBoneMatrices[a_BoneIDs[i]] * vec4(a_Position, 1.0);
+		vec4 localPosition = u_FinalBoneMatrices[u_BoneOffset + a_BoneIDs[i]] * vec4(a_Position, 1.0);
 		totalPosition += localPosition * a_BoneWeights[i];
 	}
 
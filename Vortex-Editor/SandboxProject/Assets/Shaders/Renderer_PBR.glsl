@@ -230,6 +230,7 @@ float GeometrySmith(vec3 N, vec3 V, vec3 L, float roughness);
 vec3 FresnelSchlick(float cosTheta, vec3 F0);
 vec3 FresnelSchlickRoughness(float cosTheta, vec3 F0, float rougness);
 float Attenuate(vec3 lightPosition, vec3 fragPosition, float constant, float linear, float quadratic);
+vec3 SampleNormalMap(vec2 texCoords);
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir);
 float ShadowCalculation(vec4 fragPosLightSpace, float NdotL, sampler2D shadowMap, float shadowBias);
 
@@ -240,7 +241,7 @@ void main()
 
 	FragmentProperties properties;
 	properties.Albedo = ((u_Material.HasAlbedoMap) ? pow(texture(u_Material.AlbedoMap, textureCoords).rgb, vec3(u_SceneProperties.Gamma)) : u_Material.Albedo);
-	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * (texture(u_Material.NormalMap, textureCoords).rgb * 2.0 - 1.0)) : normalize(fragmentIn.Normal));
+	properties.Normal = ((u_Material.HasNormalMap) ? normalize(fragmentIn.TBN * SampleNormalMap(textureCoords)) : normalize(fragmentIn.Normal));
 	properties.Metallic = ((u_Material.HasMetallicMap) ? texture(u_Material.MetallicMap, textureCoords).r : u_Material.Metallic);
 	properties.Roughness = ((u_Material.HasRoughnessMap) ? texture(u_Material.RoughnessMap, textureCoords).r : u_Material.Roughness);
 	properties.Emission = ((u_Material.HasEmissionMap) ? texture(u_Material.EmissionMap, textureCoords).rgb : u_Material.Emission);
@@ -470,6 +471,14 @@ float Attenuate(vec3 lightPosition, vec3 fragPosition, float constant, float lin
 	return 1.0 / (constant + linear * distance + quadratic * (distance * distance));
 }
 
+// Normal maps can be stored as BC5 with only X and Y, Z is rebuilt from the unit length
+vec3 SampleNormalMap(vec2 texCoords)
+{
+	vec2 xy = texture(u_Material.NormalMap, texCoords).rg * 2.0 - 1.0;
+	float z = sqrt(max(1.0 - dot(xy, xy), 0.0));
+	return vec3(xy, z);
+}
+
 vec2 ParallaxOcclusionMapping(vec2 texCoords, vec3 viewDir)
 {
 	const float minLayers = 8.0;
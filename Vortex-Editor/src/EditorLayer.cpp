@@ -1310,6 +1310,11 @@ namespace Vortex {
 						break;
 					}
 				}
+
+				if (selectedActor.HasComponent<RigidBody2DComponent>())
+				{
+					Physics2D::MarkBodyDirty(selectedActor);
+				}
 			}
 		}
 	}
@@ -3058,7 +3063,11 @@ namespace Vortex {
 	{
 		SaveProject();
 
-		// TODO build asset pack here
+		const Fs::Path assetPackPath = Project::GetAssetPackPath();
+		if (!Project::GetEditorAssetManager()->BuildAssetPack(assetPackPath))
+		{
+			VX_CONSOLE_LOG_ERROR("[Editor] Failed to build asset pack '{}'", assetPackPath.string());
+		}
 	}
 
 	void EditorLayer::BuildAndRunProject()
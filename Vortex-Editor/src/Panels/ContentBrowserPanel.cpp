@@ -542,7 +542,7 @@ public class Untitled : Actor
 				return;
 			}
 
-			Project::GetEditorAssetManager()->WriteToRegistryFile();
+			Project::GetEditorAssetManager()->MarkRegistryDirty();
 		}
 	}
 
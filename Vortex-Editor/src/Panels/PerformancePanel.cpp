@@ -39,6 +39,14 @@ namespace Vortex {
 		Gui::Text("Script Update: %.4fms", frameTime.ScriptUpdateTime);
 		Gui::Text("Physics Update: %.4fms", frameTime.PhysicsUpdateTime);
 
+		DrawHeading("Asset Streaming");
+		const AsyncAssetLoadStatistics loadStats = AssetManager::GetAsyncLoadStatistics();
+		Gui::Text("Queued:            %u", loadStats.Queued);
+		Gui::Text("Decoding:          %u", loadStats.InFlight);
+		Gui::Text("Awaiting Upload:   %u", loadStats.AwaitingFinalize);
+		Gui::Text("Failed:            %u", loadStats.Failed);
+		Gui::Text("Last Upload Batch: %u (%.4fms)", loadStats.LastFinalizeCount, loadStats.LastFinalizeTime);
+
 		DrawHeading("Input Assembly");
 		RenderStatistics stats = Renderer::GetStats();
 		const RenderStatistics temp = Renderer2D::GetStats();
@@ -53,6 +61,16 @@ namespace Vortex {
 		Gui::Text("Vertices:   %i", stats.GetVertexCount());
 		Gui::Text("Indices:    %i", stats.GetIndexCount());
 
+		DrawHeading("Instancing");
+		Gui::Text("Instanced Draw Calls: %i", stats.InstancedDrawCalls);
+		Gui::Text("Instances:            %i", stats.InstanceCount);
+
+		DrawHeading("Culling");
+		Gui::Text("Visible Meshes:         %i", stats.VisibleMeshes);
+		Gui::Text("Culled Meshes:          %i", stats.CulledMeshes);
+		Gui::Text("Visible Shadow Casters: %i", stats.VisibleShadowCasters);
+		Gui::Text("Culled Shadow Casters:  %i", stats.CulledShadowCasters);
+
 		DrawHeading("Graphics API");
 		const RendererAPI::Info& rendererInfo = Renderer::GetGraphicsAPIInfo();
 		Gui::Text("API:     %s", rendererInfo.Name);
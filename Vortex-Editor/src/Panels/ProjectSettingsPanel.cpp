@@ -173,6 +173,20 @@ namespace Vortex {
 				PhysicsScene::SetVelocityIterations(velocityIterations3D);
 			}
 
+			uint32_t tickRate3D = PhysicsScene::GetTickRate();
+			if (UI::Property("Tick Rate", tickRate3D, 1, 1, 1'000))
+			{
+				PhysicsScene::SetTickRate(tickRate3D);
+			}
+
+			uint32_t maxSubsteps3D = PhysicsScene::GetMaxSubsteps();
+			if (UI::Property("Max Substeps", maxSubsteps3D, 1, 1, 64))
+			{
+				PhysicsScene::SetMaxSubsteps(maxSubsteps3D);
+			}
+
+			UI::Property("Dispatcher Threads", m_ProjectProperties.PhysicsProps.Physics3DDispatcherThreads, 1, 0, 64, "Zero shares the engine worker threads, takes effect on the next simulation");
+
 			UI::EndPropertyGrid();
 			UI::EndTreeNode();
 		}
@@ -201,6 +215,18 @@ namespace Vortex {
 				Physics2D::SetPhysicsWorldVelocityIterations(velocityIterations2D);
 			}
 
+			uint32_t tickRate2D = Physics2D::GetPhysicsWorldTickRate();
+			if (UI::Property("Tick Rate", tickRate2D, 1, 1, 1'000))
+			{
+				Physics2D::SetPhysicsWorldTickRate(tickRate2D);
+			}
+
+			uint32_t maxSubsteps2D = Physics2D::GetPhysicsWorldMaxSubsteps();
+			if (UI::Property("Max Substeps", maxSubsteps2D, 1, 1, 64))
+			{
+				Physics2D::SetPhysicsWorldMaxSubsteps(maxSubsteps2D);
+			}
+
 			UI::EndPropertyGrid();
 			UI::EndTreeNode();
 		}
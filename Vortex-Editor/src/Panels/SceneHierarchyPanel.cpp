@@ -1390,10 +1390,11 @@ namespace Vortex {
 	void SceneHierarchyPanel::TransformComponentOnGuiRender(TransformComponent& component, Actor actor)
 	{
 		const float columnWidth = 100.0f;
+		bool modified = false;
 		UI::BeginPropertyGrid();
-		UI::DrawVec3Controls("Translation", component.Translation, 0.0f, columnWidth, -FLT_MIN, FLT_MAX);
+		modified |= UI::DrawVec3Controls("Translation", component.Translation, 0.0f, columnWidth, -FLT_MIN, FLT_MAX);
 		Math::vec3 rotation = Math::Rad2Deg(component.GetRotationEuler());
-		UI::DrawVec3Controls("Rotation", rotation, 0.0f, columnWidth, -FLT_MIN, FLT_MAX, [&]()
+		modified |= UI::DrawVec3Controls("Rotation", rotation, 0.0f, columnWidth, -FLT_MIN, FLT_MAX, [&]()
 		{
 			const float maxRotationEuler = 360.0f;
 			if (rotation.x > maxRotationEuler || rotation.x < -maxRotationEuler)
@@ -1404,8 +1405,13 @@ namespace Vortex {
 				rotation.z = 0.0f;
 			component.SetRotationEuler(Math::Deg2Rad(rotation));
 		});
-		UI::DrawVec3Controls("Scale", component.Scale, 1.0f, columnWidth, FLT_MIN, FLT_MAX);
+		modified |= UI::DrawVec3Controls("Scale", component.Scale, 1.0f, columnWidth, FLT_MIN, FLT_MAX);
 		UI::EndPropertyGrid();
+
+		if (modified && actor.HasComponent<RigidBody2DComponent>())
+		{
+			Physics2D::MarkBodyDirty(actor);
+		}
 	}
 
 	void SceneHierarchyPanel::CameraComponentOnGuiRender(CameraComponent& component, Actor actor)
@@ -2048,6 +2054,7 @@ namespace Vortex {
 
 		UI::Property("Rotation", emitterProperties.Rotation, 0.1f, FLT_MIN, FLT_MAX);
 		UI::Property("Lifetime", emitterProperties.LifeTime, 0.1f, FLT_MIN, FLT_MAX);
+		UI::Property("Max Particles", emitterProperties.MaxParticles, 1.0f, 1, 1'000'000);
 
 		UI::EndPropertyGrid();
 	}
@@ -2590,12 +2597,18 @@ namespace Vortex {
 		{
 			if (UI::Property("Mass", component.Mass, 0.01f, FLT_MIN, FLT_MAX))
 				modified = true;
-			UI::Property("Linear Velocity", component.LinearVelocity);
-			UI::Property("Max Linear Velocity", component.MaxLinearVelocity, 1.0f, FLT_MIN, FLT_MAX);
-			UI::Property("Linear Drag", component.LinearDrag, 0.01f, FLT_MIN, FLT_MAX);
-			UI::Property("Angular Velocity", component.AngularVelocity);
-			UI::Property("Max Angular Velocity", component.MaxAngularVelocity, 1.0f, FLT_MIN, FLT_MAX);
-			UI::Property("Angular Drag", component.AngularDrag, 0.01f, FLT_MIN, FLT_MAX, "%.2f");
+			if (UI::Property("Linear Velocity", component.LinearVelocity))
+				modified = true;
+			if (UI::Property("Max Linear Velocity", component.MaxLinearVelocity, 1.0f, FLT_MIN, FLT_MAX))
+				modified = true;
+			if (UI::Property("Linear Drag", component.LinearDrag, 0.01f, FLT_MIN, FLT_MAX))
+				modified = true;
+			if (UI::Property("Angular Velocity", component.AngularVelocity))
+				modified = true;
+			if (UI::Property("Max Angular Velocity", component.MaxAngularVelocity, 1.0f, FLT_MIN, FLT_MAX))
+				modified = true;
+			if (UI::Property("Angular Drag", component.AngularDrag, 0.01f, FLT_MIN, FLT_MAX, "%.2f"))
+				modified = true;
 
 			if (UI::Property("Disable Gravity", component.DisableGravity))
 				modified = true;
@@ -2714,6 +2727,7 @@ namespace Vortex {
 				const bool isSimulating = PhysicsScene::GetScene();
 				if (isSimulating)
 				{
+					Physics::MarkActorDirty(actor);
 					Physics::WakeUpActor(actor);
 				}
 			}
@@ -2846,6 +2860,7 @@ namespace Vortex {
 
 	void SceneHierarchyPanel::RigidBody2DComponentOnGuiRender(RigidBody2DComponent& component, Actor actor)
 	{
+		bool modified = false;
 		UI::BeginPropertyGrid();
 
 		const char* bodyTypes[] = { "Static", "Dynamic", "Kinematic" };
@@ -2853,50 +2868,68 @@ namespace Vortex {
 		if (UI::PropertyDropdown("Body Type", bodyTypes, VX_ARRAYSIZE(bodyTypes), currentBodyType))
 		{
 			component.Type = (RigidBody2DType)currentBodyType;
+			modified = true;
 		}
 
 		if (component.Type == RigidBody2DType::Dynamic)
 		{
-			UI::Property("Velocity", component.Velocity, 0.01f);
-			UI::Property("Drag", component.Drag, 0.01f, FLT_MIN, 1.0f);
-			UI::Property("Angular Velocity", component.AngularVelocity);
-			UI::Property("Angular Drag", component.AngularDrag, 0.01f, FLT_MIN, 1.0f);
-			UI::Property("Gravity Scale", component.GravityScale, 0.01f, FLT_MIN, 1.0f);
-			UI::Property("Freeze Rotation", component.FixedRotation);
+			modified |= UI::Property("Velocity", component.Velocity, 0.01f);
+			modified |= UI::Property("Drag", component.Drag, 0.01f, FLT_MIN, 1.0f);
+			modified |= UI::Property("Angular Velocity", component.AngularVelocity);
+			modified |= UI::Property("Angular Drag", component.AngularDrag, 0.01f, FLT_MIN, 1.0f);
+			modified |= UI::Property("Gravity Scale", component.GravityScale, 0.01f, FLT_MIN, 1.0f);
+			modified |= UI::Property("Freeze Rotation", component.FixedRotation);
 		}
 
 		UI::EndPropertyGrid();
+
+		if (modified)
+		{
+			Physics2D::MarkBodyDirty(actor);
+		}
 	}
 
 	void SceneHierarchyPanel::BoxCollider2DComponentOnGuiRender(BoxCollider2DComponent& component, Actor actor)
 	{
+		bool modified = false;
 		UI::BeginPropertyGrid();
 
-		UI::Property("Offset", component.Offset, 0.01f);
-		UI::Property("Size", component.Size, 0.01f);
-		UI::Property("Density", component.Density, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Friction", component.Friction, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Restitution", component.Restitution, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Threshold", component.RestitutionThreshold, 0.1f, FLT_MIN, FLT_MAX);
-		UI::Property("Visible", component.Visible);
-		UI::Property("Is Tigger", component.IsTrigger);
+		modified |= UI::Property("Offset", component.Offset, 0.01f);
+		modified |= UI::Property("Size", component.Size, 0.01f);
+		modified |= UI::Property("Density", component.Density, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Friction", component.Friction, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Restitution", component.Restitution, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Threshold", component.RestitutionThreshold, 0.1f, FLT_MIN, FLT_MAX);
+		modified |= UI::Property("Visible", component.Visible);
+		modified |= UI::Property("Is Tigger", component.IsTrigger);
 
 		UI::EndPropertyGrid();
+
+		if (modified)
+		{
+			Physics2D::MarkBodyDirty(actor);
+		}
 	}
 
 	void SceneHierarchyPanel::CircleCollider2DComponentOnGuiRender(CircleCollider2DComponent& component, Actor actor)
 	{
+		bool modified = false;
 		UI::BeginPropertyGrid();
 
-		UI::Property("Offset", component.Offset, 0.01f);
-		UI::Property("Radius", component.Radius, 0.01, FLT_MIN, FLT_MAX);
-		UI::Property("Density", component.Density, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Friction", component.Friction, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Restitution", component.Restitution, 0.01f, FLT_MIN, 1.0f);
-		UI::Property("Threshold", component.RestitutionThreshold, 0.1f, FLT_MIN, FLT_MAX);
-		UI::Property("Visible", component.Visible);
+		modified |= UI::Property("Offset", component.Offset, 0.01f);
+		modified |= UI::Property("Radius", component.Radius, 0.01, FLT_MIN, FLT_MAX);
+		modified |= UI::Property("Density", component.Density, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Friction", component.Friction, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Restitution", component.Restitution, 0.01f, FLT_MIN, 1.0f);
+		modified |= UI::Property("Threshold", component.RestitutionThreshold, 0.1f, FLT_MIN, FLT_MAX);
+		modified |= UI::Property("Visible", component.Visible);
 
 		UI::EndPropertyGrid();
+
+		if (modified)
+		{
+			Physics2D::MarkBodyDirty(actor);
+		}
 	}
 
 	void SceneHierarchyPanel::NavMeshAgentComponentOnGuiRender(NavMeshAgentComponent& component, Actor actor)
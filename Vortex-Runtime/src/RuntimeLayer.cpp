@@ -188,14 +188,18 @@ namespace Vortex {
 	{
 		VX_PROFILE_FUNCTION();
 
-		// TODO this should be changed to LoadRuntimeProject in the future
-		if (!ProjectLoader::LoadEditorProject(filepath))
+		// Builds ship with an asset pack, without one we fall back to the loose editor assets
+		m_UsingAssetPack = ProjectLoader::LoadRuntimeProject(filepath);
+
+		if (!m_UsingAssetPack && !ProjectLoader::LoadEditorProject(filepath))
 		{
 			return false;
 		}
 
 		const Fs::Path& startScenePath = Project::GetActive()->GetProperties().General.StartScene;
-		const AssetMetadata& metadata = Project::GetEditorAssetManager()->GetMetadata(startScenePath);
+		const AssetMetadata metadata = m_UsingAssetPack
+			? Project::GetRuntimeAssetManager()->GetMetadata(startScenePath)
+			: Project::GetEditorAssetManager()->GetMetadata(startScenePath);
 		VX_CORE_VERIFY(metadata.IsValid());
 
 		return OpenScene(metadata);
@@ -235,10 +239,20 @@ namespace Vortex {
 			return false;
 		}
 
-		const Fs::Path fullPath = Project::GetAssetDirectory() / metadata.Filepath;
-
 		SceneSerializer serializer(m_RuntimeScene);
-		if (serializer.Deserialize(fullPath.string()))
+		bool deserialized = false;
+
+		if (m_UsingAssetPack)
+		{
+			deserialized = serializer.DeserializeFromMemory(Project::GetRuntimeAssetManager()->GetAssetPayload(metadata.Handle));
+		}
+		else
+		{
+			const Fs::Path fullPath = Project::GetAssetDirectory() / metadata.Filepath;
+			deserialized = serializer.Deserialize(fullPath.string());
+		}
+
+		if (deserialized)
 		{
 			OnScenePlay();
 		}
@@ -255,7 +269,7 @@ namespace Vortex {
 		auto fn = [=]() {
 			bool opened = false;
 
-			std::unordered_set<AssetHandle> scenes = Project::GetEditorAssetManager()->GetAllAssetsWithType(AssetType::SceneAsset);
+			std::unordered_set<AssetHandle> scenes = Project::GetAssetManager()->GetAllAssetsWithType(AssetType::SceneAsset);
 
 			for (AssetHandle handle : scenes)
 			{
@@ -267,7 +281,9 @@ namespace Vortex {
 				if (String::FastCompare(sceneName, entry) == 0)
 					continue;
 
-				const AssetMetadata& metadata = Project::GetEditorAssetManager()->GetMetadata(handle);
+				const AssetMetadata metadata = m_UsingAssetPack
+					? Project::GetRuntimeAssetManager()->GetMetadata(handle)
+					: Project::GetEditorAssetManager()->GetMetadata(handle);
 				if (!AssetManager::IsHandleValid(metadata.Handle))
 					continue;
 
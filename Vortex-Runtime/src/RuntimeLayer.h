@@ -34,6 +34,9 @@ namespace Vortex {
 		SharedReference<Scene> m_RuntimeScene = nullptr;
 		Math::vec2 m_ViewportSize = Math::vec2();
 		ViewportBounds m_ViewportBounds;
+
+		// Set when the project booted from its .vxpak instead of the loose editor assets
+		bool m_UsingAssetPack = false;
 	};
 
 }
@@ -1164,6 +1164,15 @@ namespace Vortex {
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern bool Physics_Raycast(ref Vector3 origin, ref Vector3 direction, float maxDistance, out RaycastHit hit);
 
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Physics_RaycastBatch(RaycastQuery[] queries, RaycastHit[] hits, uint[] hitCounts, uint layerMask, uint maxHits);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Physics_SweepBatch(SweepQuery[] queries, RaycastHit[] hits, uint[] hitCounts, uint layerMask, uint maxHits);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Physics_OverlapBatch(OverlapQuery[] queries, OverlapHit[] hits, uint[] hitCounts, uint layerMask, uint maxHits);
+
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void Physics_GetSceneGravity(out Vector3 result);
 
@@ -1,13 +1,34 @@
-﻿namespace Vortex {
+﻿using System.Runtime.InteropServices;
+
+namespace Vortex {
 
 	public struct Collision
 	{
 		public ulong ActorID { get; private set; }
 
+		internal Collision(ulong actorID)
+		{
+			ActorID = actorID;
+		}
+
 		public Actor Actor => Scene.FindActorByID(ActorID);
 
 		public string Tag => Actor.Tag;
 		public string Marker => Actor.Marker;
 	}
 
+	internal enum ContactEventType : uint
+	{
+		CollisionEnter, CollisionExit, TriggerEnter, TriggerExit,
+	}
+
+	// Layout must match the native ManagedContactEvent in PhysicsContactListener.cpp
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct ContactEvent
+	{
+		public uint ReceiverIndex;
+		public ContactEventType Type;
+		public ulong OtherID;
+	}
+
 }
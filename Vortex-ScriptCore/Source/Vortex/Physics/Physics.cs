@@ -33,6 +33,24 @@
 		{
 			return InternalCalls.Physics_Raycast(ref origin, ref direction, maxDistance, out hit);
 		}
+
+		/// <summary>
+		/// Runs every query in one native call, hits for query i start at hits[i * maxHits] and hitCounts[i] says how many are valid
+		/// </summary>
+		public static void RaycastBatch(RaycastQuery[] queries, RaycastHit[] hits, uint[] hitCounts, uint layerMask = uint.MaxValue, uint maxHits = 1)
+		{
+			InternalCalls.Physics_RaycastBatch(queries, hits, hitCounts, layerMask, maxHits);
+		}
+
+		public static void SweepBatch(SweepQuery[] queries, RaycastHit[] hits, uint[] hitCounts, uint layerMask = uint.MaxValue, uint maxHits = 1)
+		{
+			InternalCalls.Physics_SweepBatch(queries, hits, hitCounts, layerMask, maxHits);
+		}
+
+		public static void OverlapBatch(OverlapQuery[] queries, OverlapHit[] hits, uint[] hitCounts, uint layerMask = uint.MaxValue, uint maxHits = 1)
+		{
+			InternalCalls.Physics_OverlapBatch(queries, hits, hitCounts, layerMask, maxHits);
+		}
 	}
 
 }
@@ -0,0 +1,65 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Vortex {
+
+	// Layouts must match the native structs in PhysicsTypes.h
+
+	public enum QueryGeometryType : uint
+	{
+		Sphere, Box, Capsule,
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct QueryGeometry
+	{
+		public QueryGeometryType Type;
+		public Vector3 HalfSize; // Box
+		public float Radius; // Sphere, Capsule
+		public float HalfHeight; // Capsule
+
+		public static QueryGeometry Sphere(float radius) => new QueryGeometry { Type = QueryGeometryType.Sphere, Radius = radius };
+		public static QueryGeometry Box(Vector3 halfSize) => new QueryGeometry { Type = QueryGeometryType.Box, HalfSize = halfSize };
+		public static QueryGeometry Capsule(float radius, float halfHeight) => new QueryGeometry { Type = QueryGeometryType.Capsule, Radius = radius, HalfHeight = halfHeight };
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct RaycastQuery
+	{
+		public Vector3 Origin;
+		public Vector3 Direction;
+		public float MaxDistance;
+
+		public RaycastQuery(Vector3 origin, Vector3 direction, float maxDistance)
+		{
+			Origin = origin;
+			Direction = direction;
+			MaxDistance = maxDistance;
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct SweepQuery
+	{
+		public QueryGeometry Geometry;
+		public Vector3 Origin;
+		public Quaternion Rotation;
+		public Vector3 Direction;
+		public float MaxDistance;
+	}
+
+	[StructLayout(LayoutKind.Sequential)]
+	public struct OverlapQuery
+	{
+		public QueryGeometry Geometry;
+		public Vector3 Origin;
+		public Quaternion Rotation;
+	}
+
+	public struct OverlapHit
+	{
+		public ulong EntityID { get; private set; }
+
+		public Actor Entity => Scene.FindActorByID(EntityID);
+	}
+
+}
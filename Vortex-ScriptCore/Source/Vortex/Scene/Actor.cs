@@ -75,6 +75,31 @@ namespace Vortex {
 		protected virtual void OnDestroy() { }
 		protected virtual void OnGuiRender() { }
 
+		// Called once per physics step with every buffered contact event, a throwing callback doesn't drop the events after it
+		internal static void DispatchContactEvents(Actor[] receivers, ContactEvent[] events)
+		{
+			foreach (ContactEvent contactEvent in events)
+			{
+				Actor receiver = receivers[contactEvent.ReceiverIndex];
+				Collision other = new Collision(contactEvent.OtherID);
+
+				try
+				{
+					switch (contactEvent.Type)
+					{
+						case ContactEventType.CollisionEnter: receiver.OnCollisionEnter(other); break;
+						case ContactEventType.CollisionExit:  receiver.OnCollisionExit(other);  break;
+						case ContactEventType.TriggerEnter:   receiver.OnTriggerEnter(other);   break;
+						case ContactEventType.TriggerExit:    receiver.OnTriggerExit(other);    break;
+					}
+				}
+				catch (Exception e)
+				{
+					Log.Error(e.ToString());
+				}
+			}
+		}
+
 		public Actor GetChild(uint index)
 		{
 			ulong actorID = InternalCalls.Actor_GetChild(ID, index);
@@ -11,6 +11,7 @@
 #include "Vortex/Core/Platform.h"
 #include "Vortex/Core/Timer.h"
 #include "Vortex/Core/TimeStep.h"
+#include "Vortex/Core/JobSystem.h"
 #include "Vortex/System/SystemManager.h"
 #include "Vortex/ReferenceCounting/SharedRef.h"
 #include "Vortex/ReferenceCounting/RefCounted.h"
@@ -131,12 +132,13 @@
 
 #include "Vortex/Renderer/ParticleSystem/ParticleSystem.h"
 #include "Vortex/Renderer/ParticleSystem/ParticleEmitter.h"
-#include "Vortex/Renderer/ParticleSystem/Particle.h"
+#include "Vortex/Renderer/ParticleSystem/ParticlePool.h"
 /// ---------------------------------------------------
 
 /// Utilities
 #include "Vortex/Utils/FileDialogue.h"
 #include "Vortex/Utils/FileSystem.h"
+#include "Vortex/Utils/Hash.h"
 #include "Vortex/Utils/Random.h"
 #include "Vortex/Utils/Time.h"
 /// ---------------------------------------------------
@@ -16,7 +16,7 @@ namespace Vortex {
 		aiProcess_Triangulate |             // Make sure we're triangles
 		aiProcess_SortByPType |             // Split AnimatedMeshes by primitive type
 		aiProcess_GenNormals |              // Make sure we have legit normals
-		aiProcess_GenUVCoords |             // Convert UVs if required 
+		aiProcess_GenUVCoords |             // Convert UVs if required
 		aiProcess_OptimizeMeshes |          // Batch draws where possible
 		aiProcess_JoinIdenticalVertices |
 		//aiProcess_GlobalScale |             // e.g. convert cm to m for fbx import (and other formats where cm is native)
@@ -43,41 +43,77 @@ namespace Vortex {
 		VX_CORE_ASSERT(scene && scene->mRootNode, "Invalid Scene");
 		auto animation = scene->mAnimations[0];
 		m_Duration = (float)animation->mDuration;
-		m_TicksPerSecond = (int)animation->mTicksPerSecond;
-		aiMatrix4x4 globalTransformation = scene->mRootNode->mTransformation;
-		globalTransformation = globalTransformation.Inverse();
-		ReadHeirarchyData(m_RootNode, scene->mRootNode);
+		m_TicksPerSecond = (float)animation->mTicksPerSecond;
+		ReadHeirarchyData(scene->mRootNode, Skeleton::InvalidIndex);
 
-		ReadMissingBones(animation, mesh);
+		ReadChannels(animation, mesh);
 	}
 
-	Bone* Animation::FindBone(const std::string& name)
+	Animation::Animation(const Skeleton& skeleton, float duration, float ticksPerSecond)
+		: m_Duration(duration), m_TicksPerSecond(ticksPerSecond), m_Skeleton(skeleton)
 	{
-		auto iter = std::find_if(m_Bones.begin(), m_Bones.end(),
-			[&](const Bone& Bone)
-			{
-				return Bone.GetBoneName() == name;
-			}
-		);
+	}
 
-		if (iter == m_Bones.end())
-			return nullptr;
-		else
-			return &(*iter);
+	int32_t Animation::AddChannel()
+	{
+		AnimationChannel& channel = m_Channels.emplace_back();
+		channel.Positions.Offset = (uint32_t)m_PositionTimes.size();
+		channel.Rotations.Offset = (uint32_t)m_RotationTimes.size();
+		channel.Scales.Offset = (uint32_t)m_ScaleTimes.size();
+
+		return (int32_t)m_Channels.size() - 1;
 	}
 
-	void Animation::ReadMissingBones(const aiAnimation* animation, SharedReference<Mesh>& mesh)
+	void Animation::AddPositionKey(float time, const Math::vec3& position)
 	{
-		int size = animation->mNumChannels;
+		VX_CORE_ASSERT(!m_Channels.empty(), "No channel to add keys to!");
+
+		m_PositionTimes.push_back(time);
+		m_PositionKeys.push_back(position);
+		m_Channels.back().Positions.Count++;
+	}
+
+	void Animation::AddRotationKey(float time, const Math::quaternion& rotation)
+	{
+		VX_CORE_ASSERT(!m_Channels.empty(), "No channel to add keys to!");
+
+		m_RotationTimes.push_back(time);
+		m_RotationKeys.push_back(Math::Normalize(rotation));
+		m_Channels.back().Rotations.Count++;
+	}
+
+	void Animation::AddScaleKey(float time, const Math::vec3& scale)
+	{
+		VX_CORE_ASSERT(!m_Channels.empty(), "No channel to add keys to!");
+
+		m_ScaleTimes.push_back(time);
+		m_ScaleKeys.push_back(scale);
+		m_Channels.back().Scales.Count++;
+	}
+
+	void Animation::ReadHeirarchyData(const aiNode* src, int32_t parentIndex)
+	{
+		VX_CORE_ASSERT(src, "Node was null pointer!");
+
+		// Depth first so every parent is compiled before its children
+		const int32_t nodeIndex = m_Skeleton.AddNode(src->mName.data, parentIndex, FromAssimpMat4(src->mTransformation));
+
+		for (uint32_t i = 0; i < src->mNumChildren; i++)
+		{
+			ReadHeirarchyData(src->mChildren[i], nodeIndex);
+		}
+	}
 
-		auto& boneInfoMap = mesh->GetBoneInfoMap();// getting m_BoneInfoMap from Model class
-		uint32_t& boneCount = mesh->GetBoneCount(); // getting the m_BoneCounter from Model class
+	void Animation::ReadChannels(const aiAnimation* animation, SharedReference<Mesh>& mesh)
+	{
+		auto& boneInfoMap = mesh->GetBoneInfoMap();
+		uint32_t& boneCount = mesh->GetBoneCount();
 
 		// reading channels(bones engaged in an animation and their keyframes)
-		for (int i = 0; i < size; i++)
+		for (uint32_t i = 0; i < animation->mNumChannels; i++)
 		{
-			auto channel = animation->mChannels[i];
-			std::string boneName = channel->mNodeName.data;
+			const aiNodeAnim* channel = animation->mChannels[i];
+			const std::string boneName = channel->mNodeName.data;
 
 			if (boneInfoMap.find(boneName) == boneInfoMap.end())
 			{
@@ -85,27 +121,44 @@ namespace Vortex {
 				boneCount++;
 			}
 
-			Bone bone(boneName, boneInfoMap[channel->mNodeName.data].ID, channel);
-			m_Bones.push_back(bone);
-		}
+			const int32_t nodeIndex = m_Skeleton.FindNode(boneName);
+			if (nodeIndex == Skeleton::InvalidIndex)
+			{
+				VX_CONSOLE_LOG_WARN("Animation channel '{}' has no matching node, skipping", boneName);
+				continue;
+			}
 
-		m_BoneInfoMap = boneInfoMap;
-	}
+			const int32_t channelIndex = AddChannel();
+			m_Skeleton.SetNodeChannel(nodeIndex, channelIndex);
 
-	void Animation::ReadHeirarchyData(AssimpNodeData& dest, const aiNode* src) const
-	{
-		VX_CORE_ASSERT(src, "Node was null pointer!");
+			for (uint32_t key = 0; key < channel->mNumPositionKeys; key++)
+			{
+				AddPositionKey((float)channel->mPositionKeys[key].mTime, FromAssimpVec3(channel->mPositionKeys[key].mValue));
+			}
 
-		dest.Name = src->mName.data;
-		dest.Transformation = FromAssimpMat4(src->mTransformation);
-		dest.ChildrenCount = src->mNumChildren;
+			for (uint32_t key = 0; key < channel->mNumRotationKeys; key++)
+			{
+				AddRotationKey((float)channel->mRotationKeys[key].mTime, FromAssimpQuat(channel->mRotationKeys[key].mValue));
+			}
 
-		for (uint32_t i = 0; i < src->mNumChildren; i++)
+			for (uint32_t key = 0; key < channel->mNumScalingKeys; key++)
+			{
+				AddScaleKey((float)channel->mScalingKeys[key].mTime, FromAssimpVec3(channel->mScalingKeys[key].mValue));
+			}
+		}
+
+		// Resolve bone indices once so playback never touches a string
+		for (const auto& [boneName, boneInfo] : boneInfoMap)
 		{
-			AssimpNodeData newData;
-			ReadHeirarchyData(newData, src->mChildren[i]);
-			dest.Children.push_back(newData);
+			const int32_t nodeIndex = m_Skeleton.FindNode(boneName);
+			if (nodeIndex == Skeleton::InvalidIndex)
+				continue;
+
+			m_Skeleton.SetNodeBone(nodeIndex, (int32_t)boneInfo.ID, boneInfo.OffsetMatrix);
 		}
+
+		// Vertices may reference bones that aren't part of the hierarchy, keep their slots
+		m_Skeleton.SetBoneCount(boneCount);
 	}
 
 	SharedRef<Animation> Animation::Create(const std::string& animationPath, AssetHandle meshAssetHandle)
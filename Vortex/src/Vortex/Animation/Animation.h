@@ -4,24 +4,30 @@
 
 #include "Vortex/Math/Math.h"
 
-#include "Vortex/Animation/Bone.h"
+#include "Vortex/Animation/Skeleton.h"
 
 #include "Vortex/Renderer/Mesh.h"
 
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 struct aiAnimation;
 struct aiNode;
 
 namespace Vortex {
 
-	struct VORTEX_API AssimpNodeData
+	struct VORTEX_API KeyframeRange
 	{
-		Math::mat4 Transformation;
-		std::string Name;
-		int ChildrenCount;
-		std::vector<AssimpNodeData> Children;
+		uint32_t Offset = 0;
+		uint32_t Count = 0;
+	};
+
+	// Where a channel's keys live in the animation's keyframe arrays
+	struct VORTEX_API AnimationChannel
+	{
+		KeyframeRange Positions;
+		KeyframeRange Rotations;
+		KeyframeRange Scales;
 	};
 
 	class VORTEX_API Animation
@@ -29,34 +35,54 @@ namespace Vortex {
 	public:
 		Animation() = default;
 		Animation(const std::string& animationPath, AssetHandle meshAssetHandle);
+		Animation(const Skeleton& skeleton, float duration, float ticksPerSecond);
 		~Animation() = default;
 
-		Bone* FindBone(const std::string& name);
+		// Keys must be added in time order, one channel at a time
+		int32_t AddChannel();
+		void AddPositionKey(float time, const Math::vec3& position);
+		void AddRotationKey(float time, const Math::quaternion& rotation);
+		void AddScaleKey(float time, const Math::vec3& scale);
 
-		inline float GetTicksPerSecond() const { return (float)m_TicksPerSecond; }
+		inline float GetTicksPerSecond() const { return m_TicksPerSecond; }
 		inline float GetDuration() const { return m_Duration; }
-		inline const AssimpNodeData& GetRootNode() const { return m_RootNode; }
 
-		inline std::unordered_map<std::string, BoneInfo>& GetBoneIDMap()
-		{
-			return m_BoneInfoMap;
-		}
+		inline const Skeleton& GetSkeleton() const { return m_Skeleton; }
+		inline Skeleton& GetSkeleton() { return m_Skeleton; }
+
+		inline uint32_t GetChannelCount() const { return (uint32_t)m_Channels.size(); }
+		inline const AnimationChannel* GetChannels() const { return m_Channels.data(); }
+
+		inline const float* GetPositionTimes() const { return m_PositionTimes.data(); }
+		inline const Math::vec3* GetPositionKeys() const { return m_PositionKeys.data(); }
+		inline const float* GetRotationTimes() const { return m_RotationTimes.data(); }
+		inline const Math::quaternion* GetRotationKeys() const { return m_RotationKeys.data(); }
+		inline const float* GetScaleTimes() const { return m_ScaleTimes.data(); }
+		inline const Math::vec3* GetScaleKeys() const { return m_ScaleKeys.data(); }
 
 		inline const std::string& GetPath() const { return m_Filepath; }
 
 		static SharedRef<Animation> Create(const std::string& animationPath, AssetHandle meshAssetHandle);
 
 	private:
-		void ReadMissingBones(const aiAnimation* animation, SharedReference<Mesh>& mesh);
-		void ReadHeirarchyData(AssimpNodeData& dest, const aiNode* src) const;
+		void ReadHeirarchyData(const aiNode* src, int32_t parentIndex);
+		void ReadChannels(const aiAnimation* animation, SharedReference<Mesh>& mesh);
 
 	private:
 		std::string m_Filepath;
-		float m_Duration;
-		int m_TicksPerSecond;
-		std::vector<Bone> m_Bones;
-		AssimpNodeData m_RootNode;
-		std::unordered_map<std::string, BoneInfo> m_BoneInfoMap;
+		float m_Duration = 0.0f;
+		float m_TicksPerSecond = 0.0f;
+
+		Skeleton m_Skeleton;
+		std::vector<AnimationChannel> m_Channels;
+
+		// Keyframes for every channel packed back to back
+		std::vector<float> m_PositionTimes;
+		std::vector<Math::vec3> m_PositionKeys;
+		std::vector<float> m_RotationTimes;
+		std::vector<Math::quaternion> m_RotationKeys;
+		std::vector<float> m_ScaleTimes;
+		std::vector<Math::vec3> m_ScaleKeys;
 	};
 
 }
@@ -5,23 +5,56 @@
 
 namespace Vortex {
 
-	Animator::Animator(const SharedRef<Animation>& animation)
-		: m_CurrentAnimation(animation), m_CurrentTime(0.0f)
-	{
-		m_FinalBoneMatrices.reserve(100);
+	namespace Utils {
+
+		// Steps to walk forward from the cursor before falling back to a binary search
+		static constexpr uint32_t s_MaxCursorSteps = 4;
+
+		// Returns the key to interpolate from, times[key] <= time < times[key + 1] clamped to the track
+		static uint32_t FindKeyframe(const float* times, uint32_t count, uint32_t cursor, float time)
+		{
+			const uint32_t lastKey = count - 2;
+			cursor = Math::Min(cursor, lastKey);
+
+			if (time >= times[cursor])
+			{
+				for (uint32_t step = 0; step < s_MaxCursorSteps; step++)
+				{
+					if (cursor == lastKey || time < times[cursor + 1])
+						return cursor;
+
+					cursor++;
+				}
+			}
+
+			// Looped or jumped, search the whole track
+			const float* next = std::upper_bound(times + 1, times + count - 1, time);
+			return (uint32_t)(next - times) - 1;
+		}
 
-		for (int i = 0; i < 100; i++)
+		static float GetKeyframeFactor(const float* times, uint32_t key, float time)
 		{
-			m_FinalBoneMatrices.push_back(Math::mat4(1.0f));
+			const float length = times[key + 1] - times[key];
+			if (length <= 0.0f)
+				return 0.0f;
+
+			return Math::Clamp((time - times[key]) / length, 0.0f, 1.0f);
 		}
+
+	}
+
+	Animator::Animator(const SharedRef<Animation>& animation)
+		: m_CurrentAnimation(animation), m_CurrentTime(0.0f)
+	{
+		ResetPose();
 	}
 
-    void Animator::Stop()
-    {
+	void Animator::Stop()
+	{
 		m_IsPlaying = false;
-    }
+	}
 
-	void Animator::UpdateAnimation(float dt)
+	void Animator::UpdateAnimation(float dt, bool evaluatePose)
 	{
 		m_DeltaTime = dt;
 
@@ -29,7 +62,11 @@ namespace Vortex {
 		{
 			m_CurrentTime += m_CurrentAnimation->GetTicksPerSecond() * dt;
 			m_CurrentTime = fmod(m_CurrentTime, m_CurrentAnimation->GetDuration());
-			CalculateBoneTransform(&m_CurrentAnimation->GetRootNode(), Math::mat4(1.0f));
+
+			if (evaluatePose)
+			{
+				EvaluatePose();
+			}
 		}
 	}
 
@@ -44,34 +81,121 @@ namespace Vortex {
 		m_CurrentAnimation = animation;
 		m_CurrentTime = 0.0f;
 		m_IsPlaying = true;
+
+		ResetPose();
+	}
+
+	void Animator::ResetPose()
+	{
+		m_Cursors.clear();
+		m_LocalTransforms.clear();
+		m_GlobalTransforms.clear();
+		m_FinalBoneMatrices.clear();
+
+		if (!m_CurrentAnimation)
+			return;
+
+		const Skeleton& skeleton = m_CurrentAnimation->GetSkeleton();
+
+		m_Cursors.resize(m_CurrentAnimation->GetChannelCount());
+		m_LocalTransforms.assign(skeleton.GetBindTransforms(), skeleton.GetBindTransforms() + skeleton.GetNodeCount());
+		m_GlobalTransforms.resize(skeleton.GetNodeCount(), Math::Identity());
+		m_FinalBoneMatrices.resize(skeleton.GetBoneCount(), Math::Identity());
 	}
 
-	void Animator::CalculateBoneTransform(const AssimpNodeData* node, Math::mat4 parentTransform)
+	void Animator::EvaluatePose()
 	{
-		std::string nodeName = node->Name;
-		Math::mat4 nodeTransform = node->Transformation;
+		VX_PROFILE_FUNCTION();
 
-		Bone* bone = m_CurrentAnimation->FindBone(nodeName);
+		const Skeleton& skeleton = m_CurrentAnimation->GetSkeleton();
+		const uint32_t nodeCount = skeleton.GetNodeCount();
 
-		if (bone)
+		const int32_t* parentIndices = skeleton.GetParentIndices();
+		const uint32_t* nodeDepths = skeleton.GetNodeDepths();
+		const int32_t* channelIndices = skeleton.GetChannelIndices();
+		const int32_t* boneIndices = skeleton.GetBoneIndices();
+		const Math::mat4* offsetMatrices = skeleton.GetOffsetMatrices();
+
+		Math::mat4* localTransforms = m_LocalTransforms.data();
+		Math::mat4* globalTransforms = m_GlobalTransforms.data();
+		Math::mat4* finalBoneMatrices = m_FinalBoneMatrices.data();
+
+		// Parents are always stored first, so their global transform is ready by the time we reach a child
+		for (uint32_t node = 0; node < nodeCount; node++)
 		{
-			bone->Update(m_CurrentTime);
-			nodeTransform = bone->GetLocalTransform();
+			const int32_t channel = channelIndices[node];
+			if (channel != Skeleton::InvalidIndex && nodeDepths[node] <= m_MaxSampledDepth)
+			{
+				localTransforms[node] = SampleChannel((uint32_t)channel);
+			}
+
+			const int32_t parent = parentIndices[node];
+			globalTransforms[node] = parent != Skeleton::InvalidIndex ? globalTransforms[parent] * localTransforms[node] : localTransforms[node];
+
+			const int32_t bone = boneIndices[node];
+			if (bone == Skeleton::InvalidIndex)
+				continue;
+
+			finalBoneMatrices[bone] = globalTransforms[node] * offsetMatrices[node];
 		}
+	}
 
-		Math::mat4 globalTransformation = parentTransform * nodeTransform;
+	Math::mat4 Animator::SampleChannel(uint32_t channelIndex)
+	{
+		const AnimationChannel& channel = m_CurrentAnimation->GetChannels()[channelIndex];
+		KeyframeCursor& cursor = m_Cursors[channelIndex];
+		const float time = m_CurrentTime;
 
-		auto& boneInfoMap = m_CurrentAnimation->GetBoneIDMap();
-		auto it = boneInfoMap.find(nodeName);
-		if (it != boneInfoMap.end())
+		Math::vec3 position(0.0f);
+		if (channel.Positions.Count == 1)
+		{
+			position = m_CurrentAnimation->GetPositionKeys()[channel.Positions.Offset];
+		}
+		else if (channel.Positions.Count > 1)
 		{
-			int index = it->second.ID;
-			Math::mat4 offset = it->second.OffsetMatrix;
-			m_FinalBoneMatrices[index] = globalTransformation * offset;
+			const float* times = m_CurrentAnimation->GetPositionTimes() + channel.Positions.Offset;
+			const Math::vec3* keys = m_CurrentAnimation->GetPositionKeys() + channel.Positions.Offset;
+
+			cursor.Position = Utils::FindKeyframe(times, channel.Positions.Count, cursor.Position, time);
+			position = Math::Mix(keys[cursor.Position], keys[cursor.Position + 1], Utils::GetKeyframeFactor(times, cursor.Position, time));
 		}
 
-		for (int i = 0; i < node->ChildrenCount; i++)
-			CalculateBoneTransform(&node->Children[i], globalTransformation);
+		Math::quaternion rotation(1.0f, 0.0f, 0.0f, 0.0f);
+		if (channel.Rotations.Count == 1)
+		{
+			rotation = m_CurrentAnimation->GetRotationKeys()[channel.Rotations.Offset];
+		}
+		else if (channel.Rotations.Count > 1)
+		{
+			const float* times = m_CurrentAnimation->GetRotationTimes() + channel.Rotations.Offset;
+			const Math::quaternion* keys = m_CurrentAnimation->GetRotationKeys() + channel.Rotations.Offset;
+
+			cursor.Rotation = Utils::FindKeyframe(times, channel.Rotations.Count, cursor.Rotation, time);
+			rotation = Math::Normalize(Math::Slerp(keys[cursor.Rotation], keys[cursor.Rotation + 1], Utils::GetKeyframeFactor(times, cursor.Rotation, time)));
+		}
+
+		Math::vec3 scale(1.0f);
+		if (channel.Scales.Count == 1)
+		{
+			scale = m_CurrentAnimation->GetScaleKeys()[channel.Scales.Offset];
+		}
+		else if (channel.Scales.Count > 1)
+		{
+			const float* times = m_CurrentAnimation->GetScaleTimes() + channel.Scales.Offset;
+			const Math::vec3* keys = m_CurrentAnimation->GetScaleKeys() + channel.Scales.Offset;
+
+			cursor.Scale = Utils::FindKeyframe(times, channel.Scales.Count, cursor.Scale, time);
+			scale = Math::Mix(keys[cursor.Scale], keys[cursor.Scale + 1], Utils::GetKeyframeFactor(times, cursor.Scale, time));
+		}
+
+		// Same as translation * rotation * scale without the two matrix multiplies
+		Math::mat4 localTransform = Math::ToMat4(rotation);
+		localTransform[0] *= scale.x;
+		localTransform[1] *= scale.y;
+		localTransform[2] *= scale.z;
+		localTransform[3] = Math::vec4(position, 1.0f);
+
+		return localTransform;
 	}
 
 	SharedRef<Animator> Animator::Create(const SharedRef<Animation>& animation)
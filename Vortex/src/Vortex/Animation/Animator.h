@@ -4,10 +4,20 @@
 
 #include "Vortex/Math/Math.h"
 
+#include <vector>
+
 namespace Vortex {
 
 	class Animation;
-	struct AssimpNodeData;
+
+	// How often and how much of a skeleton gets evaluated, picked per frame by the scene
+	struct VORTEX_API AnimationLOD
+	{
+		static constexpr uint32_t AllNodes = std::numeric_limits<uint32_t>::max();
+
+		uint32_t UpdateInterval = 1;
+		uint32_t MaxSampledDepth = AllNodes;
+	};
 
 	class VORTEX_API Animator
 	{
@@ -16,11 +26,15 @@ namespace Vortex {
 		Animator(const SharedRef<Animation>& animation);
 		~Animator() = default;
 
-		void UpdateAnimation(float dt);
+		// Time always advances, skipping the pose evaluation lets culled or
+		// distant animators stay in sync without paying for sampling
+		void UpdateAnimation(float dt, bool evaluatePose = true);
 		void PlayAnimation();
 		void PlayAnimation(const SharedRef<Animation>& animation);
 		void Stop();
-		void CalculateBoneTransform(const AssimpNodeData* node, Math::mat4 parentTransform);
+
+		// Nodes deeper than this keep their last sampled local transform
+		void SetMaxSampledDepth(uint32_t depth) { m_MaxSampledDepth = depth; }
 
 		inline const std::vector<Math::mat4>& GetFinalBoneMatrices() const { return m_FinalBoneMatrices; }
 
@@ -29,10 +43,28 @@ namespace Vortex {
 		static SharedRef<Animator> Create(const SharedRef<Animation>& animation);
 
 	private:
+		void ResetPose();
+		void EvaluatePose();
+		Math::mat4 SampleChannel(uint32_t channelIndex);
+
+	private:
+		// Last keyframe used by each channel, playback usually only moves forward a key or two
+		struct KeyframeCursor
+		{
+			uint32_t Position = 0;
+			uint32_t Rotation = 0;
+			uint32_t Scale = 0;
+		};
+
 		std::vector<Math::mat4> m_FinalBoneMatrices;
+		std::vector<Math::mat4> m_LocalTransforms;
+		std::vector<Math::mat4> m_GlobalTransforms;
+		std::vector<KeyframeCursor> m_Cursors;
+
 		SharedRef<Animation> m_CurrentAnimation;
-		float m_CurrentTime;
-		float m_DeltaTime;
+		float m_CurrentTime = 0.0f;
+		float m_DeltaTime = 0.0f;
+		uint32_t m_MaxSampledDepth = AnimationLOD::AllNodes;
 		bool m_IsPlaying = false;
 	};
 
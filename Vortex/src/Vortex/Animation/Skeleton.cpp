@@ -0,0 +1,55 @@
+#include "vxpch.h"
+#include "Skeleton.h"
+
+namespace Vortex {
+
+	int32_t Skeleton::AddNode(const std::string& name, int32_t parentIndex, const Math::mat4& bindTransform)
+	{
+		const int32_t nodeIndex = (int32_t)m_ParentIndices.size();
+		VX_CORE_ASSERT(parentIndex < nodeIndex, "Parent nodes must be added before their children!");
+
+		m_ParentIndices.push_back(parentIndex);
+		m_NodeDepths.push_back(parentIndex != InvalidIndex ? m_NodeDepths[parentIndex] + 1 : 0);
+		m_ChannelIndices.push_back(InvalidIndex);
+		m_BoneIndices.push_back(InvalidIndex);
+		m_BindTransforms.push_back(bindTransform);
+		m_OffsetMatrices.push_back(Math::Identity());
+		m_NodeNames.push_back(name);
+
+		return nodeIndex;
+	}
+
+	void Skeleton::SetNodeChannel(int32_t nodeIndex, int32_t channelIndex)
+	{
+		VX_CORE_ASSERT(nodeIndex >= 0 && nodeIndex < (int32_t)GetNodeCount(), "Invalid node index!");
+
+		m_ChannelIndices[nodeIndex] = channelIndex;
+	}
+
+	void Skeleton::SetNodeBone(int32_t nodeIndex, int32_t boneIndex, const Math::mat4& offsetMatrix)
+	{
+		VX_CORE_ASSERT(nodeIndex >= 0 && nodeIndex < (int32_t)GetNodeCount(), "Invalid node index!");
+		VX_CORE_ASSERT(boneIndex >= 0, "Invalid bone index!");
+
+		m_BoneIndices[nodeIndex] = boneIndex;
+		m_OffsetMatrices[nodeIndex] = offsetMatrix;
+		m_BoneCount = Math::Max(m_BoneCount, (uint32_t)boneIndex + 1);
+	}
+
+	void Skeleton::SetBoneCount(uint32_t boneCount)
+	{
+		m_BoneCount = Math::Max(m_BoneCount, boneCount);
+	}
+
+	int32_t Skeleton::FindNode(const std::string& name) const
+	{
+		for (uint32_t i = 0; i < GetNodeCount(); i++)
+		{
+			if (m_NodeNames[i] == name)
+				return (int32_t)i;
+		}
+
+		return InvalidIndex;
+	}
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Math/Math.h"
+
+#include <string>
+#include <vector>
+
+namespace Vortex {
+
+	// Flattened node hierarchy compiled at import time, nodes are stored
+	// in topological order so a parent always comes before its children
+	class VORTEX_API Skeleton
+	{
+	public:
+		static constexpr int32_t InvalidIndex = -1;
+
+	public:
+		Skeleton() = default;
+		~Skeleton() = default;
+
+		// Returns the index of the new node, the parent must already be added
+		int32_t AddNode(const std::string& name, int32_t parentIndex, const Math::mat4& bindTransform);
+
+		void SetNodeChannel(int32_t nodeIndex, int32_t channelIndex);
+		void SetNodeBone(int32_t nodeIndex, int32_t boneIndex, const Math::mat4& offsetMatrix);
+
+		// Bone count can only grow, it must cover every bone referenced by the mesh
+		void SetBoneCount(uint32_t boneCount);
+
+		int32_t FindNode(const std::string& name) const;
+
+		VX_FORCE_INLINE uint32_t GetNodeCount() const { return (uint32_t)m_ParentIndices.size(); }
+		VX_FORCE_INLINE uint32_t GetBoneCount() const { return m_BoneCount; }
+
+		VX_FORCE_INLINE const int32_t* GetParentIndices() const { return m_ParentIndices.data(); }
+		VX_FORCE_INLINE const uint32_t* GetNodeDepths() const { return m_NodeDepths.data(); }
+		VX_FORCE_INLINE const int32_t* GetChannelIndices() const { return m_ChannelIndices.data(); }
+		VX_FORCE_INLINE const int32_t* GetBoneIndices() const { return m_BoneIndices.data(); }
+		VX_FORCE_INLINE const Math::mat4* GetBindTransforms() const { return m_BindTransforms.data(); }
+		VX_FORCE_INLINE const Math::mat4* GetOffsetMatrices() const { return m_OffsetMatrices.data(); }
+
+		VX_FORCE_INLINE const std::string& GetNodeName(uint32_t nodeIndex) const { return m_NodeNames[nodeIndex]; }
+
+	private:
+		std::vector<int32_t> m_ParentIndices;
+		std::vector<uint32_t> m_NodeDepths;
+		std::vector<int32_t> m_ChannelIndices;
+		std::vector<int32_t> m_BoneIndices;
+		std::vector<Math::mat4> m_BindTransforms;
+		std::vector<Math::mat4> m_OffsetMatrices;
+
+		// Only used while compiling and for debugging, never during playback
+		std::vector<std::string> m_NodeNames;
+
+		uint32_t m_BoneCount = 0;
+	};
+
+}
@@ -54,4 +54,58 @@ namespace Vortex {
 		return s_Serializers[metadata.Type]->TryLoadData(metadata, asset);
 	}
 
+	bool AssetImporter::CanLoadFromMemory(AssetType type)
+	{
+		if (!s_Serializers.contains(type))
+		{
+			return false;
+		}
+
+		return s_Serializers[type]->CanLoadFromMemory();
+	}
+
+	bool AssetImporter::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		if (!CanLoadFromMemory(metadata.Type))
+		{
+			VX_CONSOLE_LOG_WARN("Assets of type {} can't be loaded from memory", Utils::StringFromAssetType(metadata.Type));
+			return false;
+		}
+
+		return s_Serializers[metadata.Type]->TryLoadDataFromMemory(metadata, payload, asset);
+	}
+
+	Buffer AssetImporter::BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath)
+	{
+		if (!CanLoadFromMemory(metadata.Type))
+		{
+			return Buffer();
+		}
+
+		return s_Serializers[metadata.Type]->BuildPackPayload(metadata, sourceFilepath);
+	}
+
+	bool AssetImporter::HasYAMLPayload(AssetType type)
+	{
+		if (!CanLoadFromMemory(type))
+		{
+			return false;
+		}
+
+		return s_Serializers[type]->HasYAMLPayload();
+	}
+
+	AssetLoadFinalizeFn AssetImporter::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		// Lookup only, the map must not be modified while workers are reading it
+		auto it = s_Serializers.find(metadata.Type);
+		if (it == s_Serializers.end())
+		{
+			VX_CONSOLE_LOG_WARN("There are currently no importers for assets of type {}", Utils::StringFromAssetType(metadata.Type));
+			return nullptr;
+		}
+
+		return it->second->PrepareLoadData(metadata, payload);
+	}
+
 }
@@ -16,6 +16,15 @@ namespace Vortex {
 		static void Serialize(const SharedReference<Asset>& asset);
 		static bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset);
 
+		// Whether assets of this type can be stored inline in an asset pack
+		static bool CanLoadFromMemory(AssetType type);
+		static bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset);
+		static Buffer BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath);
+		static bool HasYAMLPayload(AssetType type);
+
+		// CPU half of an async load, called from job workers
+		static AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload);
+
 	private:
 		inline static std::unordered_map<AssetType, UniqueRef<AssetSerializer>> s_Serializers;
 	};
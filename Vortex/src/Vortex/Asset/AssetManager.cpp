@@ -1,6 +1,10 @@
 #include "vxpch.h"
 #include "AssetManager.h"
 
+#include "Vortex/Editor/DefaultMesh.h"
+
+#include "Vortex/Renderer/Renderer.h"
+
 namespace Vortex {
 
 	bool AssetManager::IsHandleValid(AssetHandle handle)
@@ -33,4 +37,38 @@ namespace Vortex {
 		return Project::GetAssetManager()->GetMemoryOnlyAssets();
 	}
 
+	void AssetManager::PrefetchAssets(const std::vector<AssetHandle>& handles)
+	{
+		Project::GetAssetManager()->PrefetchAssets(handles);
+	}
+
+	AssetLoadState AssetManager::GetAssetLoadState(AssetHandle handle)
+	{
+		return Project::GetAssetManager()->GetAssetLoadState(handle);
+	}
+
+	AsyncAssetLoadStatistics AssetManager::GetAsyncLoadStatistics()
+	{
+		return Project::GetAssetManager()->GetAsyncLoadStatistics();
+	}
+
+	SharedReference<Asset> AssetManager::GetPlaceholderAsset(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::TextureAsset:
+				return Renderer::GetWhiteTexture();
+			case AssetType::StaticMeshAsset:
+			{
+				if (DefaultMesh::DefaultStaticMeshes.empty())
+					return nullptr;
+
+				const AssetHandle cubeHandle = DefaultMesh::DefaultStaticMeshes[(size_t)DefaultMesh::StaticMeshType::Cube];
+				return Project::GetAssetManager()->GetAsset(cubeHandle);
+			}
+		}
+
+		return nullptr;
+	}
+
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Vortex/Asset/Asset.h"
+#include "Vortex/Asset/AsyncAssetLoader.h"
 
 #include "Vortex/Project/Project.h"
 
@@ -8,6 +9,7 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Vortex {
 
@@ -22,6 +24,13 @@ namespace Vortex {
 		static const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetLoadedAssets();
 		static const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetMemoryOnlyAssets();
 
+		static void PrefetchAssets(const std::vector<AssetHandle>& handles);
+		static AssetLoadState GetAssetLoadState(AssetHandle handle);
+		static AsyncAssetLoadStatistics GetAsyncLoadStatistics();
+
+		// Served by GetAssetAsync until the real asset is ready, nullptr for types without one
+		static SharedReference<Asset> GetPlaceholderAsset(AssetType type);
+
 		template <typename TAsset>
 		VX_FORCE_INLINE static SharedReference<TAsset> GetAsset(AssetHandle handle)
 		{
@@ -32,6 +41,22 @@ namespace Vortex {
 			return asset.As<TAsset>();
 		}
 
+		// Never blocks, the asset is loaded in the background and a placeholder is returned until it's ready
+		template <typename TAsset>
+		VX_FORCE_INLINE static SharedReference<TAsset> GetAssetAsync(AssetHandle handle)
+		{
+			static_assert(std::is_base_of<Asset, TAsset>::value, "GetAssetAsync only works with types derived from Asset!");
+
+			SharedReference<Asset> asset = Project::GetAssetManager()->GetAssetAsync(handle);
+
+			if (!asset)
+			{
+				asset = GetPlaceholderAsset(TAsset::GetStaticType());
+			}
+
+			return asset.As<TAsset>();
+		}
+
 		template <typename TAsset>
 		VX_FORCE_INLINE static std::unordered_set<AssetHandle> GetAllAssetsWithType()
 		{
@@ -1,9 +1,11 @@
 #include "vxpch.h"
 #include "EditorAssetManager.h"
 
+#include "Vortex/Core/Application.h"
 #include "Vortex/Core/String.h"
 
 #include "Vortex/Asset/AssetExtensions.h"
+#include "Vortex/Asset/AssetPack.h"
 
 #include "Vortex/Project/Project.h"
 
@@ -12,6 +14,9 @@
 #include "Vortex/Renderer/Material.h"
 #include "Vortex/Renderer/ParticleSystem/ParticleEmitter.h"
 
+#include "Vortex/Serialization/StreamWriter.h"
+#include "Vortex/Serialization/StreamReader.h"
+
 #include "Vortex/Utils/YAML_SerializationUtils.h"
 
 #include <yaml-cpp/yaml.h>
@@ -20,15 +25,40 @@ namespace Vortex {
 
 	static AssetMetadata s_NullMetadata;
 
+	struct AssetRegistryCacheHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint32_t EntryCount = 0;
+		uint32_t Reserved = 0;
+		uint64_t SourceSize = 0;
+		uint64_t SourceWriteTime = 0;
+	};
+
+	namespace Utils {
+
+		static constexpr uint32_t s_RegistryCacheMagic = 0x52415856; // VXAR
+		static constexpr uint32_t s_RegistryCacheVersion = 1;
+
+	}
+
 	EditorAssetManager::EditorAssetManager()
-		: m_ProjectAssetDirectory(Project::GetAssetDirectory()), m_ProjectAssetRegistryPath(Project::GetAssetRegistryPath())
+		: m_ProjectAssetDirectory(Project::GetAssetDirectory()), m_ProjectAssetRegistryPath(Project::GetAssetRegistryPath()),
+		  m_ProjectAssetRegistryCachePath(Project::GetCacheDirectory() / "AssetRegistry.vxreg")
 	{
 		AssetImporter::Init();
+
+		m_AsyncLoader = SharedReference<AsyncAssetLoader>::Create([this](AssetHandle handle, SharedReference<Asset> asset)
+		{
+			OnAsyncLoadComplete(handle, asset);
+		});
 	}
 
 	EditorAssetManager::~EditorAssetManager()
 	{
-		WriteToRegistryFile();
+		m_AsyncLoader->Shutdown();
+
+		FlushRegistry();
 	}
 
     const AssetMetadata& EditorAssetManager::ImportLoadedAsset(SharedReference<Asset> asset, const std::string& directory, const std::string& filename)
@@ -48,7 +78,7 @@ namespace Vortex {
 
 		m_AssetRegistry[metadata.Handle] = metadata;
 
-		WriteToRegistryFile();
+		MarkRegistryDirty();
 
 		asset->Handle = metadata.Handle;
 		m_LoadedAssets[metadata.Handle] = asset;
@@ -80,11 +110,19 @@ namespace Vortex {
 		if (m_AssetRegistry.Contains(handle))
 		{
 			m_AssetRegistry.Remove(handle);
+			MarkRegistryDirty();
 		}
 
 		return true;
 	}
 
+	bool EditorAssetManager::BuildAssetPack(const Fs::Path& outputFilepath)
+	{
+		VX_PROFILE_FUNCTION();
+
+		return AssetPack::Build(outputFilepath, m_AssetRegistry, m_ProjectAssetDirectory);
+	}
+
 	bool EditorAssetManager::OnProjectSerialized()
 	{
 		WriteToRegistryFile();
@@ -92,6 +130,30 @@ namespace Vortex {
 		return true;
 	}
 
+	void EditorAssetManager::MarkRegistryDirty()
+	{
+		m_IsRegistryDirty = true;
+
+		if (m_IsRegistryFlushQueued)
+			return;
+
+		m_IsRegistryFlushQueued = true;
+
+		// Keeps the asset manager alive until the flush, even if the project is closed this frame
+		SharedReference<EditorAssetManager> assetManager = this;
+		Application::Get().GetPostUpdateFunctionQueue().queue([assetManager]() { assetManager->FlushRegistry(); });
+	}
+
+	void EditorAssetManager::FlushRegistry()
+	{
+		m_IsRegistryFlushQueued = false;
+
+		if (!m_IsRegistryDirty)
+			return;
+
+		WriteToRegistryFile();
+	}
+
 	bool EditorAssetManager::OnProjectDeserialized()
 	{
 		LoadAssetRegistry();
@@ -172,6 +234,8 @@ namespace Vortex {
 			return false;
 		}
 
+		m_AsyncLoader->ResetLoadState(assetHandle);
+
 		SharedReference<Asset> asset = nullptr;
 		metadata.IsDataLoaded = AssetImporter::TryLoadData(metadata, asset);
 		if (metadata.IsDataLoaded)
@@ -207,6 +271,60 @@ namespace Vortex {
 		return m_MemoryOnlyAssets;
 	}
 
+	SharedReference<Asset> EditorAssetManager::GetAssetAsync(AssetHandle handle)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (IsMemoryOnlyAsset(handle))
+		{
+			return m_MemoryOnlyAssets[handle];
+		}
+
+		const AssetMetadata& metadata = GetMetadataInternal(handle);
+		if (!metadata.IsValid())
+		{
+			return nullptr;
+		}
+
+		if (metadata.IsDataLoaded)
+		{
+			return m_LoadedAssets[handle];
+		}
+
+		// Failed loads stay failed until the asset is reloaded
+		if (m_AsyncLoader->GetLoadState(handle) == AssetLoadState::None)
+		{
+			m_AsyncLoader->Load(metadata);
+		}
+
+		return nullptr;
+	}
+
+	void EditorAssetManager::PrefetchAssets(const std::vector<AssetHandle>& handles)
+	{
+		VX_PROFILE_FUNCTION();
+
+		for (const AssetHandle handle : handles)
+		{
+			GetAssetAsync(handle);
+		}
+	}
+
+	AssetLoadState EditorAssetManager::GetAssetLoadState(AssetHandle handle)
+	{
+		if (IsMemoryOnlyAsset(handle) || IsAssetLoaded(handle))
+		{
+			return AssetLoadState::Ready;
+		}
+
+		return m_AsyncLoader->GetLoadState(handle);
+	}
+
+	AsyncAssetLoadStatistics EditorAssetManager::GetAsyncLoadStatistics() const
+	{
+		return m_AsyncLoader->GetStatistics();
+	}
+
 	const AssetRegistry& EditorAssetManager::GetAssetRegistry() const
 	{
 		return m_AssetRegistry;
@@ -372,6 +490,8 @@ namespace Vortex {
 		
 		m_AssetRegistry[metadata.Handle] = metadata;
 
+		MarkRegistryDirty();
+
 		return metadata.Handle;
 	}
 
@@ -431,6 +551,8 @@ namespace Vortex {
 
 	void EditorAssetManager::LoadAssetRegistry()
 	{
+		VX_PROFILE_FUNCTION();
+
 		//VX_CONSOLE_LOG_INFO("[Asset Manager] Loading Asset Registry");
 
 		if (!FileSystem::Exists(m_ProjectAssetRegistryPath))
@@ -438,11 +560,92 @@ namespace Vortex {
 			return;
 		}
 
+		std::vector<AssetMetadata> entries;
+
+		// The binary copy is only trusted while the registry file is exactly the one it was written from,
+		// its entries already passed validation but files can still have been moved or deleted since
+		if (ReadRegistryCache(entries))
+		{
+			m_AssetRegistry.Reserve(entries.size());
+
+			bool registryChanged = false;
+
+			for (AssetMetadata& metadata : entries)
+			{
+				if (FileSystem::Exists(GetFileSystemPath(metadata)))
+				{
+					m_AssetRegistry[metadata.Handle] = metadata;
+					continue;
+				}
+
+				// Missing files go through the full validation, which tries to relocate them
+				registryChanged |= AddRegistryEntry(metadata);
+			}
+
+			VX_CONSOLE_LOG_INFO("[Asset Manager] Loaded {} asset entries from cache", m_AssetRegistry.Count());
+
+			if (registryChanged)
+			{
+				MarkRegistryDirty();
+			}
+
+			return;
+		}
+
+		if (!ReadRegistryFile(entries))
+		{
+			return;
+		}
+
+		m_AssetRegistry.Reserve(entries.size());
+
+		bool registryChanged = false;
+
+		for (AssetMetadata& metadata : entries)
+		{
+			if (metadata.Handle == 0)
+			{
+				VX_CONSOLE_LOG_WARN("[Asset Manager] AssetHandle for '{}' is 0, this shouldn't happen", metadata.Filepath);
+				continue;
+			}
+
+			registryChanged |= AddRegistryEntry(metadata);
+		}
+
+		VX_CONSOLE_LOG_INFO("[Asset Manager] Loaded {} asset entries", m_AssetRegistry.Count());
+
+		// Relocated entries are written back, which refreshes the binary copy too
+		if (registryChanged)
+		{
+			MarkRegistryDirty();
+		}
+		else
+		{
+			// Built from the registry rather than the file so skipped entries never reach the cache
+			std::map<AssetHandle, AssetMetadata> sortedEntries;
+
+			for (const auto& [handle, metadata] : m_AssetRegistry)
+			{
+				if (metadata.IsMemoryOnly)
+					continue;
+
+				sortedEntries[handle] = metadata;
+			}
+
+			WriteRegistryCache(sortedEntries);
+		}
+	}
+
+	bool EditorAssetManager::ReadRegistryFile(std::vector<AssetMetadata>& outEntries)
+	{
+		VX_PROFILE_FUNCTION();
+
 		std::ifstream stream(m_ProjectAssetRegistryPath);
 		if (!stream.is_open())
 		{
 			const std::string assetRegistryPath = m_ProjectAssetRegistryPath.string();
 			VX_CONSOLE_LOG_ERROR("[Asset Manager] Failed to open Asset Registry File /'{}'", assetRegistryPath);
+			return false;
 		}
 
 		std::stringstream ss;
@@ -454,95 +657,161 @@ namespace Vortex {
 		if (!assetHandles)
 		{
 			VX_CONSOLE_LOG_ERROR("[Asset Manager] Asset Registry was corrupted!");
-			return;
+			return false;
 		}
 
+		outEntries.reserve(assetHandles.size());
+
 		for (auto entry : assetHandles)
 		{
-			const std::string filepath = entry["Filepath"].as<std::string>();
-			const AssetHandle handle = entry["Handle"].as<uint64_t>();
-			AssetType type = Utils::AssetTypeFromString(entry["Type"].as<std::string>());
+			AssetMetadata metadata;
+			metadata.Filepath = entry["Filepath"].as<std::string>();
+			metadata.Handle = entry["Handle"].as<uint64_t>();
+			metadata.Type = Utils::AssetTypeFromString(entry["Type"].as<std::string>());
 
-			if (type == AssetType::None)
-				continue;
+			outEntries.push_back(metadata);
+		}
+
+		return true;
+	}
+
+	bool EditorAssetManager::ReadRegistryCache(std::vector<AssetMetadata>& outEntries)
+	{
+		VX_PROFILE_FUNCTION();
 
-			if (type != GetAssetTypeFromFilepath(filepath))
+		if (!FileSystem::Exists(m_ProjectAssetRegistryCachePath))
+		{
+			return false;
+		}
+
+		Buffer buffer = FileSystem::ReadBinary(m_ProjectAssetRegistryCachePath);
+		if (!buffer)
+		{
+			return false;
+		}
+
+		StreamReader reader(buffer);
+
+		AssetRegistryCacheHeader header;
+		reader.ReadRaw(header);
+
+		const bool valid = reader
+			&& header.Magic == Utils::s_RegistryCacheMagic
+			&& header.Version == Utils::s_RegistryCacheVersion
+			&& header.SourceSize == FileSystem::GetFileSize(m_ProjectAssetRegistryPath)
+			&& header.SourceWriteTime == FileSystem::GetLastWriteTime(m_ProjectAssetRegistryPath)
+			&& header.EntryCount <= reader.GetRemaining() / (sizeof(uint64_t) + sizeof(uint32_t) * 2);
+
+		if (valid)
+		{
+			outEntries.resize(header.EntryCount);
+
+			for (AssetMetadata& metadata : outEntries)
 			{
-				VX_CONSOLE_LOG_ERROR("[Asset Manager] Mismatch between AssetType and extension type while reading asset registry entry!");
-				type = GetAssetTypeFromFilepath(filepath);
+				uint64_t handle = 0;
+				uint32_t type = 0;
+				std::string filepath;
+
+				reader.ReadRaw(handle);
+				reader.ReadRaw(type);
+				reader.ReadString(filepath);
+
+				metadata.Handle = handle;
+				metadata.Type = (AssetType)type;
+				metadata.Filepath = filepath;
 			}
+		}
 
-			AssetMetadata metadata;
-			metadata.Filepath = filepath;
-			metadata.Handle = handle;
-			metadata.Type = type;
+		buffer.Release();
 
-			if (!FileSystem::Exists(GetFileSystemPath(metadata)))
-			{
-				VX_CONSOLE_LOG_INFO("[Asset Manager] Missing Asset '{}' detected in registry file, trying to locate...", metadata.Filepath);
+		if (!valid || !reader)
+		{
+			outEntries.clear();
+			return false;
+		}
+
+		return true;
+	}
 
-				std::string mostLikelyCandidate;
-				uint32_t bestScore = 0;
+	bool EditorAssetManager::AddRegistryEntry(AssetMetadata& metadata)
+	{
+		bool changed = false;
 
-				for (const auto& pathEntry : std::filesystem::recursive_directory_iterator(m_ProjectAssetDirectory))
-				{
-					const Fs::Path& path = pathEntry.path();
+		if (metadata.Type == AssetType::None)
+			return false;
 
-					if (path.filename() != metadata.Filepath.filename())
-					{
-						continue;
-					}
+		const std::string originalFilepath = metadata.Filepath.string();
+		const AssetType typeFromExtension = GetAssetTypeFromFilepath(metadata.Filepath);
 
-					if (bestScore > 0)
-					{
-						VX_CONSOLE_LOG_WARN("[Asset Manager] Multiple candidates found...");
-					}
+		if (metadata.Type != typeFromExtension)
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Manager] Mismatch between AssetType and extension type while reading asset registry entry!");
+			metadata.Type = typeFromExtension;
+			changed = true;
+		}
 
-					std::vector<std::string> candidateParts = String::SplitString(path.string(), "/\\");
+		if (!FileSystem::Exists(GetFileSystemPath(metadata)))
+		{
+			VX_CONSOLE_LOG_INFO("[Asset Manager] Missing Asset '{}' detected in registry file, trying to locate...", metadata.Filepath);
 
-					uint32_t score = 0;
+			std::string mostLikelyCandidate;
+			uint32_t bestScore = 0;
 
-					for (const auto& part : candidateParts)
-					{
-						if (filepath.find(part) != std::string::npos)
-							score++;
-					}
+			for (const auto& pathEntry : std::filesystem::recursive_directory_iterator(m_ProjectAssetDirectory))
+			{
+				const Fs::Path& path = pathEntry.path();
+
+				if (path.filename() != metadata.Filepath.filename())
+				{
+					continue;
+				}
 
-					VX_CONSOLE_LOG_WARN("[Asset Manager] '{}' has a score of {}, best score is {}", path.string(), score, bestScore);
+				if (bestScore > 0)
+				{
+					VX_CONSOLE_LOG_WARN("[Asset Manager] Multiple candidates found...");
+				}
 
-					if (bestScore > 0 && score == bestScore)
-					{
-						// TODO promp the user at this point
-					}
+				std::vector<std::string> candidateParts = String::SplitString(path.string(), "/\\");
 
-					if (score <= bestScore)
-						continue;
+				uint32_t score = 0;
 
-					bestScore = score;
-					mostLikelyCandidate = path.string();
+				for (const auto& part : candidateParts)
+				{
+					if (originalFilepath.find(part) != std::string::npos)
+						score++;
 				}
 
-				if (mostLikelyCandidate.empty() && bestScore == 0)
+				VX_CONSOLE_LOG_WARN("[Asset Manager] '{}' has a score of {}, best score is {}", path.string(), score, bestScore);
+
+				if (bestScore > 0 && score == bestScore)
 				{
-					VX_CONSOLE_LOG_ERROR("[Asset Manager] Failed to locate a potential match for '{}'", metadata.Filepath);
-					continue;
+					// TODO promp the user at this point
 				}
 
-				std::replace(mostLikelyCandidate.begin(), mostLikelyCandidate.end(), '\\', '/');
-				metadata.Filepath = FileSystem::Relative(mostLikelyCandidate, m_ProjectAssetDirectory);
-				VX_CONSOLE_LOG_WARN("[Asset Manager] Found most likely match '{}'", metadata.Filepath);
+				if (score <= bestScore)
+					continue;
+
+				bestScore = score;
+				mostLikelyCandidate = path.string();
 			}
 
-			if (metadata.Handle == 0)
+			if (mostLikelyCandidate.empty() && bestScore == 0)
 			{
-				VX_CONSOLE_LOG_WARN("[Asset Manager] AssetHandle for '{}' is 0, this shouldn't happen", metadata.Filepath);
-				continue;
+				VX_CONSOLE_LOG_ERROR("[Asset Manager] Failed to locate a potential match for '{}'", metadata.Filepath);
+				// The entry is dropped, the rewritten registry won't contain it anymore
+				return true;
 			}
 
-			m_AssetRegistry[metadata.Handle] = metadata;
+			std::replace(mostLikelyCandidate.begin(), mostLikelyCandidate.end(), '\\', '/');
+			metadata.Filepath = FileSystem::Relative(mostLikelyCandidate, m_ProjectAssetDirectory);
+			VX_CONSOLE_LOG_WARN("[Asset Manager] Found most likely match '{}'", metadata.Filepath);
+
+			changed = true;
 		}
 
-		VX_CONSOLE_LOG_INFO("[Asset Manager] Loaded {} asset entries", m_AssetRegistry.Count());
+		m_AssetRegistry[metadata.Handle] = metadata;
+
+		return changed;
 	}
 
 	void EditorAssetManager::ProcessDirectory(const Fs::Path& directory)
@@ -569,19 +838,17 @@ namespace Vortex {
 
 	void EditorAssetManager::ReloadAssets()
 	{
+		// Newly found assets mark the registry dirty
 		ProcessDirectory(m_ProjectAssetDirectory);
-		WriteToRegistryFile();
 	}
 
 	void EditorAssetManager::WriteToRegistryFile()
 	{
-		struct AssetRegistryEntry
-		{
-			std::string Filepath = "";
-			AssetType Type = AssetType::None;
-		};
+		VX_PROFILE_FUNCTION();
+
+		m_IsRegistryDirty = false;
 
-		std::map<UUID, AssetRegistryEntry> sortedMap;
+		std::map<AssetHandle, AssetMetadata> sortedMap;
 
 		for (const auto& [handle, metadata] : m_AssetRegistry)
 		{
@@ -595,7 +862,10 @@ namespace Vortex {
 
 			// WINDOWS ONLY
 			std::replace(filepathToSerialize.begin(), filepathToSerialize.end(), '\\', '/');
-			sortedMap[metadata.Handle] = AssetRegistryEntry{ filepathToSerialize, metadata.Type };
+			AssetMetadata& entry = sortedMap[metadata.Handle];
+			entry.Handle = metadata.Handle;
+			entry.Filepath = filepathToSerialize;
+			entry.Type = metadata.Type;
 		}
 
 		VX_CORE_INFO("[Asset Manager] serializing asset registry with {} entries", m_AssetRegistry.Count());
@@ -610,7 +880,7 @@ namespace Vortex {
 			out << YAML::BeginMap;
 
 			VX_SERIALIZE_PROPERTY(Handle, handle, out);
-			VX_SERIALIZE_PROPERTY(Filepath, entry.Filepath, out);
+			VX_SERIALIZE_PROPERTY(Filepath, entry.Filepath.string(), out);
 			VX_SERIALIZE_PROPERTY(Type, Utils::StringFromAssetType(entry.Type), out);
 			
 			out << YAML::EndMap;
@@ -619,11 +889,43 @@ namespace Vortex {
 		out << YAML::EndSeq;
 		out << YAML::EndMap;
 
-		std::ofstream fout(m_ProjectAssetRegistryPath);
+		{
+			std::ofstream fout(m_ProjectAssetRegistryPath);
 
-		VX_CORE_ASSERT(fout.is_open(), "Failed to open asset registry file!");
+			VX_CORE_ASSERT(fout.is_open(), "Failed to open asset registry file!");
 
-		fout << out.c_str();
+			fout << out.c_str();
+		}
+
+		// Written after the registry file is closed, it records the final size and write time
+		WriteRegistryCache(sortedMap);
+	}
+
+	void EditorAssetManager::WriteRegistryCache(const std::map<AssetHandle, AssetMetadata>& sortedEntries)
+	{
+		VX_PROFILE_FUNCTION();
+
+		AssetRegistryCacheHeader header;
+		header.Magic = Utils::s_RegistryCacheMagic;
+		header.Version = Utils::s_RegistryCacheVersion;
+		header.EntryCount = (uint32_t)sortedEntries.size();
+		header.SourceSize = FileSystem::GetFileSize(m_ProjectAssetRegistryPath);
+		header.SourceWriteTime = FileSystem::GetLastWriteTime(m_ProjectAssetRegistryPath);
+
+		StreamWriter writer;
+		writer.WriteRaw(header);
+
+		for (const auto& [handle, metadata] : sortedEntries)
+		{
+			writer.WriteRaw<uint64_t>(handle);
+			writer.WriteRaw<uint32_t>((uint32_t)metadata.Type);
+			writer.WriteString(metadata.Filepath.generic_string());
+		}
+
+		if (!writer.WriteToFile(m_ProjectAssetRegistryCachePath))
+		{
+			VX_CORE_ERROR("[Asset Manager] Failed to write asset registry cache to {}", m_ProjectAssetRegistryCachePath.string());
+		}
 	}
 
 	AssetMetadata& EditorAssetManager::GetMetadataInternal(AssetHandle handle)
@@ -636,4 +938,22 @@ namespace Vortex {
 		return s_NullMetadata;
 	}
 
+	void EditorAssetManager::OnAsyncLoadComplete(AssetHandle handle, SharedReference<Asset> asset)
+	{
+		if (!asset)
+		{
+			return;
+		}
+
+		// The asset may have been removed, or loaded synchronously by a GetAsset call in the meantime
+		AssetMetadata& metadata = GetMetadataInternal(handle);
+		if (!metadata.IsValid() || metadata.IsDataLoaded)
+		{
+			return;
+		}
+
+		metadata.IsDataLoaded = true;
+		m_LoadedAssets[handle] = asset;
+	}
+
 }
@@ -9,6 +9,9 @@
 
 #include "Vortex/Utils/FileSystem.h"
 
+#include <vector>
+#include <map>
+
 namespace Vortex {
 
 	class AssetRegistryPanel;
@@ -31,12 +34,17 @@ namespace Vortex {
 		const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetLoadedAssets() const override;
 		const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetMemoryOnlyAssets() const override;
 
+		SharedReference<Asset> GetAssetAsync(AssetHandle handle) override;
+		void PrefetchAssets(const std::vector<AssetHandle>& handles) override;
+		AssetLoadState GetAssetLoadState(AssetHandle handle) override;
+		AsyncAssetLoadStatistics GetAsyncLoadStatistics() const override;
+
 		const AssetRegistry& GetAssetRegistry() const;
 
 		Fs::Path GetRelativePath(const Fs::Path& filepath);
 
 		SharedReference<Asset> GetAssetFromFilepath(const Fs::Path& filepath);
-		AssetHandle GetAssetHandleFromFilepath(const Fs::Path& filepath);
+		AssetHandle GetAssetHandleFromFilepath(const Fs::Path& filepath) override;
 		AssetType GetAssetTypeFromExtension(const std::string& extension);
 		std::string GetExtensionFromAssetType(AssetType type);
 		AssetType GetAssetTypeFromFilepath(const Fs::Path& filepath);
@@ -73,7 +81,7 @@ namespace Vortex {
 
 			m_AssetRegistry[metadata.Handle] = metadata;
 
-			WriteToRegistryFile();
+			MarkRegistryDirty();
 
 			SharedReference<TAsset> asset = SharedReference<TAsset>::Create(std::forward<Args>(args)...);
 			asset->Handle = metadata.Handle;
@@ -89,25 +97,45 @@ namespace Vortex {
 
 		bool RemoveAsset(AssetHandle handle);
 
+		// Packs the registry into the .vxpak that shipped builds load through the RuntimeAssetManager
+		bool BuildAssetPack(const Fs::Path& outputFilepath);
+
 		bool OnProjectSerialized();
 		bool OnProjectDeserialized();
 
+		// Registry changes are written once at the end of the frame, no matter how many assets changed
+		void MarkRegistryDirty();
+		void FlushRegistry();
+		VX_FORCE_INLINE bool IsRegistryDirty() const { return m_IsRegistryDirty; }
+
 	private:
 		void LoadAssetRegistry();
+		bool ReadRegistryFile(std::vector<AssetMetadata>& outEntries);
+		bool ReadRegistryCache(std::vector<AssetMetadata>& outEntries);
+		bool AddRegistryEntry(AssetMetadata& metadata);
 		void ProcessDirectory(const Fs::Path& directory);
 		void ReloadAssets();
 		void WriteToRegistryFile();
+		void WriteRegistryCache(const std::map<AssetHandle, AssetMetadata>& sortedEntries);
 
 		AssetMetadata& GetMetadataInternal(AssetHandle handle);
 
+		void OnAsyncLoadComplete(AssetHandle handle, SharedReference<Asset> asset);
+
 	private:
 		std::unordered_map<AssetHandle, SharedReference<Asset>> m_LoadedAssets;
 		std::unordered_map<AssetHandle, SharedReference<Asset>> m_MemoryOnlyAssets;
 
 		AssetRegistry m_AssetRegistry;
 
+		SharedReference<AsyncAssetLoader> m_AsyncLoader = nullptr;
+
 		Fs::Path m_ProjectAssetDirectory;
 		Fs::Path m_ProjectAssetRegistryPath;
+		Fs::Path m_ProjectAssetRegistryCachePath;
+
+		bool m_IsRegistryDirty = false;
+		bool m_IsRegistryFlushQueued = false;
 
 	private:
 		friend AssetRegistryPanel;
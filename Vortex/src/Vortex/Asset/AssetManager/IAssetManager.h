@@ -4,11 +4,15 @@
 
 #include "Vortex/Asset/Asset.h"
 #include "Vortex/Asset/AssetTypes.h"
+#include "Vortex/Asset/AsyncAssetLoader.h"
 
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
+#include "Vortex/Utils/FileSystem.h"
+
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Vortex {
 
@@ -25,6 +29,13 @@ namespace Vortex {
 		virtual bool IsHandleValid(AssetHandle handle) = 0;
 		virtual bool IsMemoryOnlyAsset(AssetHandle handle) = 0;
 		virtual bool IsAssetLoaded(AssetHandle handle) = 0;
+		virtual AssetHandle GetAssetHandleFromFilepath(const Fs::Path& filepath) = 0;
+
+		// Returns the asset if it's resident, otherwise starts loading it on the job system and returns nullptr
+		virtual SharedReference<Asset> GetAssetAsync(AssetHandle handle) = 0;
+		virtual void PrefetchAssets(const std::vector<AssetHandle>& handles) = 0;
+		virtual AssetLoadState GetAssetLoadState(AssetHandle handle) = 0;
+		virtual AsyncAssetLoadStatistics GetAsyncLoadStatistics() const = 0;
 
 		virtual std::unordered_set<AssetHandle> GetAllAssetsWithType(AssetType type) const = 0;
 		virtual const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetLoadedAssets() const = 0;
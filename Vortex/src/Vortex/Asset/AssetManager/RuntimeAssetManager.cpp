@@ -1,63 +1,351 @@
 #include "vxpch.h"
 #include "RuntimeAssetManager.h"
 
+#include "Vortex/Asset/AssetImporter.h"
+
+#include "Vortex/Editor/DefaultMesh.h"
+
+#include "Vortex/Project/Project.h"
+
 namespace Vortex {
 
 	RuntimeAssetManager::RuntimeAssetManager()
 	{
+		AssetImporter::Init();
+
+		m_AsyncLoader = SharedReference<AsyncAssetLoader>::Create([this](AssetHandle handle, SharedReference<Asset> asset)
+		{
+			OnAsyncLoadComplete(handle, asset);
+		});
 	}
 
 	RuntimeAssetManager::~RuntimeAssetManager()
 	{
+		// Workers may still be reading payloads out of the mapped pack
+		m_AsyncLoader->Shutdown();
 	}
 
 	AssetType RuntimeAssetManager::GetAssetType(AssetHandle handle) const
 	{
+		if (auto it = m_MemoryOnlyAssets.find(handle); it != m_MemoryOnlyAssets.end())
+		{
+			return it->second->GetAssetType();
+		}
+
+		if (const AssetPackEntry* entry = m_AssetPack ? m_AssetPack->FindEntry(handle) : nullptr)
+		{
+			return entry->Type;
+		}
+
+		VX_CORE_ASSERT(false, "Unknown Asset Type!");
 		return AssetType::None;
 	}
 
 	SharedReference<Asset> RuntimeAssetManager::GetAsset(AssetHandle handle)
 	{
-		return SharedReference<Asset>();
+		VX_PROFILE_FUNCTION();
+
+		if (auto it = m_MemoryOnlyAssets.find(handle); it != m_MemoryOnlyAssets.end())
+		{
+			return it->second;
+		}
+
+		if (auto it = m_LoadedAssets.find(handle); it != m_LoadedAssets.end())
+		{
+			return it->second;
+		}
+
+		if (!m_AssetPack)
+		{
+			return nullptr;
+		}
+
+		const AssetPackEntry* entry = m_AssetPack->FindEntry(handle);
+		if (!entry)
+		{
+			return nullptr;
+		}
+
+		return LoadAsset(*entry);
 	}
 
 	void RuntimeAssetManager::AddMemoryOnlyAsset(SharedReference<Asset> asset)
 	{
+		m_MemoryOnlyAssets[asset->Handle] = asset;
 	}
 
 	bool RuntimeAssetManager::ReloadData(AssetHandle handle)
 	{
-		return false;
+		const AssetPackEntry* entry = m_AssetPack ? m_AssetPack->FindEntry(handle) : nullptr;
+		if (!entry)
+		{
+			VX_CORE_ERROR("Trying to reload invalid asset");
+			return false;
+		}
+
+		m_LoadedAssets.erase(handle);
+		m_AsyncLoader->ResetLoadState(handle);
+
+		return LoadAsset(*entry) != nullptr;
 	}
 
 	bool RuntimeAssetManager::IsHandleValid(AssetHandle handle)
 	{
-		return false;
+		if (IsMemoryOnlyAsset(handle))
+		{
+			return true;
+		}
+
+		return m_AssetPack && m_AssetPack->FindEntry(handle) != nullptr;
 	}
 
 	bool RuntimeAssetManager::IsMemoryOnlyAsset(AssetHandle handle)
 	{
-		return false;
+		return m_MemoryOnlyAssets.find(handle) != m_MemoryOnlyAssets.end();
 	}
 
 	bool RuntimeAssetManager::IsAssetLoaded(AssetHandle handle)
 	{
-		return false;
+		return m_LoadedAssets.find(handle) != m_LoadedAssets.end();
+	}
+
+	AssetHandle RuntimeAssetManager::GetAssetHandleFromFilepath(const Fs::Path& filepath)
+	{
+		const AssetMetadata metadata = GetMetadata(filepath);
+
+		if (!metadata.IsValid() || !GetAsset(metadata.Handle))
+		{
+			return 0;
+		}
+
+		return metadata.Handle;
 	}
 
 	std::unordered_set<AssetHandle> RuntimeAssetManager::GetAllAssetsWithType(AssetType type) const
 	{
-		return std::unordered_set<AssetHandle>();
+		std::unordered_set<AssetHandle> assets;
+
+		if (m_AssetPack)
+		{
+			const AssetPackEntry* entries = m_AssetPack->GetEntries();
+			const uint32_t entryCount = m_AssetPack->GetEntryCount();
+
+			for (uint32_t i = 0; i < entryCount; i++)
+			{
+				if (entries[i].Type != type)
+					continue;
+
+				assets.insert(entries[i].Handle);
+			}
+		}
+
+		return assets;
 	}
 
 	const std::unordered_map<AssetHandle, SharedReference<Asset>>& RuntimeAssetManager::GetLoadedAssets() const
 	{
-		return std::unordered_map<AssetHandle, SharedReference<Asset>>();
+		return m_LoadedAssets;
 	}
 
 	const std::unordered_map<AssetHandle, SharedReference<Asset>>& RuntimeAssetManager::GetMemoryOnlyAssets() const
 	{
-		return std::unordered_map<AssetHandle, SharedReference<Asset>>();
+		return m_MemoryOnlyAssets;
+	}
+
+	SharedReference<Asset> RuntimeAssetManager::GetAssetAsync(AssetHandle handle)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (auto it = m_MemoryOnlyAssets.find(handle); it != m_MemoryOnlyAssets.end())
+		{
+			return it->second;
+		}
+
+		if (auto it = m_LoadedAssets.find(handle); it != m_LoadedAssets.end())
+		{
+			return it->second;
+		}
+
+		const AssetPackEntry* entry = m_AssetPack ? m_AssetPack->FindEntry(handle) : nullptr;
+		if (!entry)
+		{
+			return nullptr;
+		}
+
+		// Failed loads stay failed until the asset is reloaded
+		if (m_AsyncLoader->GetLoadState(handle) != AssetLoadState::None)
+		{
+			return nullptr;
+		}
+
+		m_AsyncLoader->Load(m_AssetPack->GetMetadata(*entry), m_AssetPack->GetPayload(*entry));
+
+		// Assets only hold their dependencies' handles, so they can finish in any order
+		const uint64_t* dependencies = m_AssetPack->GetDependencies(*entry);
+		for (uint32_t i = 0; i < entry->DependencyCount; i++)
+		{
+			GetAssetAsync(dependencies[i]);
+		}
+
+		return nullptr;
+	}
+
+	void RuntimeAssetManager::PrefetchAssets(const std::vector<AssetHandle>& handles)
+	{
+		VX_PROFILE_FUNCTION();
+
+		for (const AssetHandle handle : handles)
+		{
+			GetAssetAsync(handle);
+		}
+	}
+
+	AssetLoadState RuntimeAssetManager::GetAssetLoadState(AssetHandle handle)
+	{
+		if (IsMemoryOnlyAsset(handle) || IsAssetLoaded(handle))
+		{
+			return AssetLoadState::Ready;
+		}
+
+		return m_AsyncLoader->GetLoadState(handle);
+	}
+
+	AsyncAssetLoadStatistics RuntimeAssetManager::GetAsyncLoadStatistics() const
+	{
+		return m_AsyncLoader->GetStatistics();
+	}
+
+	AssetMetadata RuntimeAssetManager::GetMetadata(AssetHandle handle) const
+	{
+		const AssetPackEntry* entry = m_AssetPack ? m_AssetPack->FindEntry(handle) : nullptr;
+		if (!entry)
+		{
+			return AssetMetadata();
+		}
+
+		AssetMetadata metadata = m_AssetPack->GetMetadata(*entry);
+		metadata.IsDataLoaded = m_LoadedAssets.contains(handle);
+
+		return metadata;
+	}
+
+	AssetMetadata RuntimeAssetManager::GetMetadata(const Fs::Path& filepath) const
+	{
+		if (!m_AssetPack)
+		{
+			return AssetMetadata();
+		}
+
+		// Same rules as the editor, paths inside the asset directory are made relative to it
+		Fs::Path relativePath = filepath.lexically_normal();
+		const Fs::Path assetDirectory = Project::GetAssetDirectory();
+
+		if (filepath.string().find(assetDirectory.string()) != std::string::npos)
+		{
+			relativePath = FileSystem::Relative(filepath, assetDirectory);
+		}
+
+		// Paths are only looked up when opening scenes or resolving mesh textures, a scan is cheap enough
+		const std::string path = relativePath.generic_string();
+
+		const AssetPackEntry* entries = m_AssetPack->GetEntries();
+		const uint32_t entryCount = m_AssetPack->GetEntryCount();
+
+		for (uint32_t i = 0; i < entryCount; i++)
+		{
+			if (m_AssetPack->GetPath(entries[i]) != path)
+				continue;
+
+			return GetMetadata(entries[i].Handle);
+		}
+
+		return AssetMetadata();
+	}
+
+	Buffer RuntimeAssetManager::GetAssetPayload(AssetHandle handle) const
+	{
+		const AssetPackEntry* entry = m_AssetPack ? m_AssetPack->FindEntry(handle) : nullptr;
+		if (!entry)
+		{
+			return Buffer();
+		}
+
+		return m_AssetPack->GetPayload(*entry);
+	}
+
+	SharedReference<AssetPack> RuntimeAssetManager::GetAssetPack() const
+	{
+		return m_AssetPack;
+	}
+
+	bool RuntimeAssetManager::OnProjectDeserialized()
+	{
+		m_AssetPack = AssetPack::Open(Project::GetAssetPackPath());
+
+		if (!m_AssetPack)
+		{
+			return false;
+		}
+
+		DefaultMesh::Init();
+
+		return true;
+	}
+
+	SharedReference<Asset> RuntimeAssetManager::LoadAsset(const AssetPackEntry& entry)
+	{
+		VX_PROFILE_FUNCTION();
+
+		const AssetHandle handle = entry.Handle;
+
+		m_PendingLoads.insert(handle);
+
+		// Dependencies first, so a material's textures or a scene's meshes are resident by the time they're resolved
+		const uint64_t* dependencies = m_AssetPack->GetDependencies(entry);
+		for (uint32_t i = 0; i < entry.DependencyCount; i++)
+		{
+			const AssetHandle dependency = dependencies[i];
+
+			if (IsAssetLoaded(dependency) || m_PendingLoads.contains(dependency))
+				continue;
+
+			GetAsset(dependency);
+		}
+
+		AssetMetadata metadata = m_AssetPack->GetMetadata(entry);
+		SharedReference<Asset> asset = nullptr;
+
+		if (entry.IsExternal())
+		{
+			metadata.IsDataLoaded = AssetImporter::TryLoadData(metadata, asset);
+		}
+		else
+		{
+			metadata.IsDataLoaded = AssetImporter::TryLoadDataFromMemory(metadata, m_AssetPack->GetPayload(entry), asset);
+		}
+
+		m_PendingLoads.erase(handle);
+
+		if (!metadata.IsDataLoaded)
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Manager] Failed to load '{}' from asset pack", metadata.Filepath.string());
+			return nullptr;
+		}
+
+		m_LoadedAssets[handle] = asset;
+
+		return asset;
+	}
+
+	void RuntimeAssetManager::OnAsyncLoadComplete(AssetHandle handle, SharedReference<Asset> asset)
+	{
+		// Already loaded synchronously by a GetAsset call in the meantime
+		if (!asset || IsAssetLoaded(handle))
+		{
+			return;
+		}
+
+		m_LoadedAssets[handle] = asset;
 	}
 
 }
@@ -2,8 +2,13 @@
 
 #include "Vortex/Asset/AssetManager/IAssetManager.h"
 
+#include "Vortex/Asset/AssetPack.h"
+
+#include "Vortex/Utils/FileSystem.h"
+
 namespace Vortex {
 
+	// Serves every asset from the project's memory mapped .vxpak, nothing is parsed until it's requested
 	class VORTEX_API RuntimeAssetManager : public IAssetManager
 	{
 	public:
@@ -17,10 +22,41 @@ namespace Vortex {
 		virtual bool IsHandleValid(AssetHandle handle) override;
 		virtual bool IsMemoryOnlyAsset(AssetHandle handle) override;
 		virtual bool IsAssetLoaded(AssetHandle handle) override;
+		virtual AssetHandle GetAssetHandleFromFilepath(const Fs::Path& filepath) override;
 
 		virtual std::unordered_set<AssetHandle> GetAllAssetsWithType(AssetType type) const override;
 		virtual const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetLoadedAssets() const override;
 		virtual const std::unordered_map<AssetHandle, SharedReference<Asset>>& GetMemoryOnlyAssets() const override;
+
+		virtual SharedReference<Asset> GetAssetAsync(AssetHandle handle) override;
+		virtual void PrefetchAssets(const std::vector<AssetHandle>& handles) override;
+		virtual AssetLoadState GetAssetLoadState(AssetHandle handle) override;
+		virtual AsyncAssetLoadStatistics GetAsyncLoadStatistics() const override;
+
+		AssetMetadata GetMetadata(AssetHandle handle) const;
+		AssetMetadata GetMetadata(const Fs::Path& filepath) const;
+
+		// Raw bytes of an inline asset, empty for assets that are loaded from their source file
+		Buffer GetAssetPayload(AssetHandle handle) const;
+
+		SharedReference<AssetPack> GetAssetPack() const;
+
+		bool OnProjectDeserialized();
+
+	private:
+		SharedReference<Asset> LoadAsset(const AssetPackEntry& entry);
+		void OnAsyncLoadComplete(AssetHandle handle, SharedReference<Asset> asset);
+
+	private:
+		SharedReference<AssetPack> m_AssetPack = nullptr;
+
+		std::unordered_map<AssetHandle, SharedReference<Asset>> m_LoadedAssets;
+		std::unordered_map<AssetHandle, SharedReference<Asset>> m_MemoryOnlyAssets;
+
+		// Assets in the middle of loading, breaks cycles in the dependency lists
+		std::unordered_set<AssetHandle> m_PendingLoads;
+
+		SharedReference<AsyncAssetLoader> m_AsyncLoader = nullptr;
 	};
 
 }
@@ -0,0 +1,364 @@
+#include "vxpch.h"
+#include "AssetPack.h"
+
+#include "Vortex/Asset/AssetImporter.h"
+#include "Vortex/Asset/AssetRegistry.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_set>
+
+namespace Vortex {
+
+	namespace Utils {
+
+		static constexpr uint32_t s_AssetPackMagic = 0x4B505856; // VXPK
+
+		// Bump whenever the file layout or a payload encoding changes
+		static constexpr uint32_t s_AssetPackVersion = 3;
+
+		// Payloads start on this boundary so loaders can read them in place
+		static constexpr uint64_t s_AssetPackPayloadAlignment = 16;
+
+		static uint64_t AlignOffset(uint64_t offset, uint64_t alignment)
+		{
+			return (offset + alignment - 1) & ~(alignment - 1);
+		}
+
+		// Any scalar that is the handle of another packed asset counts as a dependency,
+		// this covers material textures, scene meshes and prefab references alike
+		static void CollectDependencies(const YAML::Node& node, const AssetRegistry& registry, AssetHandle self, std::unordered_set<uint64_t>& outDependencies)
+		{
+			if (node.IsScalar())
+			{
+				uint64_t value = 0;
+				if (!YAML::convert<uint64_t>::decode(node, value) || value == 0 || value == (uint64_t)self)
+					return;
+
+				if (registry.Contains(value))
+				{
+					outDependencies.insert(value);
+				}
+
+				return;
+			}
+
+			if (node.IsSequence())
+			{
+				for (const YAML::Node& child : node)
+				{
+					CollectDependencies(child, registry, self, outDependencies);
+				}
+			}
+			else if (node.IsMap())
+			{
+				for (const auto& pair : node)
+				{
+					CollectDependencies(pair.second, registry, self, outDependencies);
+				}
+			}
+		}
+
+	}
+
+	AssetPack::~AssetPack()
+	{
+		FileSystem::UnmapFile(m_File);
+	}
+
+	SharedReference<AssetPack> AssetPack::Open(const Fs::Path& filepath)
+	{
+		VX_PROFILE_FUNCTION();
+
+		SharedReference<AssetPack> assetPack = SharedReference<AssetPack>::Create();
+		assetPack->m_Filepath = filepath;
+		assetPack->m_File = FileSystem::MapFile(filepath);
+
+		if (!assetPack->m_File)
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Pack] Failed to map '{}'", filepath.string());
+			return nullptr;
+		}
+
+		const uint8_t* base = assetPack->m_File.Data;
+
+		// The only fix-ups needed, every table is used in place
+		assetPack->m_Header = (const AssetPackHeader*)base;
+
+		if (!assetPack->Validate())
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Pack] '{}' is corrupted or was built by a different version", filepath.string());
+			return nullptr;
+		}
+
+		const AssetPackHeader& header = *assetPack->m_Header;
+		assetPack->m_Entries = (const AssetPackEntry*)(base + header.EntryTableOffset);
+		assetPack->m_Dependencies = (const uint64_t*)(base + header.DependencyTableOffset);
+		assetPack->m_Strings = (const char*)(base + header.StringTableOffset);
+
+		VX_CONSOLE_LOG_INFO("[Asset Pack] Mapped {} assets from '{}'", header.EntryCount, filepath.string());
+
+		return assetPack;
+	}
+
+	bool AssetPack::Build(const Fs::Path& outputFilepath, const AssetRegistry& registry, const Fs::Path& assetDirectory)
+	{
+		VX_PROFILE_FUNCTION();
+
+		struct PendingEntry
+		{
+			AssetPackEntry Entry;
+			std::string Path;
+			std::vector<uint64_t> Dependencies;
+			Buffer Payload;
+		};
+
+		std::vector<PendingEntry> pendingEntries;
+		pendingEntries.reserve(registry.Count());
+
+		for (const auto& [handle, metadata] : registry)
+		{
+			if (!metadata.IsValid())
+				continue;
+
+			const Fs::Path sourcePath = assetDirectory / metadata.Filepath;
+			if (!FileSystem::Exists(sourcePath))
+				continue;
+
+			PendingEntry& pending = pendingEntries.emplace_back();
+			pending.Entry.Handle = (uint64_t)handle;
+			pending.Entry.Type = metadata.Type;
+			pending.Path = metadata.Filepath.generic_string();
+
+			if (!AssetImporter::CanLoadFromMemory(metadata.Type))
+			{
+				pending.Entry.Flags |= (uint16_t)AssetPackEntryFlags::External;
+				continue;
+			}
+
+			pending.Payload = AssetImporter::BuildPackPayload(metadata, sourcePath);
+
+			// Couldn't be processed, the runtime falls back to the source file
+			if (!pending.Payload)
+			{
+				VX_CONSOLE_LOG_WARN("[Asset Pack] Failed to build the payload for '{}', it stays external", pending.Path);
+				pending.Entry.Flags |= (uint16_t)AssetPackEntryFlags::External;
+				continue;
+			}
+
+			// Imported meshes and textures are stored as their processed cache data and reference nothing by handle
+			if (!AssetImporter::HasYAMLPayload(metadata.Type))
+				continue;
+
+			// Walk the YAML once here so the runtime never has to
+			std::unordered_set<uint64_t> dependencies;
+
+			try
+			{
+				const YAML::Node data = YAML::Load(std::string((const char*)pending.Payload.Data, pending.Payload.Size));
+				Utils::CollectDependencies(data, registry, handle, dependencies);
+			}
+			catch (const YAML::Exception& e)
+			{
+				VX_CONSOLE_LOG_WARN("[Asset Pack] Failed to parse '{}' for dependencies\n     {}", pending.Path, e.what());
+			}
+
+			pending.Dependencies.assign(dependencies.begin(), dependencies.end());
+			std::sort(pending.Dependencies.begin(), pending.Dependencies.end());
+		}
+
+		std::sort(pendingEntries.begin(), pendingEntries.end(), [](const PendingEntry& lhs, const PendingEntry& rhs)
+		{
+			return lhs.Entry.Handle < rhs.Entry.Handle;
+		});
+
+		AssetPackHeader header;
+		header.Magic = Utils::s_AssetPackMagic;
+		header.Version = Utils::s_AssetPackVersion;
+		header.EntryCount = (uint32_t)pendingEntries.size();
+		header.EntryTableOffset = sizeof(AssetPackHeader);
+		header.DependencyTableOffset = header.EntryTableOffset + pendingEntries.size() * sizeof(AssetPackEntry);
+
+		uint64_t stringTableSize = 0;
+
+		for (PendingEntry& pending : pendingEntries)
+		{
+			pending.Entry.FirstDependency = header.DependencyCount;
+			pending.Entry.DependencyCount = (uint32_t)pending.Dependencies.size();
+			header.DependencyCount += pending.Entry.DependencyCount;
+
+			pending.Entry.PathOffset = stringTableSize;
+			pending.Entry.PathLength = (uint32_t)pending.Path.size();
+			stringTableSize += pending.Path.size();
+		}
+
+		header.StringTableOffset = header.DependencyTableOffset + (uint64_t)header.DependencyCount * sizeof(uint64_t);
+		header.PayloadOffset = Utils::AlignOffset(header.StringTableOffset + stringTableSize, Utils::s_AssetPackPayloadAlignment);
+
+		uint64_t payloadOffset = header.PayloadOffset;
+
+		for (PendingEntry& pending : pendingEntries)
+		{
+			if (!pending.Payload)
+				continue;
+
+			pending.Entry.PayloadOffset = payloadOffset;
+			pending.Entry.PayloadSize = pending.Payload.Size;
+			payloadOffset = Utils::AlignOffset(payloadOffset + pending.Payload.Size, Utils::s_AssetPackPayloadAlignment);
+		}
+
+		std::ofstream stream(outputFilepath, std::ios::binary | std::ios::trunc);
+		if (!stream)
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Pack] Failed to open '{}' for writing", outputFilepath.string());
+
+			for (PendingEntry& pending : pendingEntries)
+				pending.Payload.Release();
+
+			return false;
+		}
+
+		stream.write((const char*)&header, sizeof(AssetPackHeader));
+
+		for (const PendingEntry& pending : pendingEntries)
+		{
+			stream.write((const char*)&pending.Entry, sizeof(AssetPackEntry));
+		}
+
+		for (const PendingEntry& pending : pendingEntries)
+		{
+			stream.write((const char*)pending.Dependencies.data(), pending.Dependencies.size() * sizeof(uint64_t));
+		}
+
+		for (const PendingEntry& pending : pendingEntries)
+		{
+			stream.write(pending.Path.data(), pending.Path.size());
+		}
+
+		static const char s_Padding[Utils::s_AssetPackPayloadAlignment] = {};
+
+		for (PendingEntry& pending : pendingEntries)
+		{
+			if (!pending.Payload)
+				continue;
+
+			const uint64_t position = (uint64_t)stream.tellp();
+			stream.write(s_Padding, pending.Entry.PayloadOffset - position);
+			stream.write((const char*)pending.Payload.Data, pending.Payload.Size);
+
+			pending.Payload.Release();
+		}
+
+		VX_CONSOLE_LOG_INFO("[Asset Pack] Packed {} assets into '{}' ({} bytes)", header.EntryCount, outputFilepath.string(), payloadOffset);
+
+		return (bool)stream;
+	}
+
+	const AssetPackEntry* AssetPack::FindEntry(AssetHandle handle) const
+	{
+		const AssetPackEntry* first = m_Entries;
+		const AssetPackEntry* last = m_Entries + m_Header->EntryCount;
+
+		const AssetPackEntry* it = std::lower_bound(first, last, (uint64_t)handle, [](const AssetPackEntry& entry, uint64_t value)
+		{
+			return entry.Handle < value;
+		});
+
+		if (it == last || it->Handle != (uint64_t)handle)
+		{
+			return nullptr;
+		}
+
+		return it;
+	}
+
+	const AssetPackEntry* AssetPack::GetEntries() const
+	{
+		return m_Entries;
+	}
+
+	uint32_t AssetPack::GetEntryCount() const
+	{
+		return m_Header->EntryCount;
+	}
+
+	AssetMetadata AssetPack::GetMetadata(const AssetPackEntry& entry) const
+	{
+		AssetMetadata metadata;
+		metadata.Handle = entry.Handle;
+		metadata.Type = entry.Type;
+		metadata.Filepath = GetPath(entry);
+
+		return metadata;
+	}
+
+	std::string_view AssetPack::GetPath(const AssetPackEntry& entry) const
+	{
+		return std::string_view(m_Strings + entry.PathOffset, entry.PathLength);
+	}
+
+	const uint64_t* AssetPack::GetDependencies(const AssetPackEntry& entry) const
+	{
+		return m_Dependencies + entry.FirstDependency;
+	}
+
+	Buffer AssetPack::GetPayload(const AssetPackEntry& entry) const
+	{
+		Buffer payload;
+
+		if (entry.IsExternal())
+		{
+			return payload;
+		}
+
+		payload.Data = (uint8_t*)(m_File.Data + entry.PayloadOffset);
+		payload.Size = entry.PayloadSize;
+
+		return payload;
+	}
+
+	const Fs::Path& AssetPack::GetFilepath() const
+	{
+		return m_Filepath;
+	}
+
+	bool AssetPack::Validate() const
+	{
+		const uint64_t fileSize = m_File.Size;
+
+		if (fileSize < sizeof(AssetPackHeader))
+			return false;
+
+		const AssetPackHeader& header = *m_Header;
+
+		if (header.Magic != Utils::s_AssetPackMagic || header.Version != Utils::s_AssetPackVersion)
+			return false;
+
+		const uint64_t entryTableEnd = header.EntryTableOffset + (uint64_t)header.EntryCount * sizeof(AssetPackEntry);
+		const uint64_t dependencyTableEnd = header.DependencyTableOffset + (uint64_t)header.DependencyCount * sizeof(uint64_t);
+
+		if (entryTableEnd > fileSize || dependencyTableEnd > fileSize || header.StringTableOffset > fileSize || header.PayloadOffset > fileSize)
+			return false;
+
+		const AssetPackEntry* entries = (const AssetPackEntry*)(m_File.Data + header.EntryTableOffset);
+
+		for (uint32_t i = 0; i < header.EntryCount; i++)
+		{
+			const AssetPackEntry& entry = entries[i];
+
+			if ((uint64_t)entry.FirstDependency + entry.DependencyCount > header.DependencyCount)
+				return false;
+
+			if (header.StringTableOffset + entry.PathOffset + entry.PathLength > header.PayloadOffset)
+				return false;
+
+			if (!entry.IsExternal() && entry.PayloadOffset + entry.PayloadSize > fileSize)
+				return false;
+		}
+
+		return true;
+	}
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
+
+#include "Vortex/Asset/Asset.h"
+#include "Vortex/Asset/AssetMetadata.h"
+
+#include "Vortex/ReferenceCounting/RefCounted.h"
+#include "Vortex/ReferenceCounting/SharedRef.h"
+
+#include "Vortex/Utils/FileSystem.h"
+
+#include <string_view>
+
+namespace Vortex {
+
+	class AssetRegistry;
+
+	// .vxpak layout, all offsets are from the start of the file
+	// [Header][Entry table][Dependency table][String table][Payloads]
+	struct AssetPackHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint32_t EntryCount = 0;
+		uint32_t DependencyCount = 0;
+		uint64_t EntryTableOffset = 0;
+		uint64_t DependencyTableOffset = 0;
+		uint64_t StringTableOffset = 0;
+		uint64_t PayloadOffset = 0;
+	};
+
+	enum class AssetPackEntryFlags : uint16_t
+	{
+		None = 0,
+		// No payload, the asset is still loaded from its source file in the asset directory
+		External = BIT(0),
+	};
+
+	// The table is sorted by handle so lookups are a binary search straight over the mapped file
+	struct AssetPackEntry
+	{
+		uint64_t Handle = 0;
+		AssetType Type = AssetType::None;
+		uint16_t Flags = 0;
+		uint32_t DependencyCount = 0;
+		uint32_t FirstDependency = 0;
+		uint32_t PathLength = 0;
+		uint64_t PathOffset = 0;
+		uint64_t PayloadOffset = 0;
+		uint64_t PayloadSize = 0;
+
+		inline bool IsExternal() const { return Flags & (uint16_t)AssetPackEntryFlags::External; }
+	};
+
+	static_assert(sizeof(AssetPackHeader) == 48, "AssetPackHeader layout changed, bump the asset pack version!");
+	static_assert(sizeof(AssetPackEntry) == 48, "AssetPackEntry layout changed, bump the asset pack version!");
+
+	class VORTEX_API AssetPack : public RefCounted
+	{
+	public:
+		AssetPack() = default;
+		~AssetPack() override;
+
+		// Maps the pack into memory, returns nullptr if the file is missing or wasn't written by this version
+		static SharedReference<AssetPack> Open(const Fs::Path& filepath);
+
+		// Packs every asset in the registry that still exists on disk, assets that can be parsed from memory are
+		// stored inline, meshes and textures as their processed cache data, everything else is recorded as an external reference
+		static bool Build(const Fs::Path& outputFilepath, const AssetRegistry& registry, const Fs::Path& assetDirectory);
+
+		const AssetPackEntry* FindEntry(AssetHandle handle) const;
+		const AssetPackEntry* GetEntries() const;
+		uint32_t GetEntryCount() const;
+
+		AssetMetadata GetMetadata(const AssetPackEntry& entry) const;
+		std::string_view GetPath(const AssetPackEntry& entry) const;
+		const uint64_t* GetDependencies(const AssetPackEntry& entry) const;
+
+		// Non-owning view into the mapped file, valid for as long as the pack is alive
+		Buffer GetPayload(const AssetPackEntry& entry) const;
+
+		const Fs::Path& GetFilepath() const;
+
+	private:
+		bool Validate() const;
+
+	private:
+		Fs::Path m_Filepath;
+		MappedFile m_File;
+
+		const AssetPackHeader* m_Header = nullptr;
+		const AssetPackEntry* m_Entries = nullptr;
+		const uint64_t* m_Dependencies = nullptr;
+		const char* m_Strings = nullptr;
+	};
+
+}
@@ -49,4 +49,9 @@ namespace Vortex {
 		m_LoadedAssets.clear();
 	}
 
+	void AssetRegistry::Reserve(size_t count)
+	{
+		m_LoadedAssets.reserve(count);
+	}
+
 }
\ No newline at end of file
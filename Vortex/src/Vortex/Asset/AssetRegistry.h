@@ -19,6 +19,7 @@ namespace Vortex {
 		const std::unordered_map<AssetHandle, AssetMetadata>::const_iterator Find(AssetHandle handle) const;
 		size_t Remove(AssetHandle handle);
 		void Clear();
+		void Reserve(size_t count);
 
 		inline std::unordered_map<AssetHandle, AssetMetadata>::iterator begin() { return m_LoadedAssets.begin(); }
 		inline std::unordered_map<AssetHandle, AssetMetadata>::iterator end() { return m_LoadedAssets.end(); }
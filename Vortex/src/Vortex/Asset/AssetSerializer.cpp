@@ -1,6 +1,8 @@
 #include "vxpch.h"
 #include "AssetSerializer.h"
 
+#include "Vortex/Asset/AssetImporter.h"
+
 #include "Vortex/Project/Project.h"
 
 #include "Vortex/Scene/Prefab.h"
@@ -12,6 +14,8 @@
 #include "Vortex/Renderer/Renderer.h"
 #include "Vortex/Renderer/Mesh.h"
 #include "Vortex/Renderer/StaticMesh.h"
+#include "Vortex/Renderer/MeshCache.h"
+#include "Vortex/Renderer/TextureCache.h"
 #include "Vortex/Renderer/Skybox.h"
 #include "Vortex/Renderer/Texture.h"
 #include "Vortex/Renderer/Font/Font.h"
@@ -26,6 +30,87 @@
 
 namespace Vortex {
 
+	namespace Utils {
+
+		// Resolved through the project so loaders work under either asset manager
+		static Fs::Path GetAssetFilepath(const AssetMetadata& metadata)
+		{
+			return Project::GetAssetDirectory() / metadata.Filepath;
+		}
+
+		static bool LoadYAMLPayload(const AssetMetadata& metadata, const Buffer& payload, YAML::Node& outData)
+		{
+			try
+			{
+				outData = YAML::Load(std::string((const char*)payload.Data, payload.Size));
+			}
+			catch (const YAML::ParserException& e)
+			{
+				VX_CONSOLE_LOG_ERROR("[Asset Serializer] Failed to parse packed asset '{}'\n     {}", metadata.Filepath.string(), e.what());
+				return false;
+			}
+
+			return (bool)outData;
+		}
+
+		// Same properties whether the texture is decoded from its source file or read from an asset pack
+		static TextureProperties GetTextureProperties(const std::string& filepath)
+		{
+			TextureProperties imageProps;
+			imageProps.Filepath = filepath;
+			imageProps.WrapMode = ImageWrap::Repeat;
+			imageProps.BlockCompress = true;
+
+			return imageProps;
+		}
+
+		static void LogCorruptedPayload(const AssetMetadata& metadata)
+		{
+			VX_CONSOLE_LOG_ERROR("[Asset Serializer] Packed asset '{}' is corrupted or was built by a different version", metadata.Filepath.string());
+		}
+
+		// Reads and parses on the calling thread, the document is handed to the main thread to build the asset from
+		static bool PrepareYAML(const AssetMetadata& metadata, const Buffer& payload, YAML::Node& outData)
+		{
+			if (payload)
+			{
+				return LoadYAMLPayload(metadata, payload, outData);
+			}
+
+			try
+			{
+				outData = YAML::LoadFile(GetAssetFilepath(metadata).string());
+			}
+			catch (const YAML::Exception& e)
+			{
+				VX_CONSOLE_LOG_ERROR("[Asset Serializer] Failed to load '{}'\n     {}", metadata.Filepath.string(), e.what());
+				return false;
+			}
+
+			return (bool)outData;
+		}
+
+	}
+
+	Buffer AssetSerializer::BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath)
+	{
+		return FileSystem::ReadBinary(sourceFilepath);
+	}
+
+	AssetLoadFinalizeFn AssetSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		// Goes back through the importer, serializers are recreated whenever an asset manager is
+		return [metadata, payload](SharedReference<Asset>& asset)
+		{
+			if (payload)
+			{
+				return AssetImporter::TryLoadDataFromMemory(metadata, payload, asset);
+			}
+
+			return AssetImporter::TryLoadData(metadata, asset);
+		};
+	}
+
 	void MeshSerializer::Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 
@@ -33,7 +118,7 @@ namespace Vortex {
 
 	bool MeshSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		asset = Mesh::Create(relativePath, TransformComponent(), MeshImportOptions());
 		asset->Handle = metadata.Handle;
@@ -41,6 +126,52 @@ namespace Vortex {
 		return asset.As<Mesh>()->IsLoaded();
 	}
 
+	bool MeshSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		MeshData data;
+		if (!MeshCache::Deserialize(payload, data))
+		{
+			Utils::LogCorruptedPayload(metadata);
+			return false;
+		}
+
+		// The path is still used to resolve the material's textures
+		asset = Mesh::Create(Utils::GetAssetFilepath(metadata).string(), MeshImportOptions(), data);
+		asset->Handle = metadata.Handle;
+
+		return asset.As<Mesh>()->IsLoaded();
+	}
+
+	Buffer MeshSerializer::BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath)
+	{
+		// Imported once here, the runtime builds the mesh straight from the processed geometry
+		MeshData data;
+		if (!Mesh::LoadMeshData(sourceFilepath.string(), MeshImportOptions(), data))
+			return Buffer();
+
+		return MeshCache::Serialize(data);
+	}
+
+	AssetLoadFinalizeFn MeshSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
+		const MeshImportOptions importOptions = MeshImportOptions();
+
+		// The import, cache read or payload parse happens here, the material and vertex arrays are created on the main thread
+		SharedRef<MeshData> data = CreateShared<MeshData>();
+		const bool loaded = payload ? MeshCache::Deserialize(payload, *data) : Mesh::LoadMeshData(relativePath, importOptions, *data);
+		if (!loaded)
+			return nullptr;
+
+		return [relativePath, importOptions, data, metadata](SharedReference<Asset>& asset)
+		{
+			asset = Mesh::Create(relativePath, importOptions, *data);
+			asset->Handle = metadata.Handle;
+
+			return asset.As<Mesh>()->IsLoaded();
+		};
+	}
+
 	void FontSerializer::Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 
@@ -48,7 +179,7 @@ namespace Vortex {
 
 	bool FontSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		asset = Font::Create(relativePath);
 		asset->Handle = metadata.Handle;
@@ -66,6 +197,28 @@ namespace Vortex {
 		return DeserializeFromYAML(metadata, asset);
 	}
 
+	bool AudioSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		YAML::Node audioData;
+		if (!Utils::LoadYAMLPayload(metadata, payload, audioData))
+			return false;
+
+		return DeserializeFromYAML(audioData, metadata, asset);
+	}
+
+	AssetLoadFinalizeFn AudioSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		YAML::Node audioData;
+		if (!Utils::PrepareYAML(metadata, payload, audioData))
+			return nullptr;
+
+		return [audioData, metadata](SharedReference<Asset>& asset)
+		{
+			AudioSerializer serializer;
+			return serializer.DeserializeFromYAML(audioData, metadata, asset);
+		};
+	}
+
 	void AudioSerializer::SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		YAML::Emitter out;
@@ -160,7 +313,7 @@ namespace Vortex {
 		out << YAML::EndMap;
 		out << YAML::EndMap;
 
-		const std::string outputFile = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string outputFile = Utils::GetAssetFilepath(metadata).string();
 		std::ofstream fout(outputFile);
 		VX_CORE_ASSERT(fout.is_open(), "Failed to open file!");
 
@@ -171,9 +324,13 @@ namespace Vortex {
 
 	bool AudioSerializer::DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
+
+		return DeserializeFromYAML(YAML::LoadFile(relativePath), metadata, asset);
+	}
 
-		YAML::Node audioData = YAML::LoadFile(relativePath);
+	bool AudioSerializer::DeserializeFromYAML(const YAML::Node& audioData, const AssetMetadata& metadata, SharedReference<Asset>& asset)
+	{
 		if (!audioData)
 			return false;
 
@@ -281,6 +438,15 @@ namespace Vortex {
 		return serializer.Deserialize(fullPath.string());
 	}
 
+	bool SceneAssetSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		asset = Scene::Create();
+		asset->Handle = metadata.Handle;
+
+		SceneSerializer serializer(asset.As<Scene>());
+		return serializer.DeserializeFromMemory(payload);
+	}
+
 	void PrefabAssetSerializer::Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		SerializeToYAML(metadata, asset);
@@ -291,6 +457,28 @@ namespace Vortex {
 		return DeserializeFromYAML(metadata, asset);
 	}
 
+	bool PrefabAssetSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		YAML::Node prefabData;
+		if (!Utils::LoadYAMLPayload(metadata, payload, prefabData))
+			return false;
+
+		return DeserializeFromYAML(prefabData, metadata, asset);
+	}
+
+	AssetLoadFinalizeFn PrefabAssetSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		YAML::Node prefabData;
+		if (!Utils::PrepareYAML(metadata, payload, prefabData))
+			return nullptr;
+
+		return [prefabData, metadata](SharedReference<Asset>& asset)
+		{
+			PrefabAssetSerializer serializer;
+			return serializer.DeserializeFromYAML(prefabData, metadata, asset);
+		};
+	}
+
 	void PrefabAssetSerializer::SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		YAML::Emitter out;
@@ -317,7 +505,7 @@ namespace Vortex {
 		out << YAML::EndSeq;
 		out << YAML::EndMap;
 
-		const std::string outputFile = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string outputFile = Utils::GetAssetFilepath(metadata).string();
 		std::ofstream fout(outputFile);
 		VX_CORE_ASSERT(fout.is_open(), "Failed to open file!");
 
@@ -328,12 +516,16 @@ namespace Vortex {
 
 	bool PrefabAssetSerializer::DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
+
+		return DeserializeFromYAML(YAML::LoadFile(relativePath), metadata, asset);
+	}
 
+	bool PrefabAssetSerializer::DeserializeFromYAML(const YAML::Node& prefabData, const AssetMetadata& metadata, SharedReference<Asset>& asset)
+	{
 		asset = SharedReference<Prefab>::Create();
 		asset->Handle = metadata.Handle;
 
-		YAML::Node prefabData = YAML::LoadFile(relativePath);
 		if (!prefabData)
 			return false;
 
@@ -351,7 +543,7 @@ namespace Vortex {
 
 	bool ScriptSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		return false;
 	}
@@ -363,11 +555,7 @@ namespace Vortex {
 
 	bool TextureSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
-
-		TextureProperties imageProps;
-		imageProps.Filepath = relativePath;
-		imageProps.WrapMode = ImageWrap::Repeat;
+		const TextureProperties imageProps = Utils::GetTextureProperties(Utils::GetAssetFilepath(metadata).string());
 
 		asset = Texture2D::Create(imageProps);
 		asset->Handle = metadata.Handle;
@@ -375,6 +563,59 @@ namespace Vortex {
 		return asset.As<Texture2D>()->IsLoaded();
 	}
 
+	bool TextureSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		// The levels are uploaded straight out of the payload
+		TextureData data;
+		if (!TextureCache::Deserialize(payload, data))
+		{
+			Utils::LogCorruptedPayload(metadata);
+			return false;
+		}
+
+		asset = Texture2D::Create(Utils::GetTextureProperties(Utils::GetAssetFilepath(metadata).string()), data);
+		asset->Handle = metadata.Handle;
+
+		return asset.As<Texture2D>()->IsLoaded();
+	}
+
+	Buffer TextureSerializer::BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath)
+	{
+		// Decoded, mipmapped and compressed once here, the payload is the texture cache entry
+		TextureData data;
+		if (!Texture2D::Decode(Utils::GetTextureProperties(sourceFilepath.string()), data))
+			return Buffer();
+
+		Buffer payload = TextureCache::Serialize(data);
+		data.Release();
+
+		return payload;
+	}
+
+	AssetLoadFinalizeFn TextureSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		const TextureProperties imageProps = Utils::GetTextureProperties(Utils::GetAssetFilepath(metadata).string());
+
+		// Decoded pixels are shared so they're freed even if the finalize step never runs
+		SharedRef<TextureData> data = SharedRef<TextureData>(new TextureData(), [](TextureData* textureData)
+		{
+			textureData->Release();
+			delete textureData;
+		});
+
+		const bool loaded = payload ? TextureCache::Deserialize(payload, *data) : Texture2D::Decode(imageProps, *data);
+		if (!loaded)
+			return nullptr;
+
+		return [imageProps, data, metadata](SharedReference<Asset>& asset)
+		{
+			asset = Texture2D::Create(imageProps, *data);
+			asset->Handle = metadata.Handle;
+
+			return asset.As<Texture2D>()->IsLoaded();
+		};
+	}
+
 	void ParticleEmitterSerializer::Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		SerializeToYAML(metadata, asset);
@@ -385,6 +626,28 @@ namespace Vortex {
 		return DeserializeFromYAML(metadata, asset);
 	}
 
+	bool ParticleEmitterSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		YAML::Node emitterData;
+		if (!Utils::LoadYAMLPayload(metadata, payload, emitterData))
+			return false;
+
+		return DeserializeFromYAML(emitterData, metadata, asset);
+	}
+
+	AssetLoadFinalizeFn ParticleEmitterSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		YAML::Node emitterData;
+		if (!Utils::PrepareYAML(metadata, payload, emitterData))
+			return nullptr;
+
+		return [emitterData, metadata](SharedReference<Asset>& asset)
+		{
+			ParticleEmitterSerializer serializer;
+			return serializer.DeserializeFromYAML(emitterData, metadata, asset);
+		};
+	}
+
 	void ParticleEmitterSerializer::SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		YAML::Emitter out;
@@ -417,11 +680,12 @@ namespace Vortex {
 			VX_SERIALIZE_PROPERTY(Velocity, emitterProperties.Velocity, out);
 			VX_SERIALIZE_PROPERTY(VelocityVariation, emitterProperties.VelocityVariation, out);
 			VX_SERIALIZE_PROPERTY(GenerateRandomColors, emitterProperties.GenerateRandomColors, out);
+			VX_SERIALIZE_PROPERTY(MaxParticles, emitterProperties.MaxParticles, out);
 		}
 		out << YAML::EndMap;
 		out << YAML::EndMap;
 
-		const std::string outputFile = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string outputFile = Utils::GetAssetFilepath(metadata).string();
 		std::ofstream fout(outputFile);
 		VX_CORE_ASSERT(fout.is_open(), "Failed to open file!");
 
@@ -432,9 +696,13 @@ namespace Vortex {
 
 	bool ParticleEmitterSerializer::DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
+
+		return DeserializeFromYAML(YAML::LoadFile(relativePath), metadata, asset);
+	}
 
-		YAML::Node emitterData = YAML::LoadFile(relativePath);
+	bool ParticleEmitterSerializer::DeserializeFromYAML(const YAML::Node& emitterData, const AssetMetadata& metadata, SharedReference<Asset>& asset)
+	{
 		if (!emitterData)
 			return false;
 
@@ -466,6 +734,12 @@ namespace Vortex {
 		VX_DESERIALIZE_PROPERTY(VelocityVariation, Math::vec3, emitterProperties.VelocityVariation, properties);
 		VX_DESERIALIZE_PROPERTY(GenerateRandomColors, bool, emitterProperties.GenerateRandomColors, properties);
 
+		// Older emitters were saved before the capacity was configurable
+		if (properties["MaxParticles"])
+		{
+			VX_DESERIALIZE_PROPERTY(MaxParticles, uint32_t, emitterProperties.MaxParticles, properties);
+		}
+
 		particleEmitter->SetProperties(emitterProperties);
 
 		return true;
@@ -484,6 +758,34 @@ namespace Vortex {
 		return DeserializeFromYAML(metadata, asset);
 	}
 
+	bool MaterialSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		YAML::Node materialData;
+		if (!Utils::LoadYAMLPayload(metadata, payload, materialData))
+			return false;
+
+		asset = Material::Create(Renderer::GetShaderLibrary().Get("PBR_Static"), MaterialProperties());
+		asset->Handle = metadata.Handle;
+
+		return DeserializeFromYAML(materialData, metadata, asset);
+	}
+
+	AssetLoadFinalizeFn MaterialSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		YAML::Node materialData;
+		if (!Utils::PrepareYAML(metadata, payload, materialData))
+			return nullptr;
+
+		return [materialData, metadata](SharedReference<Asset>& asset)
+		{
+			asset = Material::Create(Renderer::GetShaderLibrary().Get("PBR_Static"), MaterialProperties());
+			asset->Handle = metadata.Handle;
+
+			MaterialSerializer serializer;
+			return serializer.DeserializeFromYAML(materialData, metadata, asset);
+		};
+	}
+
 	void MaterialSerializer::SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 		YAML::Emitter out;
@@ -527,7 +829,7 @@ namespace Vortex {
 		out << YAML::EndMap;
 		out << YAML::EndMap;
 
-		const std::string outputFile = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string outputFile = Utils::GetAssetFilepath(metadata).string();
 		std::ofstream fout(outputFile);
 		VX_CORE_ASSERT(fout.is_open(), "Failed to open file!");
 		
@@ -538,9 +840,13 @@ namespace Vortex {
 
 	bool MaterialSerializer::DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 		
-		YAML::Node materialData = YAML::LoadFile(relativePath);
+		return DeserializeFromYAML(YAML::LoadFile(relativePath), metadata, asset);
+	}
+
+	bool MaterialSerializer::DeserializeFromYAML(const YAML::Node& materialData, const AssetMetadata& metadata, SharedReference<Asset>& asset)
+	{
 		if (!materialData)
 			return false;
 
@@ -579,7 +885,7 @@ namespace Vortex {
 
 	bool AnimatorSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		return false;
 	}
@@ -591,7 +897,7 @@ namespace Vortex {
 
 	bool AnimationSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		return false;
 	}
@@ -603,7 +909,7 @@ namespace Vortex {
 
 	bool StaticMeshSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		asset = StaticMesh::Create(relativePath, TransformComponent(), MeshImportOptions());
 		asset->Handle = metadata.Handle;
@@ -611,6 +917,52 @@ namespace Vortex {
 		return asset.As<StaticMesh>()->IsLoaded();
 	}
 
+	bool StaticMeshSerializer::TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset)
+	{
+		StaticMeshData data;
+		if (!MeshCache::Deserialize(payload, data))
+		{
+			Utils::LogCorruptedPayload(metadata);
+			return false;
+		}
+
+		// The path is still used to resolve the materials' textures
+		asset = StaticMesh::Create(Utils::GetAssetFilepath(metadata).string(), MeshImportOptions(), data);
+		asset->Handle = metadata.Handle;
+
+		return asset.As<StaticMesh>()->IsLoaded();
+	}
+
+	Buffer StaticMeshSerializer::BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath)
+	{
+		// Imported once here, the runtime builds the mesh straight from the processed geometry
+		StaticMeshData data;
+		if (!StaticMesh::LoadMeshData(sourceFilepath.string(), MeshImportOptions(), data))
+			return Buffer();
+
+		return MeshCache::Serialize(data);
+	}
+
+	AssetLoadFinalizeFn StaticMeshSerializer::PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
+		const MeshImportOptions importOptions = MeshImportOptions();
+
+		// The import, cache read or payload parse happens here, materials and vertex arrays are created on the main thread
+		SharedRef<StaticMeshData> data = CreateShared<StaticMeshData>();
+		const bool loaded = payload ? MeshCache::Deserialize(payload, *data) : StaticMesh::LoadMeshData(relativePath, importOptions, *data);
+		if (!loaded)
+			return nullptr;
+
+		return [relativePath, importOptions, data, metadata](SharedReference<Asset>& asset)
+		{
+			asset = StaticMesh::Create(relativePath, importOptions, *data);
+			asset->Handle = metadata.Handle;
+
+			return asset.As<StaticMesh>()->IsLoaded();
+		};
+	}
+
 	void EnvironmentSerializer::Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset)
 	{
 
@@ -618,7 +970,7 @@ namespace Vortex {
 
 	bool EnvironmentSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		asset = Skybox::Create(relativePath);
 		asset->Handle = metadata.Handle;
@@ -642,7 +994,7 @@ namespace Vortex {
 
 	bool AudioListenerSerializer::DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		return false;
 	}
@@ -654,7 +1006,7 @@ namespace Vortex {
 
 	bool PhysicsMaterialSerializer::TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset)
 	{
-		const std::string relativePath = Project::GetEditorAssetManager()->GetFileSystemPath(metadata).string();
+		const std::string relativePath = Utils::GetAssetFilepath(metadata).string();
 
 		return false;
 	}
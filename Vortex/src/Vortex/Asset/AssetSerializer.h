@@ -1,19 +1,46 @@
 #pragma once
 
 #include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
 
 #include "Vortex/Asset/Asset.h"
 #include "Vortex/Asset/AssetMetadata.h"
 
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
+#include "Vortex/Utils/FileSystem.h"
+
+#include <functional>
+
+namespace YAML {
+
+	class Node;
+
+}
+
 namespace Vortex {
 
+	// Finishes an async load on the main thread, where GPU objects can be created
+	using VORTEX_API AssetLoadFinalizeFn = std::function<bool(SharedReference<Asset>& asset)>;
+
 	class VORTEX_API AssetSerializer
 	{
 	public:
 		virtual void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) = 0;
 		virtual bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) = 0;
+
+		// Loads from the asset's bytes in an asset pack instead of the file on disk
+		virtual bool CanLoadFromMemory() const { return false; }
+		virtual bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) { return false; }
+
+		// The bytes an asset pack stores for TryLoadDataFromMemory, by default the source file itself
+		virtual Buffer BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath);
+		// Processed binary payloads aren't scanned for the handles of other assets
+		virtual bool HasYAMLPayload() const { return true; }
+
+		// Runs on a job worker and may only do file I/O and CPU decoding, an empty payload means the asset is read from disk.
+		// Returns nullptr if the load already failed, by default the whole load is deferred to the finalize step
+		virtual AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload);
 	};
 
 	class VORTEX_API MeshSerializer : public AssetSerializer
@@ -21,6 +48,11 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		Buffer BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath) override;
+		bool HasYAMLPayload() const override { return false; }
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 	};
 
 	class VORTEX_API FontSerializer : public AssetSerializer
@@ -35,9 +67,13 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 
 		void SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset);
 		bool DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset);
+		bool DeserializeFromYAML(const YAML::Node& data, const AssetMetadata& metadata, SharedReference<Asset>& asset);
 	};
 
 	class VORTEX_API SceneAssetSerializer : public AssetSerializer
@@ -45,6 +81,8 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
 	};
 
 	class VORTEX_API PrefabAssetSerializer : public AssetSerializer
@@ -52,10 +90,14 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 
 	private:
 		void SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset);
 		bool DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset);
+		bool DeserializeFromYAML(const YAML::Node& data, const AssetMetadata& metadata, SharedReference<Asset>& asset);
 	};
 
 	class VORTEX_API ScriptSerializer : public AssetSerializer
@@ -70,6 +112,11 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		Buffer BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath) override;
+		bool HasYAMLPayload() const override { return false; }
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 	};
 
 	class VORTEX_API ParticleEmitterSerializer : public AssetSerializer
@@ -77,9 +124,13 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 
 		void SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset);
 		bool DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset);
+		bool DeserializeFromYAML(const YAML::Node& data, const AssetMetadata& metadata, SharedReference<Asset>& asset);
 	};
 
 	class VORTEX_API MaterialSerializer : public AssetSerializer
@@ -87,9 +138,13 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 
 		void SerializeToYAML(const AssetMetadata& metadata, const SharedReference<Asset>& asset);
 		bool DeserializeFromYAML(const AssetMetadata& metadata, SharedReference<Asset>& asset);
+		bool DeserializeFromYAML(const YAML::Node& data, const AssetMetadata& metadata, SharedReference<Asset>& asset);
 	};
 
 	class VORTEX_API AnimatorSerializer : public AssetSerializer
@@ -111,6 +166,11 @@ namespace Vortex {
 	public:
 		void Serialize(const AssetMetadata& metadata, const SharedReference<Asset>& asset) override;
 		bool TryLoadData(const AssetMetadata& metadata, SharedReference<Asset>& asset) override;
+		bool CanLoadFromMemory() const override { return true; }
+		bool TryLoadDataFromMemory(const AssetMetadata& metadata, const Buffer& payload, SharedReference<Asset>& asset) override;
+		Buffer BuildPackPayload(const AssetMetadata& metadata, const Fs::Path& sourceFilepath) override;
+		bool HasYAMLPayload() const override { return false; }
+		AssetLoadFinalizeFn PrepareLoadData(const AssetMetadata& metadata, const Buffer& payload) override;
 	};
 
 	class VORTEX_API EnvironmentSerializer : public AssetSerializer
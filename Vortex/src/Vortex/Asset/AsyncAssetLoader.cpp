@@ -0,0 +1,217 @@
+#include "vxpch.h"
+#include "AsyncAssetLoader.h"
+
+#include "Vortex/Core/Application.h"
+
+#include "Vortex/Asset/AssetImporter.h"
+
+#include <chrono>
+
+namespace Vortex {
+
+	namespace Utils {
+
+		// Main thread time spent creating assets per frame, at least one load is always finished
+		static constexpr float s_FinalizeBudgetMilliseconds = 4.0f;
+
+		using Clock = std::chrono::steady_clock;
+
+		static float GetElapsedMilliseconds(const Clock::time_point& start)
+		{
+			return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+		}
+
+	}
+
+	AsyncAssetLoader::AsyncAssetLoader(const CompletionFn& onComplete)
+		: m_OnComplete(onComplete)
+	{
+	}
+
+	bool AsyncAssetLoader::Load(const AssetMetadata& metadata, const Buffer& payload)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (m_IsShutdown)
+			return false;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+
+			AssetLoadState& state = m_LoadStates[metadata.Handle];
+			if (state == AssetLoadState::Loading)
+				return false;
+
+			state = AssetLoadState::Loading;
+		}
+
+		m_Queued++;
+
+		// Keeps the loader alive until the worker and the finalize step are done with it
+		SharedReference<AsyncAssetLoader> loader = this;
+
+		JobSystem::Submit([loader, metadata, payload]()
+		{
+			loader->m_Queued--;
+			loader->m_InFlight++;
+
+			AssetLoadFinalizeFn finalize = nullptr;
+
+			if (!loader->m_IsShutdown)
+			{
+				finalize = AssetImporter::PrepareLoadData(metadata, payload);
+			}
+
+			loader->OnLoadPrepared(metadata, finalize);
+
+			loader->m_InFlight--;
+		}, &m_Jobs);
+
+		return true;
+	}
+
+	AssetLoadState AsyncAssetLoader::GetLoadState(AssetHandle handle) const
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (auto it = m_LoadStates.find(handle); it != m_LoadStates.end())
+		{
+			return it->second;
+		}
+
+		return AssetLoadState::None;
+	}
+
+	void AsyncAssetLoader::ResetLoadState(AssetHandle handle)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		if (auto it = m_LoadStates.find(handle); it != m_LoadStates.end() && it->second == AssetLoadState::Failed)
+		{
+			m_LoadStates.erase(it);
+		}
+	}
+
+	void AsyncAssetLoader::Shutdown()
+	{
+		VX_PROFILE_FUNCTION();
+
+		m_IsShutdown = true;
+
+		// Serializers are recreated along with the next asset manager, no worker may still be inside one
+		JobSystem::Wait(m_Jobs);
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		m_PreparedLoads.clear();
+		m_LoadStates.clear();
+	}
+
+	AsyncAssetLoadStatistics AsyncAssetLoader::GetStatistics() const
+	{
+		AsyncAssetLoadStatistics stats;
+		stats.Queued = m_Queued.load();
+		stats.InFlight = m_InFlight.load();
+		stats.LastFinalizeCount = m_LastFinalizeCount;
+		stats.LastFinalizeTime = m_LastFinalizeTime;
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		stats.AwaitingFinalize = (uint32_t)m_PreparedLoads.size();
+
+		for (const auto& [handle, state] : m_LoadStates)
+		{
+			if (state != AssetLoadState::Failed)
+				continue;
+
+			stats.Failed++;
+		}
+
+		return stats;
+	}
+
+	void AsyncAssetLoader::OnLoadPrepared(const AssetMetadata& metadata, const AssetLoadFinalizeFn& finalize)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Failures are reported on the main thread too, so the completion callback only ever runs there
+		m_PreparedLoads.push_back({ metadata, finalize });
+
+		if (m_FinalizeQueued || m_IsShutdown)
+			return;
+
+		m_FinalizeQueued = true;
+
+		SharedReference<AsyncAssetLoader> loader = this;
+		Application::Get().GetPostUpdateFunctionQueue().queue([loader]() { loader->FinalizeLoads(); });
+	}
+
+	void AsyncAssetLoader::FinalizeLoads()
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (m_IsShutdown)
+			return;
+
+		std::vector<PreparedLoad> preparedLoads;
+
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			std::swap(preparedLoads, m_PreparedLoads);
+		}
+
+		const Utils::Clock::time_point start = Utils::Clock::now();
+		size_t finalizedCount = 0;
+
+		for (; finalizedCount < preparedLoads.size(); finalizedCount++)
+		{
+			if (finalizedCount > 0 && Utils::GetElapsedMilliseconds(start) >= Utils::s_FinalizeBudgetMilliseconds)
+				break;
+
+			const PreparedLoad& preparedLoad = preparedLoads[finalizedCount];
+			const AssetHandle handle = preparedLoad.Metadata.Handle;
+
+			SharedReference<Asset> asset = nullptr;
+			const bool loaded = preparedLoad.Finalize && preparedLoad.Finalize(asset);
+
+			if (!loaded)
+			{
+				VX_CONSOLE_LOG_ERROR("[Asset Manager] Failed to load '{}' asynchronously", preparedLoad.Metadata.Filepath.string());
+				asset = nullptr;
+			}
+
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+
+				// Ready assets are tracked by the asset manager, only failures are remembered here
+				if (loaded)
+					m_LoadStates.erase(handle);
+				else
+					m_LoadStates[handle] = AssetLoadState::Failed;
+			}
+
+			m_OnComplete(handle, asset);
+		}
+
+		m_LastFinalizeCount = (uint32_t)finalizedCount;
+		m_LastFinalizeTime = Utils::GetElapsedMilliseconds(start);
+
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Whatever didn't fit in this frame's budget goes first next frame
+		m_PreparedLoads.insert(
+			m_PreparedLoads.begin(),
+			std::make_move_iterator(preparedLoads.begin() + finalizedCount),
+			std::make_move_iterator(preparedLoads.end())
+		);
+
+		m_FinalizeQueued = !m_PreparedLoads.empty();
+
+		if (!m_FinalizeQueued)
+			return;
+
+		SharedReference<AsyncAssetLoader> loader = this;
+		Application::Get().GetPostUpdateFunctionQueue().queue([loader]() { loader->FinalizeLoads(); });
+	}
+
+}
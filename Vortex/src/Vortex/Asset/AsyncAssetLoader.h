@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
+#include "Vortex/Core/JobSystem.h"
+
+#include "Vortex/Asset/Asset.h"
+#include "Vortex/Asset/AssetMetadata.h"
+#include "Vortex/Asset/AssetSerializer.h"
+
+#include "Vortex/ReferenceCounting/RefCounted.h"
+#include "Vortex/ReferenceCounting/SharedRef.h"
+
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace Vortex {
+
+	enum class AssetLoadState : uint8_t
+	{
+		None = 0, Loading, Ready, Failed,
+	};
+
+	struct VORTEX_API AsyncAssetLoadStatistics
+	{
+		// Submitted but not picked up by a worker yet
+		uint32_t Queued = 0;
+		// Being read or decoded on a worker
+		uint32_t InFlight = 0;
+		// Decoded and waiting for the main thread
+		uint32_t AwaitingFinalize = 0;
+		uint32_t Failed = 0;
+
+		// Most recent main thread batch
+		uint32_t LastFinalizeCount = 0;
+		float LastFinalizeTime = 0.0f;
+	};
+
+	// Runs the CPU half of asset loads on job workers and finishes them on the main thread
+	// through the application's post update queue, a few at a time so large batches don't stall a frame
+	class VORTEX_API AsyncAssetLoader : public RefCounted
+	{
+	public:
+		// Always invoked on the main thread, asset is nullptr if the load failed
+		using CompletionFn = std::function<void(AssetHandle handle, SharedReference<Asset> asset)>;
+
+	public:
+		AsyncAssetLoader(const CompletionFn& onComplete);
+		~AsyncAssetLoader() override = default;
+
+		// An empty payload means the asset is read from its file, returns false if it's already loading
+		bool Load(const AssetMetadata& metadata, const Buffer& payload = Buffer());
+
+		AssetLoadState GetLoadState(AssetHandle handle) const;
+		// Forgets a failed load so the next request tries again
+		void ResetLoadState(AssetHandle handle);
+
+		// Waits for running workers and drops everything that wasn't finalized,
+		// the completion callback is never invoked after this returns
+		void Shutdown();
+
+		AsyncAssetLoadStatistics GetStatistics() const;
+
+	private:
+		struct PreparedLoad
+		{
+			AssetMetadata Metadata;
+			AssetLoadFinalizeFn Finalize = nullptr;
+		};
+
+		void OnLoadPrepared(const AssetMetadata& metadata, const AssetLoadFinalizeFn& finalize);
+		void FinalizeLoads();
+
+	private:
+		CompletionFn m_OnComplete = nullptr;
+
+		mutable std::mutex m_Mutex;
+		std::unordered_map<AssetHandle, AssetLoadState> m_LoadStates;
+		std::vector<PreparedLoad> m_PreparedLoads;
+		bool m_FinalizeQueued = false;
+
+		JobCounter m_Jobs;
+
+		std::atomic<uint32_t> m_Queued = 0;
+		std::atomic<uint32_t> m_InFlight = 0;
+		std::atomic<bool> m_IsShutdown = false;
+
+		uint32_t m_LastFinalizeCount = 0;
+		float m_LastFinalizeTime = 0.0f;
+	};
+
+}
@@ -1,6 +1,8 @@
 #include "vxpch.h"
 #include "Application.h"
 
+#include "Vortex/Core/JobSystem.h"
+
 #include "Vortex/Input/Input.h"
 
 #include "Vortex/Events/KeyEvent.h"
@@ -66,6 +68,7 @@ namespace Vortex {
 
 		m_Window->SetEventCallback(VX_BIND_CALLBACK(Application::OnEvent));
 
+		JobSystem::Init();
 		Networking::Init();
 		Renderer::Init();
 		SystemManager::RegisterSystem<UISystem>();
@@ -105,6 +108,7 @@ namespace Vortex {
 		SystemManager::UnRegisterAssetSystem<ParticleSystem>();
 		Renderer::Shutdown();
 		Networking::Shutdown();
+		JobSystem::Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
@@ -184,7 +188,6 @@ namespace Vortex {
 			if (!m_MainThreadPreUpdateFunctionQueue.empty())
 			{
 				m_MainThreadPreUpdateFunctionQueue.execute();
-				m_MainThreadPreUpdateFunctionQueue.clear();
 			}
 
 			if (!m_ApplicationMinimized)
@@ -220,7 +223,6 @@ namespace Vortex {
 			if (!m_MainThreadPostUpdateFunctionQueue.empty())
 			{
 				m_MainThreadPostUpdateFunctionQueue.execute();
-				m_MainThreadPostUpdateFunctionQueue.clear();
 			}
 		}
 
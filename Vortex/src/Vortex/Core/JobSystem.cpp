@@ -0,0 +1,322 @@
+#include "vxpch.h"
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+
+namespace Vortex {
+
+	// Each worker owns a deque, it pushes and pops from the back
+	// while idle workers steal from the front of other workers' deques
+	struct WorkerQueue
+	{
+		std::deque<Job> Jobs;
+		std::mutex Mutex;
+	};
+
+	struct JobSystemInternalData
+	{
+		std::vector<std::thread> Workers;
+		std::vector<UniqueRef<WorkerQueue>> Queues;
+
+		std::atomic<uint32_t> QueuedJobs = 0;
+		std::atomic<uint32_t> NextQueue = 0;
+		std::atomic<bool> Running = false;
+
+		std::mutex SleepMutex;
+		std::condition_variable WakeCondition;
+	};
+
+	static JobSystemInternalData* s_Data = nullptr;
+
+	static constexpr uint32_t s_InvalidWorkerIndex = std::numeric_limits<uint32_t>::max();
+	static thread_local uint32_t s_WorkerIndex = s_InvalidWorkerIndex;
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		VX_PROFILE_FUNCTION();
+
+		VX_CORE_ASSERT(!s_Data, "Job System already initialized!");
+
+		if (workerCount == 0)
+		{
+			const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		s_Data = new JobSystemInternalData();
+		s_Data->Running = true;
+
+		s_Data->Queues.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			s_Data->Queues.emplace_back(CreateUnique<WorkerQueue>());
+		}
+
+		s_Data->Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			s_Data->Workers.emplace_back([i]() { WorkerThreadLoop(i); });
+		}
+
+		VX_CORE_INFO_TAG("Job System", "Initialized with {} worker threads", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (!s_Data)
+			return;
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Data->SleepMutex);
+			s_Data->Running = false;
+		}
+
+		s_Data->WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data->Workers)
+		{
+			if (!worker.joinable())
+				continue;
+
+			worker.join();
+		}
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void JobSystem::Submit(const JobFn& fn, JobCounter* counter)
+	{
+		Submit(fn, counter, nullptr);
+	}
+
+	void JobSystem::Submit(const JobFn& fn, JobCounter* counter, JobCounter* dependency)
+	{
+		Job job;
+		job.Fn = fn;
+		job.Counter = counter;
+
+		if (counter)
+		{
+			counter->m_PendingJobs.fetch_add(1, std::memory_order_acq_rel);
+		}
+
+		if (dependency)
+		{
+			std::scoped_lock<std::mutex> lock(dependency->m_ContinuationMutex);
+
+			// Defer the job until the dependency completes, FinishJob will push it
+			if (!dependency->IsComplete())
+			{
+				dependency->m_Continuations.push_back(job);
+				return;
+			}
+		}
+
+		PushJob(job);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, const ParallelForFn& fn, JobCounter* counter, uint32_t batchSize)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (count == 0)
+			return;
+
+		if (batchSize == 0)
+		{
+			// Aim for a few batches per worker so stealing can balance uneven work
+			const uint32_t targetBatches = Math::Max(GetWorkerCount(), 1u) * 4;
+			batchSize = Math::Max((count + targetBatches - 1) / targetBatches, 1u);
+		}
+
+		JobCounter localCounter;
+		JobCounter* batchCounter = counter ? counter : &localCounter;
+
+		for (uint32_t begin = 0; begin < count; begin += batchSize)
+		{
+			const uint32_t end = Math::Min(begin + batchSize, count);
+
+			Submit([fn, begin, end]()
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					fn(i);
+				}
+			}, batchCounter);
+		}
+
+		if (!counter)
+		{
+			Wait(localCounter);
+		}
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		VX_PROFILE_FUNCTION();
+
+		const uint32_t startIndex = IsWorkerThread() ? s_WorkerIndex : 0;
+
+		while (!counter.IsComplete())
+		{
+			if (TryExecuteJob(startIndex))
+				continue;
+
+			std::this_thread::yield();
+		}
+
+		// The last job may still be releasing the counter
+		std::scoped_lock<std::mutex> lock(counter.m_ContinuationMutex);
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		if (!s_Data)
+			return 0;
+
+		return (uint32_t)s_Data->Workers.size();
+	}
+
+	bool JobSystem::IsWorkerThread()
+	{
+		return s_WorkerIndex != s_InvalidWorkerIndex;
+	}
+
+	void JobSystem::WorkerThreadLoop(uint32_t workerIndex)
+	{
+		s_WorkerIndex = workerIndex;
+
+		while (s_Data->Running)
+		{
+			if (TryExecuteJob(workerIndex))
+				continue;
+
+			std::unique_lock<std::mutex> lock(s_Data->SleepMutex);
+			s_Data->WakeCondition.wait(lock, []()
+			{
+				return !s_Data->Running || s_Data->QueuedJobs.load(std::memory_order_acquire) > 0;
+			});
+		}
+
+		s_WorkerIndex = s_InvalidWorkerIndex;
+	}
+
+	void JobSystem::PushJob(const Job& job)
+	{
+		// Execute inline if the job system isn't running, this keeps tools and tests working
+		if (!s_Data || s_Data->Queues.empty())
+		{
+			job.Fn();
+			FinishJob(job);
+			return;
+		}
+
+		const uint32_t queueCount = (uint32_t)s_Data->Queues.size();
+		const uint32_t queueIndex = IsWorkerThread() ? s_WorkerIndex : s_Data->NextQueue.fetch_add(1, std::memory_order_relaxed) % queueCount;
+
+		WorkerQueue& queue = *s_Data->Queues[queueIndex];
+
+		// Counted before the job is visible, a thief popping it right away must never take the count below zero
+		s_Data->QueuedJobs.fetch_add(1, std::memory_order_acq_rel);
+
+		{
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+			queue.Jobs.push_back(job);
+		}
+
+		// Take the sleep mutex so a worker can't miss the wake up between checking and waiting
+		{
+			std::scoped_lock<std::mutex> lock(s_Data->SleepMutex);
+		}
+
+		s_Data->WakeCondition.notify_one();
+	}
+
+	bool JobSystem::TryPopJob(uint32_t startIndex, Job& job)
+	{
+		const uint32_t queueCount = (uint32_t)s_Data->Queues.size();
+
+		// Our own queue first, newest job is the most likely to be hot in cache
+		if (IsWorkerThread())
+		{
+			WorkerQueue& queue = *s_Data->Queues[s_WorkerIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+
+			if (!queue.Jobs.empty())
+			{
+				job = std::move(queue.Jobs.back());
+				queue.Jobs.pop_back();
+				return true;
+			}
+		}
+
+		// Steal the oldest job from somebody else
+		for (uint32_t i = 0; i < queueCount; i++)
+		{
+			const uint32_t queueIndex = (startIndex + i) % queueCount;
+
+			if (queueIndex == s_WorkerIndex)
+				continue;
+
+			WorkerQueue& queue = *s_Data->Queues[queueIndex];
+			std::scoped_lock<std::mutex> lock(queue.Mutex);
+
+			if (queue.Jobs.empty())
+				continue;
+
+			job = std::move(queue.Jobs.front());
+			queue.Jobs.pop_front();
+			return true;
+		}
+
+		return false;
+	}
+
+	bool JobSystem::TryExecuteJob(uint32_t startIndex)
+	{
+		if (!s_Data)
+			return false;
+
+		Job job;
+		if (!TryPopJob(startIndex, job))
+			return false;
+
+		s_Data->QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+
+		job.Fn();
+		FinishJob(job);
+
+		return true;
+	}
+
+	void JobSystem::FinishJob(const Job& job)
+	{
+		JobCounter* counter = job.Counter;
+
+		if (!counter)
+			return;
+
+		std::vector<Job> continuations;
+
+		// Decrement under the lock, Wait takes the same lock so the counter
+		// can't be destroyed while we're still touching it
+		{
+			std::scoped_lock<std::mutex> lock(counter->m_ContinuationMutex);
+
+			if (counter->m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+
+			continuations.swap(counter->m_Continuations);
+		}
+
+		for (const Job& continuation : continuations)
+		{
+			PushJob(continuation);
+		}
+	}
+
+}
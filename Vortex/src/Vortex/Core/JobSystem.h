@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include <functional>
+#include <atomic>
+#include <vector>
+#include <mutex>
+
+namespace Vortex {
+
+	class JobCounter;
+
+	using VORTEX_API JobFn = std::function<void()>;
+	using VORTEX_API ParallelForFn = std::function<void(uint32_t index)>;
+
+	struct VORTEX_API Job
+	{
+		JobFn Fn = nullptr;
+		JobCounter* Counter = nullptr;
+	};
+
+	// Tracks a group of submitted jobs, it can be waited on
+	// or passed as a dependency when submitting other jobs
+	class VORTEX_API JobCounter
+	{
+	public:
+		JobCounter() = default;
+		~JobCounter() = default;
+
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		VX_FORCE_INLINE bool IsComplete() const { return m_PendingJobs.load(std::memory_order_acquire) == 0; }
+		VX_FORCE_INLINE uint32_t GetPendingJobs() const { return m_PendingJobs.load(std::memory_order_acquire); }
+
+	private:
+		std::atomic<uint32_t> m_PendingJobs = 0;
+
+		// Jobs waiting on this counter to reach zero
+		mutable std::mutex m_ContinuationMutex;
+		std::vector<Job> m_Continuations;
+
+	private:
+		friend class JobSystem;
+	};
+
+	class VORTEX_API JobSystem
+	{
+	public:
+		// A worker count of zero will use one worker per hardware thread, minus the main thread
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static void Submit(const JobFn& fn, JobCounter* counter = nullptr);
+		static void Submit(const JobFn& fn, JobCounter* counter, JobCounter* dependency);
+
+		// Splits [0, count) into batches and invokes fn for every index,
+		// blocks until all batches complete if no counter is provided
+		static void ParallelFor(uint32_t count, const ParallelForFn& fn, JobCounter* counter = nullptr, uint32_t batchSize = 0);
+
+		// The calling thread executes queued jobs while it waits
+		static void Wait(const JobCounter& counter);
+
+		static uint32_t GetWorkerCount();
+		static bool IsWorkerThread();
+
+	private:
+		static void WorkerThreadLoop(uint32_t workerIndex);
+
+		static void PushJob(const Job& job);
+		static bool TryPopJob(uint32_t startIndex, Job& job);
+		static bool TryExecuteJob(uint32_t startIndex);
+		static void FinishJob(const Job& job);
+	};
+
+}
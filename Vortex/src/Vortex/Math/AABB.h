@@ -16,6 +16,47 @@ namespace Vortex::Math {
 
 		AABB(const Math::vec3& min, const Math::vec3& max)
 			: Min(min), Max(max) { }
+
+		VX_FORCE_INLINE Math::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		VX_FORCE_INLINE Math::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		VX_FORCE_INLINE float GetSurfaceArea() const
+		{
+			const Math::vec3 size = Max - Min;
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		VX_FORCE_INLINE bool Contains(const AABB& other) const
+		{
+			return Min.x <= other.Min.x && Min.y <= other.Min.y && Min.z <= other.Min.z
+				&& Max.x >= other.Max.x && Max.y >= other.Max.y && Max.z >= other.Max.z;
+		}
+
+		VX_FORCE_INLINE bool Overlaps(const AABB& other) const
+		{
+			return Min.x <= other.Max.x && Min.y <= other.Max.y && Min.z <= other.Max.z
+				&& Max.x >= other.Min.x && Max.y >= other.Min.y && Max.z >= other.Min.z;
+		}
+
+		VX_FORCE_INLINE static AABB Union(const AABB& a, const AABB& b)
+		{
+			return AABB(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+		}
+
+		// Transforms the box and returns the axis aligned box that encloses the result
+		VX_FORCE_INLINE AABB Transform(const Math::mat4& transform) const
+		{
+			const Math::vec3 center = Math::vec3(transform * Math::vec4(GetCenter(), 1.0f));
+			const Math::vec3 extents = GetExtents();
+
+			Math::vec3 worldExtents(0.0f);
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				worldExtents += glm::abs(Math::vec3(transform[i])) * extents[i];
+			}
+
+			return AABB(center - worldExtents, center + worldExtents);
+		}
 	};
 
 }
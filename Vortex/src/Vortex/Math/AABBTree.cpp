@@ -0,0 +1,320 @@
+#include "vxpch.h"
+#include "AABBTree.h"
+
+namespace Vortex::Math {
+
+	namespace Utils {
+
+		static AABB FattenAABB(const AABB& aabb)
+		{
+			// Grow by a fraction of the size so large and small meshes get a similar amount of slack
+			const Math::vec3 margin = (aabb.Max - aabb.Min) * 0.1f + Math::vec3(0.1f);
+			return AABB(aabb.Min - margin, aabb.Max + margin);
+		}
+
+	}
+
+	int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, uint32_t userData)
+	{
+		const int32_t proxyID = AllocateNode();
+
+		TreeNode& node = m_Nodes[proxyID];
+		node.Box = Utils::FattenAABB(aabb);
+		node.UserData = userData;
+		node.Height = 0;
+
+		InsertLeaf(proxyID);
+		m_ProxyCount++;
+
+		return proxyID;
+	}
+
+	void DynamicAABBTree::DestroyProxy(int32_t proxyID)
+	{
+		VX_CORE_ASSERT(proxyID >= 0 && proxyID < (int32_t)m_Nodes.size(), "Invalid proxy!");
+		VX_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy must be a leaf node!");
+
+		RemoveLeaf(proxyID);
+		FreeNode(proxyID);
+		m_ProxyCount--;
+	}
+
+	bool DynamicAABBTree::MoveProxy(int32_t proxyID, const AABB& aabb)
+	{
+		VX_CORE_ASSERT(proxyID >= 0 && proxyID < (int32_t)m_Nodes.size(), "Invalid proxy!");
+		VX_CORE_ASSERT(m_Nodes[proxyID].IsLeaf(), "Proxy must be a leaf node!");
+
+		TreeNode& node = m_Nodes[proxyID];
+
+		// Still enclosed by the fat box, unless it shrank a lot there's nothing to do
+		if (node.Box.Contains(aabb))
+		{
+			const AABB fatAABB = Utils::FattenAABB(aabb);
+			const AABB hugeAABB = Utils::FattenAABB(fatAABB);
+
+			if (hugeAABB.Contains(node.Box))
+				return false;
+		}
+
+		RemoveLeaf(proxyID);
+		m_Nodes[proxyID].Box = Utils::FattenAABB(aabb);
+		InsertLeaf(proxyID);
+
+		return true;
+	}
+
+	void DynamicAABBTree::Clear()
+	{
+		m_Nodes.clear();
+		m_Root = NullNode;
+		m_FreeList = NullNode;
+		m_ProxyCount = 0;
+	}
+
+	int32_t DynamicAABBTree::AllocateNode()
+	{
+		if (m_FreeList == NullNode)
+		{
+			m_Nodes.emplace_back();
+			return (int32_t)m_Nodes.size() - 1;
+		}
+
+		const int32_t nodeID = m_FreeList;
+		TreeNode& node = m_Nodes[nodeID];
+		m_FreeList = node.Next;
+
+		node = TreeNode();
+		return nodeID;
+	}
+
+	void DynamicAABBTree::FreeNode(int32_t nodeID)
+	{
+		TreeNode& node = m_Nodes[nodeID];
+		node.Next = m_FreeList;
+		node.Height = -1;
+		m_FreeList = nodeID;
+	}
+
+	void DynamicAABBTree::InsertLeaf(int32_t leafID)
+	{
+		if (m_Root == NullNode)
+		{
+			m_Root = leafID;
+			m_Nodes[m_Root].Parent = NullNode;
+			return;
+		}
+
+		// Find the best sibling using the surface area heuristic
+		const AABB leafAABB = m_Nodes[leafID].Box;
+		int32_t index = m_Root;
+
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const TreeNode& node = m_Nodes[index];
+			const int32_t child1 = node.Child1;
+			const int32_t child2 = node.Child2;
+
+			const float area = node.Box.GetSurfaceArea();
+			const float combinedArea = AABB::Union(node.Box, leafAABB).GetSurfaceArea();
+
+			// Cost of creating a new parent for this node and the new leaf
+			const float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto descendCost = [&](int32_t childID)
+			{
+				const TreeNode& child = m_Nodes[childID];
+				const float unionArea = AABB::Union(leafAABB, child.Box).GetSurfaceArea();
+
+				if (child.IsLeaf())
+					return unionArea + inheritanceCost;
+
+				return (unionArea - child.Box.GetSurfaceArea()) + inheritanceCost;
+			};
+
+			const float cost1 = descendCost(child1);
+			const float cost2 = descendCost(child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		const int32_t sibling = index;
+
+		// Create a new parent
+		const int32_t oldParent = m_Nodes[sibling].Parent;
+		const int32_t newParent = AllocateNode();
+
+		{
+			TreeNode& parentNode = m_Nodes[newParent];
+			parentNode.Parent = oldParent;
+			parentNode.Box = AABB::Union(leafAABB, m_Nodes[sibling].Box);
+			parentNode.Height = m_Nodes[sibling].Height + 1;
+			parentNode.Child1 = sibling;
+			parentNode.Child2 = leafID;
+		}
+
+		if (oldParent != NullNode)
+		{
+			if (m_Nodes[oldParent].Child1 == sibling)
+				m_Nodes[oldParent].Child1 = newParent;
+			else
+				m_Nodes[oldParent].Child2 = newParent;
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leafID].Parent = newParent;
+
+		// Walk back up the tree fixing heights and boxes
+		index = m_Nodes[leafID].Parent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			TreeNode& node = m_Nodes[index];
+			const TreeNode& child1 = m_Nodes[node.Child1];
+			const TreeNode& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + Math::Max(child1.Height, child2.Height);
+			node.Box = AABB::Union(child1.Box, child2.Box);
+
+			index = node.Parent;
+		}
+	}
+
+	void DynamicAABBTree::RemoveLeaf(int32_t leafID)
+	{
+		if (leafID == m_Root)
+		{
+			m_Root = NullNode;
+			return;
+		}
+
+		const int32_t parent = m_Nodes[leafID].Parent;
+		const int32_t grandParent = m_Nodes[parent].Parent;
+		const int32_t sibling = m_Nodes[parent].Child1 == leafID ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		if (grandParent == NullNode)
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].Parent = NullNode;
+			FreeNode(parent);
+			return;
+		}
+
+		// Destroy the parent and connect the sibling to the grand parent
+		if (m_Nodes[grandParent].Child1 == parent)
+			m_Nodes[grandParent].Child1 = sibling;
+		else
+			m_Nodes[grandParent].Child2 = sibling;
+
+		m_Nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+
+		int32_t index = grandParent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			TreeNode& node = m_Nodes[index];
+			const TreeNode& child1 = m_Nodes[node.Child1];
+			const TreeNode& child2 = m_Nodes[node.Child2];
+
+			node.Box = AABB::Union(child1.Box, child2.Box);
+			node.Height = 1 + Math::Max(child1.Height, child2.Height);
+
+			index = node.Parent;
+		}
+	}
+
+	int32_t DynamicAABBTree::Balance(int32_t iA)
+	{
+		// Performs a left or right rotation if node A is imbalanced, returns the new subtree root
+		TreeNode* A = &m_Nodes[iA];
+		if (A->IsLeaf() || A->Height < 2)
+			return iA;
+
+		const int32_t iB = A->Child1;
+		const int32_t iC = A->Child2;
+		TreeNode* B = &m_Nodes[iB];
+		TreeNode* C = &m_Nodes[iC];
+
+		const int32_t balance = C->Height - B->Height;
+
+		auto rotate = [&](int32_t iUp, TreeNode* up, int32_t iOther, TreeNode* other, bool upIsChild2)
+		{
+			const int32_t iF = up->Child1;
+			const int32_t iG = up->Child2;
+			TreeNode* F = &m_Nodes[iF];
+			TreeNode* G = &m_Nodes[iG];
+
+			// Swap A and the raised child
+			up->Child1 = iA;
+			up->Parent = A->Parent;
+			A->Parent = iUp;
+
+			if (up->Parent != NullNode)
+			{
+				if (m_Nodes[up->Parent].Child1 == iA)
+					m_Nodes[up->Parent].Child1 = iUp;
+				else
+					m_Nodes[up->Parent].Child2 = iUp;
+			}
+			else
+			{
+				m_Root = iUp;
+			}
+
+			// Keep the taller grandchild under the raised node
+			int32_t iKeep = iF, iMove = iG;
+			TreeNode* keep = F;
+			TreeNode* move = G;
+
+			if (F->Height <= G->Height)
+			{
+				iKeep = iG; iMove = iF;
+				keep = G; move = F;
+			}
+
+			up->Child2 = iKeep;
+
+			if (upIsChild2)
+				A->Child2 = iMove;
+			else
+				A->Child1 = iMove;
+
+			move->Parent = iA;
+
+			A->Box = AABB::Union(other->Box, move->Box);
+			up->Box = AABB::Union(A->Box, keep->Box);
+
+			A->Height = 1 + Math::Max(other->Height, move->Height);
+			up->Height = 1 + Math::Max(A->Height, keep->Height);
+		};
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			rotate(iC, C, iB, B, true);
+			return iC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			rotate(iB, B, iC, C, false);
+			return iB;
+		}
+
+		return iA;
+	}
+
+}
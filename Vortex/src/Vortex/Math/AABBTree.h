@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Math/Math.h"
+#include "Vortex/Math/AABB.h"
+#include "Vortex/Math/Frustum.h"
+
+#include <vector>
+
+namespace Vortex::Math {
+
+	// Incrementally updated bounding volume hierarchy, leaves store a fattened
+	// box so small movements don't require the proxy to be reinserted
+	class VORTEX_API DynamicAABBTree
+	{
+	public:
+		static constexpr int32_t NullNode = -1;
+
+	public:
+		DynamicAABBTree() = default;
+		~DynamicAABBTree() = default;
+
+		int32_t CreateProxy(const AABB& aabb, uint32_t userData);
+		void DestroyProxy(int32_t proxyID);
+
+		// Returns true if the proxy had to be reinserted
+		bool MoveProxy(int32_t proxyID, const AABB& aabb);
+
+		void Clear();
+
+		VX_FORCE_INLINE uint32_t GetUserData(int32_t proxyID) const { return m_Nodes[proxyID].UserData; }
+		VX_FORCE_INLINE const AABB& GetFatAABB(int32_t proxyID) const { return m_Nodes[proxyID].Box; }
+		VX_FORCE_INLINE uint32_t GetProxyCount() const { return m_ProxyCount; }
+
+		// Invokes callback(userData) for every proxy that may be inside the frustum
+		template <typename TCallback>
+		void Query(const Frustum& frustum, TCallback&& callback) const
+		{
+			if (m_Root == NullNode)
+				return;
+
+			m_QueryStack.clear();
+			m_QueryStack.push_back({ m_Root, false });
+
+			while (!m_QueryStack.empty())
+			{
+				const QueryEntry entry = m_QueryStack.back();
+				m_QueryStack.pop_back();
+
+				const TreeNode& node = m_Nodes[entry.NodeID];
+				bool inside = entry.Inside;
+
+				// Once a node is fully inside the frustum its subtree doesn't need testing
+				if (!inside)
+				{
+					const FrustumTestResult result = frustum.Classify(node.Box);
+
+					if (result == FrustumTestResult::Outside)
+						continue;
+
+					inside = result == FrustumTestResult::Inside;
+				}
+
+				if (node.IsLeaf())
+				{
+					callback(node.UserData);
+					continue;
+				}
+
+				m_QueryStack.push_back({ node.Child1, inside });
+				m_QueryStack.push_back({ node.Child2, inside });
+			}
+		}
+
+	private:
+		int32_t AllocateNode();
+		void FreeNode(int32_t nodeID);
+
+		void InsertLeaf(int32_t leafID);
+		void RemoveLeaf(int32_t leafID);
+		int32_t Balance(int32_t nodeID);
+
+	private:
+		struct TreeNode
+		{
+			AABB Box;
+			uint32_t UserData = 0;
+
+			union
+			{
+				int32_t Parent;
+				int32_t Next;
+			};
+
+			int32_t Child1 = NullNode;
+			int32_t Child2 = NullNode;
+
+			// Leaf = 0, free node = -1
+			int32_t Height = -1;
+
+			TreeNode() : Parent(NullNode) { }
+
+			VX_FORCE_INLINE bool IsLeaf() const { return Child1 == NullNode; }
+		};
+
+		struct QueryEntry
+		{
+			int32_t NodeID;
+			bool Inside;
+		};
+
+		std::vector<TreeNode> m_Nodes;
+		int32_t m_Root = NullNode;
+		int32_t m_FreeList = NullNode;
+		uint32_t m_ProxyCount = 0;
+
+		mutable std::vector<QueryEntry> m_QueryStack;
+	};
+
+}
@@ -0,0 +1,64 @@
+#include "vxpch.h"
+#include "Frustum.h"
+
+namespace Vortex::Math {
+
+	Frustum::Frustum(const Math::mat4& viewProjection)
+	{
+		// Gribb-Hartmann plane extraction, glm matrices are column major
+		const Math::vec4 row0 = Math::vec4(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+		const Math::vec4 row1 = Math::vec4(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+		const Math::vec4 row2 = Math::vec4(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+		const Math::vec4 row3 = Math::vec4(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+		Planes[0] = row3 + row0;
+		Planes[1] = row3 - row0;
+		Planes[2] = row3 + row1;
+		Planes[3] = row3 - row1;
+		Planes[4] = row3 + row2;
+		Planes[5] = row3 - row2;
+
+		for (Math::vec4& plane : Planes)
+		{
+			const float length = Math::Length(Math::vec3(plane));
+
+			if (length > 0.0f)
+			{
+				plane /= length;
+			}
+		}
+	}
+
+	bool Frustum::Intersects(const Math::AABB& aabb) const
+	{
+		return Classify(aabb) != FrustumTestResult::Outside;
+	}
+
+	FrustumTestResult Frustum::Classify(const Math::AABB& aabb) const
+	{
+		const Math::vec3 center = aabb.GetCenter();
+		const Math::vec3 extents = aabb.GetExtents();
+
+		FrustumTestResult result = FrustumTestResult::Inside;
+
+		for (const Math::vec4& plane : Planes)
+		{
+			const Math::vec3 normal = Math::vec3(plane);
+
+			// Projected radius of the box onto the plane normal
+			const float radius = Math::Dot(glm::abs(normal), extents);
+			const float distance = Math::Dot(normal, center) + plane.w;
+
+			if (distance < -radius)
+				return FrustumTestResult::Outside;
+
+			if (distance < radius)
+			{
+				result = FrustumTestResult::Intersects;
+			}
+		}
+
+		return result;
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Math/Math.h"
+#include "Vortex/Math/AABB.h"
+
+namespace Vortex::Math {
+
+	enum class VORTEX_API FrustumTestResult
+	{
+		Outside = 0, Intersects, Inside,
+	};
+
+	struct VORTEX_API Frustum
+	{
+		// Left, Right, Bottom, Top, Near, Far
+		// xyz is the inward facing normal, w is the distance
+		Math::vec4 Planes[6];
+
+		Frustum() = default;
+		Frustum(const Math::mat4& viewProjection);
+
+		bool Intersects(const Math::AABB& aabb) const;
+		FrustumTestResult Classify(const Math::AABB& aabb) const;
+	};
+
+}
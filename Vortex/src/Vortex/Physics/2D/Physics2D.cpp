@@ -12,6 +12,8 @@
 
 #include <mono/jit/jit.h>
 
+#include <chrono>
+
 namespace Vortex {
 
 	namespace Utils {
@@ -29,6 +31,117 @@ namespace Vortex {
 			return b2_staticBody;
 		}
 
+		using Clock = std::chrono::steady_clock;
+
+		static float GetElapsedMilliseconds(Clock::time_point start)
+		{
+			return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+		}
+
+		static PhysicsBody2DState& GetBodyState(b2Body* body)
+		{
+			return *reinterpret_cast<PhysicsBody2DState*>(body->GetUserData().pointer);
+		}
+
+		// Returns true if anything changed, unchanged values are left alone so Box2D keeps its caches
+		static bool PushChangedBodyProperties(const RigidBody2DComponent& rigidbody, b2Body* body, PhysicsBody2DState& state)
+		{
+			bool changed = false;
+
+			// Write back keeps the component velocities in step with Box2D, so a difference here was made by the user
+			if (rigidbody.Velocity != state.PushedVelocity)
+			{
+				body->SetLinearVelocity({ rigidbody.Velocity.x, rigidbody.Velocity.y });
+				state.PushedVelocity = rigidbody.Velocity;
+				changed = true;
+			}
+
+			if (rigidbody.Drag != state.PushedDrag)
+			{
+				body->SetLinearDamping(rigidbody.Drag);
+				state.PushedDrag = rigidbody.Drag;
+				changed = true;
+			}
+
+			if (rigidbody.AngularVelocity != state.PushedAngularVelocity)
+			{
+				body->SetAngularVelocity(rigidbody.AngularVelocity);
+				state.PushedAngularVelocity = rigidbody.AngularVelocity;
+				changed = true;
+			}
+
+			if (rigidbody.AngularDrag != state.PushedAngularDrag)
+			{
+				body->SetAngularDamping(rigidbody.AngularDrag);
+				state.PushedAngularDrag = rigidbody.AngularDrag;
+				changed = true;
+			}
+
+			if (rigidbody.GravityScale != state.PushedGravityScale)
+			{
+				body->SetGravityScale(rigidbody.GravityScale);
+				state.PushedGravityScale = rigidbody.GravityScale;
+				changed = true;
+			}
+
+			if (rigidbody.FixedRotation != state.PushedFixedRotation)
+			{
+				body->SetFixedRotation(rigidbody.FixedRotation);
+				state.PushedFixedRotation = rigidbody.FixedRotation;
+				changed = true;
+			}
+
+			return changed;
+		}
+
+		template <typename TCollider>
+		static bool PushChangedFixtureProperties(const TCollider& collider, bool isSensor)
+		{
+			b2Fixture* fixture = (b2Fixture*)collider.RuntimeFixture;
+			PhysicsBody2DData* physicsBodyData = reinterpret_cast<PhysicsBody2DData*>(fixture->GetUserData().pointer);
+
+			bool changed = false;
+
+			if (collider.Density != physicsBodyData->PushedDensity)
+			{
+				fixture->SetDensity(collider.Density);
+				// Density only takes effect once the mass is recomputed
+				fixture->GetBody()->ResetMassData();
+				physicsBodyData->PushedDensity = collider.Density;
+				changed = true;
+			}
+
+			if (collider.Friction != physicsBodyData->PushedFriction)
+			{
+				fixture->SetFriction(collider.Friction);
+				physicsBodyData->PushedFriction = collider.Friction;
+				changed = true;
+			}
+
+			if (collider.Restitution != physicsBodyData->PushedRestitution)
+			{
+				fixture->SetRestitution(collider.Restitution);
+				physicsBodyData->PushedRestitution = collider.Restitution;
+				changed = true;
+			}
+
+			if (collider.RestitutionThreshold != physicsBodyData->PushedRestitutionThreshold)
+			{
+				fixture->SetRestitutionThreshold(collider.RestitutionThreshold);
+				physicsBodyData->PushedRestitutionThreshold = collider.RestitutionThreshold;
+				changed = true;
+			}
+
+			if (isSensor != physicsBodyData->PushedIsSensor)
+			{
+				fixture->SetSensor(isSensor);
+				physicsBodyData->PushedIsSensor = isSensor;
+				changed = true;
+			}
+
+			return changed;
+		}
+
 	}
 
 	RaycastHit2D::RaycastHit2D(const RaycastCallback2D* raycastInfo, Scene* contextScene)
@@ -56,13 +169,14 @@ namespace Vortex {
 	void Physics2D::OnSimulationStart(Scene* contextScene)
 	{
 		s_PhysicsScene = new b2World({ s_PhysicsWorld2DGravity.x, s_PhysicsWorld2DGravity.y });
+		s_Accumulator = 0.0f;
 
 		auto view = contextScene->GetAllActorsWith<RigidBody2DComponent>();
 
 		for (const auto e : view)
 		{
 			Actor entity{ e, contextScene };
-			auto transform = contextScene->GetWorldSpaceTransform(entity);
+			auto transform = contextScene->GetCachedWorldSpaceTransform(entity);
 			auto& rb2d = entity.GetComponent<RigidBody2DComponent>();
 
 			CreatePhysicsBody(entity, transform, rb2d);
@@ -71,95 +185,220 @@ namespace Vortex {
 
 	void Physics2D::OnSimulationUpdate(TimeStep delta, Scene* contextScene)
 	{
+		VX_PROFILE_FUNCTION();
+
 		s_PhysicsScene->SetGravity({ s_PhysicsWorld2DGravity.x, s_PhysicsWorld2DGravity.y });
 
 		s_ContextScene = contextScene;
+		s_StepTimings = Physics2DStepTimings();
 
 		// Physics
 		{
-			// Copy transform from Vortex to Box2D
-			auto view = contextScene->GetAllActorsWith<TransformComponent, RigidBody2DComponent>();
+			Utils::Clock::time_point start = Utils::Clock::now();
 
-			for (const auto e : view)
+			// If a rigidbody component is added during runtime we can create the physics body here
+			for (const UUID actorUUID : s_PendingBodyActors)
 			{
-				Actor entity = { e, contextScene };
-				auto& transform = entity.GetComponent<TransformComponent>();
+				Actor entity = contextScene->TryGetActorWithUUID(actorUUID);
+				if (!entity || !entity.HasComponent<RigidBody2DComponent>())
+					continue;
+
 				RigidBody2DComponent& rigidbody = entity.GetComponent<RigidBody2DComponent>();
+				if (rigidbody.RuntimeBody)
+					continue;
 
-				// If a rigidbody component is added during runtime we can create the physics body here
-				if (!rigidbody.RuntimeBody)
-				{
-					CreatePhysicsBody(entity, transform, rigidbody);
-				}
+				CreatePhysicsBody(entity, entity.GetTransform(), rigidbody);
+			}
+
+			s_PendingBodyActors.clear();
 
-				b2Body* body = (b2Body*)rigidbody.RuntimeBody;
-				Math::vec3 translation = transform.Translation;
-				float angle = transform.GetRotationEuler().z;
+			// Push engine side changes to Box2D, only marked bodies are visited so untouched ones can keep sleeping
+			for (b2Body* body : s_DirtyBodies)
+			{
+				PhysicsBody2DState& state = Utils::GetBodyState(body);
+				state.PendingPush = false;
 
-				const auto& bodyPosition = body->GetPosition();
-				const float bodyAngle = body->GetAngle();
+				Actor entity{ state.ActorHandle, contextScene };
+				const TransformComponent& transform = entity.GetTransform();
+				const RigidBody2DComponent& rigidbody = entity.GetComponent<RigidBody2DComponent>();
 
-				const bool awake = bodyPosition.x != translation.x || bodyPosition.y != translation.y || bodyAngle != angle;
-				body->SetAwake(awake);// TODO fix this
+				const Math::vec3& translation = transform.Translation;
+				const float angle = transform.GetRotationEuler().z;
 
-				body->SetTransform({ translation.x, translation.y }, angle);
-				if (rigidbody.Velocity != Math::vec2(0.0f))
+				// The transform holds an interpolated pose, only push it back if something else moved the actor
+				const bool moved = translation.x != state.WrittenPosition.x || translation.y != state.WrittenPosition.y || angle != state.WrittenAngle;
+				if (moved)
 				{
-					body->SetLinearVelocity({ rigidbody.Velocity.x, rigidbody.Velocity.y });
+					body->SetTransform({ translation.x, translation.y }, angle);
+
+					state.PreviousPosition = state.WrittenPosition = Math::vec2(translation.x, translation.y);
+					state.PreviousAngle = state.WrittenAngle = angle;
 				}
-				body->SetLinearDamping(rigidbody.Drag);
-				body->SetAngularVelocity(rigidbody.AngularVelocity);
-				body->SetAngularDamping(rigidbody.AngularDrag);
-				body->SetGravityScale(rigidbody.GravityScale);
-				body->SetFixedRotation(rigidbody.FixedRotation);
+
+				bool changed = Utils::PushChangedBodyProperties(rigidbody, body, state);
 
 				if (entity.HasComponent<BoxCollider2DComponent>())
 				{
 					const auto& bc2d = entity.GetComponent<BoxCollider2DComponent>();
-					b2Fixture* fixture = (b2Fixture*)bc2d.RuntimeFixture;
-
-					fixture->SetDensity(bc2d.Density);
-					fixture->SetFriction(bc2d.Friction);
-					fixture->SetRestitution(bc2d.Restitution);
-					fixture->SetRestitutionThreshold(bc2d.RestitutionThreshold);
-					fixture->SetSensor(bc2d.IsTrigger);
+					changed |= Utils::PushChangedFixtureProperties(bc2d, bc2d.IsTrigger);
 				}
 
 				if (entity.HasComponent<CircleCollider2DComponent>())
 				{
 					const auto& cc2d = entity.GetComponent<CircleCollider2DComponent>();
-					b2Fixture* fixture = (b2Fixture*)cc2d.RuntimeFixture;
+					changed |= Utils::PushChangedFixtureProperties(cc2d, false);
+				}
+
+				if (moved || changed)
+				{
+					body->SetAwake(true);
+				}
+			}
+
+			s_DirtyBodies.clear();
+
+			s_StepTimings.Push = Utils::GetElapsedMilliseconds(start);
+			start = Utils::Clock::now();
+
+			// Step the world at a fixed rate, carrying the remainder over to the next frame
+			const float fixedTimeStep = 1.0f / (float)s_PhysicsWorld2DTickRate;
+			s_Accumulator += delta;
+
+			uint32_t substeps = 0;
+			while (s_Accumulator >= fixedTimeStep && substeps < s_PhysicsWorld2DMaxSubsteps)
+			{
+				// Sleeping bodies don't move, their previous pose is still valid
+				for (b2Body* body = s_PhysicsScene->GetBodyList(); body != nullptr; body = body->GetNext())
+				{
+					if (body->GetType() == b2_staticBody || !body->IsAwake())
+						continue;
 
-					fixture->SetDensity(cc2d.Density);
-					fixture->SetFriction(cc2d.Friction);
-					fixture->SetRestitution(cc2d.Restitution);
-					fixture->SetRestitutionThreshold(cc2d.RestitutionThreshold);
+					PhysicsBody2DState& state = Utils::GetBodyState(body);
+					const b2Vec2& position = body->GetPosition();
+					state.PreviousPosition = Math::vec2(position.x, position.y);
+					state.PreviousAngle = body->GetAngle();
 				}
+
+				s_PhysicsScene->Step(fixedTimeStep, s_PhysicsWorld2DVeloctityIterations, s_PhysicsWorld2DPositionIterations);
+
+				s_Accumulator -= fixedTimeStep;
+				substeps++;
 			}
 
-			s_PhysicsScene->Step(delta, s_PhysicsWorld2DVeloctityIterations, s_PhysicsWorld2DPositionIterations);
+			// Drop whatever we couldn't catch up on instead of spiraling on the next frame
+			if (s_Accumulator >= fixedTimeStep)
+			{
+				s_Accumulator = fmod(s_Accumulator, fixedTimeStep);
+			}
+
+			s_StepTimings.Simulate = Utils::GetElapsedMilliseconds(start);
+			s_StepTimings.Substeps = substeps;
+			start = Utils::Clock::now();
+
+			const float alpha = s_Accumulator / fixedTimeStep;
 
-			// Get transform from Box2D
-			for (const auto e : view)
+			// Get transform from Box2D, blended between the last two steps
+			// Only awake bodies are written, plus one final write when a body falls asleep
+			for (b2Body* body = s_PhysicsScene->GetBodyList(); body != nullptr; body = body->GetNext())
 			{
-				Actor entity{ e, contextScene };
+				if (body->GetType() == b2_staticBody)
+					continue;
+
+				PhysicsBody2DState& state = Utils::GetBodyState(body);
+				const b2Vec2& bodyPosition = body->GetPosition();
+
+				if (body->IsAwake())
+				{
+					state.NeedsWriteback = true;
+				}
+				else
+				{
+					if (!state.NeedsWriteback)
+						continue;
+
+					// Snap to the resting pose so the last write isn't left mid interpolation
+					state.PreviousPosition = Math::vec2(bodyPosition.x, bodyPosition.y);
+					state.PreviousAngle = body->GetAngle();
+					state.NeedsWriteback = false;
+				}
+
+				Actor entity{ state.ActorHandle, contextScene };
 				auto& transform = entity.GetComponent<TransformComponent>();
-				const auto& rigidbody = entity.GetComponent<RigidBody2DComponent>();
+				auto& rigidbody = entity.GetComponent<RigidBody2DComponent>();
+
+				// Bodies replaced by a body type change are no longer driving the actor
+				if (rigidbody.RuntimeBody != body)
+					continue;
+
+				const Math::vec2 position = Math::Mix(state.PreviousPosition, Math::vec2(bodyPosition.x, bodyPosition.y), alpha);
+				const float angle = Math::Mix(state.PreviousAngle, body->GetAngle(), alpha);
 
-				b2Body* body = (b2Body*)rigidbody.RuntimeBody;
-				const auto& position = body->GetPosition();
 				transform.Translation = Math::vec3(position.x, position.y, transform.Translation.z);
 				const auto& rotation = transform.GetRotationEuler();
-				transform.SetRotationEuler({ rotation.x, rotation.y, body->GetAngle() });
+				transform.SetRotationEuler({ rotation.x, rotation.y, angle });
+
+				state.WrittenPosition = position;
+				state.WrittenAngle = transform.GetRotationEuler().z;
+
+				// Scripts read the simulated velocities, and the next push won't mistake them for user changes
+				const b2Vec2& velocity = body->GetLinearVelocity();
+				rigidbody.Velocity = state.PushedVelocity = Math::vec2(velocity.x, velocity.y);
+				rigidbody.AngularVelocity = state.PushedAngularVelocity = body->GetAngularVelocity();
 			}
+
+			s_StepTimings.Writeback = Utils::GetElapsedMilliseconds(start);
 		}
 	}
 
+	void Physics2D::RT_TeleportBody(b2Body* body, const TransformComponent& transform)
+	{
+		const Math::vec3& translation = transform.Translation;
+		const float angle = transform.GetRotationEuler().z;
+
+		body->SetTransform({ translation.x, translation.y }, angle);
+		body->SetAwake(true);
+
+		// Start the next blend from the new pose, matching the written pose keeps the push phase from moving it again
+		PhysicsBody2DState& state = Utils::GetBodyState(body);
+		state.PreviousPosition = state.WrittenPosition = Math::vec2(translation.x, translation.y);
+		state.PreviousAngle = state.WrittenAngle = angle;
+		state.NeedsWriteback = true;
+	}
+
+	void Physics2D::MarkBodyDirty(Actor actor)
+	{
+		if (!s_PhysicsScene || !actor.HasComponent<RigidBody2DComponent>())
+			return;
+
+		b2Body* body = (b2Body*)actor.GetComponent<RigidBody2DComponent>().RuntimeBody;
+		if (!body)
+			return;
+
+		PhysicsBody2DState& state = Utils::GetBodyState(body);
+		if (state.PendingPush)
+			return;
+
+		state.PendingPush = true;
+		s_DirtyBodies.push_back(body);
+	}
+
+	void Physics2D::QueueBodyCreation(Actor actor)
+	{
+		if (!s_PhysicsScene)
+			return;
+
+		s_PendingBodyActors.push_back(actor.GetUUID());
+	}
+
 	void Physics2D::OnSimulationStop()
 	{
 		delete s_PhysicsScene;
 		s_PhysicsScene = nullptr;
 		s_PhysicsBodyDataMap.clear();
+		s_PhysicsBodyStateMap.clear();
+		s_DirtyBodies.clear();
+		s_PendingBodyActors.clear();
+		s_Accumulator = 0.0f;
 		s_ContextScene = nullptr;
 	}
 
@@ -189,6 +428,7 @@ namespace Vortex {
 		bodyDef.linearVelocity = b2Vec2(rb2d.Velocity.x, rb2d.Velocity.y);
 		bodyDef.linearDamping = rb2d.Drag;
 		bodyDef.angularDamping = rb2d.AngularDrag;
+		bodyDef.angularVelocity = rb2d.AngularVelocity;
 		bodyDef.gravityScale = rb2d.GravityScale;
 		bodyDef.angle = transform.GetRotationEuler().z;
 
@@ -196,6 +436,20 @@ namespace Vortex {
 
 		rb2d.RuntimeBody = body;
 
+		PhysicsBody2DState& state = s_PhysicsBodyStateMap[body];
+		state.ActorHandle = entity;
+		state.PreviousPosition = state.WrittenPosition = Math::vec2(bodyDef.position.x, bodyDef.position.y);
+		state.PreviousAngle = state.WrittenAngle = bodyDef.angle;
+		state.PushedVelocity = rb2d.Velocity;
+		state.PushedDrag = rb2d.Drag;
+		state.PushedAngularVelocity = rb2d.AngularVelocity;
+		state.PushedAngularDrag = rb2d.AngularDrag;
+		state.PushedGravityScale = rb2d.GravityScale;
+		state.PushedFixedRotation = rb2d.FixedRotation;
+
+		// Map nodes never move, so the body can point straight at its state
+		body->GetUserData().pointer = reinterpret_cast<uintptr_t>(&state);
+
 		if (entity.HasComponent<BoxCollider2DComponent>())
 		{
 			auto& bc2d = entity.GetComponent<BoxCollider2DComponent>();
@@ -217,6 +471,12 @@ namespace Vortex {
 			fixtureDef.restitution = bc2d.Restitution;
 			fixtureDef.restitutionThreshold = bc2d.RestitutionThreshold;
 
+			physicsBodyData->PushedIsSensor = bc2d.IsTrigger;
+			physicsBodyData->PushedDensity = bc2d.Density;
+			physicsBodyData->PushedFriction = bc2d.Friction;
+			physicsBodyData->PushedRestitution = bc2d.Restitution;
+			physicsBodyData->PushedRestitutionThreshold = bc2d.RestitutionThreshold;
+
 			b2Fixture* fixture = body->CreateFixture(&fixtureDef);
 
 			bc2d.RuntimeFixture = fixture;
@@ -246,6 +506,11 @@ namespace Vortex {
 			fixtureDef.restitution = cc2d.Restitution;
 			fixtureDef.restitutionThreshold = cc2d.RestitutionThreshold;
 
+			physicsBodyData->PushedDensity = cc2d.Density;
+			physicsBodyData->PushedFriction = cc2d.Friction;
+			physicsBodyData->PushedRestitution = cc2d.Restitution;
+			physicsBodyData->PushedRestitutionThreshold = cc2d.RestitutionThreshold;
+
 			b2Fixture* fixture = body->CreateFixture(&fixtureDef);
 
 			cc2d.RuntimeFixture = fixture;
@@ -295,6 +560,12 @@ namespace Vortex {
 				}
 			}
 
+			if (Utils::GetBodyState(entityRuntimePhysicsBody).PendingPush)
+			{
+				s_DirtyBodies.erase(std::remove(s_DirtyBodies.begin(), s_DirtyBodies.end(), entityRuntimePhysicsBody), s_DirtyBodies.end());
+			}
+
+			s_PhysicsBodyStateMap.erase(entityRuntimePhysicsBody);
 			s_PhysicsScene->DestroyBody(entityRuntimePhysicsBody);
 		}
 	}
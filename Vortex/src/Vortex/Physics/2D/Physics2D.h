@@ -9,6 +9,7 @@
 #include "Vortex/Physics/2D/Physics2DData.h"
 
 class b2World;
+class b2Body;
 class b2Fixture;
 
 namespace Vortex {
@@ -23,6 +24,15 @@ namespace Vortex {
 		static void OnSimulationUpdate(TimeStep delta, Scene* contextScene);
 		static void OnSimulationStop();
 
+		// Moves a body to the transform's pose without interpolating from its old one, the transform must already hold the new pose
+		static void RT_TeleportBody(b2Body* body, const TransformComponent& transform);
+
+		// Queues the actor's transform, RigidBody2D and collider values to be pushed on the next update,
+		// call after changing them from outside the script API, which applies its changes to Box2D directly
+		static void MarkBodyDirty(Actor actor);
+		// Bodies for RigidBody2D components added during play are created on the next update
+		static void QueueBodyCreation(Actor actor);
+
 		static uint64_t Raycast(const Math::vec2& start, const Math::vec2& end, RaycastHit2D* outResult, bool drawDebugLine);
 
 		static b2World* GetPhysicsScene() { return s_PhysicsScene; }
@@ -33,9 +43,17 @@ namespace Vortex {
 		static uint32_t GetPhysicsWorldPositionIterations() { return s_PhysicsWorld2DPositionIterations; }
 		static void SetPhysicsWorldPositionIterations(uint32_t positionIterations) { s_PhysicsWorld2DPositionIterations = positionIterations; }
 
+		static uint32_t GetPhysicsWorldTickRate() { return s_PhysicsWorld2DTickRate; }
+		static void SetPhysicsWorldTickRate(uint32_t tickRate) { s_PhysicsWorld2DTickRate = Math::Max(tickRate, 1u); }
+
+		static uint32_t GetPhysicsWorldMaxSubsteps() { return s_PhysicsWorld2DMaxSubsteps; }
+		static void SetPhysicsWorldMaxSubsteps(uint32_t maxSubsteps) { s_PhysicsWorld2DMaxSubsteps = Math::Max(maxSubsteps, 1u); }
+
 		static Math::vec2 GetPhysicsWorldGravity() { return s_PhysicsWorld2DGravity; }
 		static void SetPhysicsWorldGravitty(const Math::vec2& gravity) { s_PhysicsWorld2DGravity = gravity; }
 
+		static const Physics2DStepTimings& GetStepTimings() { return s_StepTimings; }
+
 	private:
 		inline static Scene* s_ContextScene = nullptr;
 		inline static b2World* s_PhysicsScene = nullptr;
@@ -43,8 +61,18 @@ namespace Vortex {
 		inline static Math::vec2 s_PhysicsWorld2DGravity = Math::vec2(0.0f, -9.81f);
 		inline static uint32_t s_PhysicsWorld2DVeloctityIterations = 6;
 		inline static uint32_t s_PhysicsWorld2DPositionIterations = 2;
+		inline static uint32_t s_PhysicsWorld2DTickRate = 60;
+		inline static uint32_t s_PhysicsWorld2DMaxSubsteps = 8;
+
+		// Unsimulated time carried over to the next frame
+		inline static float s_Accumulator = 0.0f;
+		inline static Physics2DStepTimings s_StepTimings;
 
 		inline static std::unordered_map<b2Fixture*, UniqueRef<PhysicsBody2DData>> s_PhysicsBodyDataMap;
+		inline static std::unordered_map<b2Body*, PhysicsBody2DState> s_PhysicsBodyStateMap;
+
+		inline static std::vector<b2Body*> s_DirtyBodies;
+		inline static std::vector<UUID> s_PendingBodyActors;
 	};
 
 }
@@ -3,6 +3,10 @@
 #include "Vortex/Core/Base.h"
 #include "Vortex/Core/UUID.h"
 
+#include "Vortex/Math/Math.h"
+
+#include <entt/entt.hpp>
+
 extern "C"
 {
 	typedef struct _MonoString MonoString;
@@ -15,6 +19,49 @@ namespace Vortex {
 	struct VORTEX_API PhysicsBody2DData
 	{
 		UUID EntityUUID = 0;
+
+		// Fixture values last pushed to Box2D, only changes are pushed again
+		float PushedDensity = 0.0f;
+		float PushedFriction = 0.0f;
+		float PushedRestitution = 0.0f;
+		float PushedRestitutionThreshold = 0.0f;
+		bool PushedIsSensor = false;
+	};
+
+	// Poses kept per body so rendering can interpolate between fixed steps
+	struct VORTEX_API PhysicsBody2DState
+	{
+		entt::entity ActorHandle = entt::null;
+
+		Math::vec2 PreviousPosition = Math::vec2(0.0f);
+		float PreviousAngle = 0.0f;
+
+		// What physics last wrote to the transform, anything else was moved by the user
+		Math::vec2 WrittenPosition = Math::vec2(0.0f);
+		float WrittenAngle = 0.0f;
+
+		// Rigidbody values last pushed to Box2D, only changes are pushed again
+		Math::vec2 PushedVelocity = Math::vec2(0.0f);
+		float PushedDrag = 0.0f;
+		float PushedAngularVelocity = 0.0f;
+		float PushedAngularDrag = 0.0f;
+		float PushedGravityScale = 0.0f;
+		bool PushedFixedRotation = false;
+
+		// Set while the body is awake, cleared once its resting pose has been written
+		bool NeedsWriteback = true;
+
+		// Set while the body is queued for a push of its component values
+		bool PendingPush = false;
+	};
+
+	// Wall time spent in each phase of the last simulation update, in milliseconds
+	struct VORTEX_API Physics2DStepTimings
+	{
+		float Push = 0.0f;
+		float Simulate = 0.0f;
+		float Writeback = 0.0f;
+		uint32_t Substeps = 0;
 	};
 
 	struct VORTEX_API RaycastHit2D
@@ -1,19 +1,260 @@
 #include "vxpch.h"
 #include "CookingFactory.h"
 
+#include "Vortex/Core/JobSystem.h"
+
+#include "Vortex/Project/Project.h"
+
 #include "Vortex/Physics/3D/Physics.h"
 
+#include "Vortex/Utils/Hash.h"
+
 #include <PhysX/PxPhysicsAPI.h>
 
+#include <fstream>
+
 namespace Vortex {
 
+	// Positions and indices of a submesh, copied out so cooking jobs never touch the asset
+	struct CookingMeshSource
+	{
+		std::vector<Math::vec3> Positions;
+		std::vector<uint32_t> Indices;
+	};
+
+	struct CookedMeshHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint64_t Hash = 0;
+		uint64_t DataSize = 0;
+	};
+
 	struct CookingFactorInternalData
 	{
 		physx::PxCooking* CookingSDK = nullptr;
+
+		// Only touched from the main thread, keyed by source hash
+		std::unordered_map<uint64_t, physx::PxConvexMesh*> ConvexMeshes;
+		std::unordered_map<uint64_t, physx::PxTriangleMesh*> TriangleMeshes;
+
+		// Cooking runs in parallel, reads and writes of cache files don't
+		std::mutex CacheMutex;
+		JobCounter CookJobs;
 	};
 
 	static CookingFactorInternalData s_Data;
 
+	namespace Utils {
+
+		static constexpr uint32_t s_CookedMeshMagic = 0x4D435856; // VXCM
+
+		// Bump whenever the cooking parameters or the file layout change
+		static constexpr uint32_t s_CookedMeshVersion = 1;
+
+		static Fs::Path GetCookedMeshCacheDirectory()
+		{
+			if (Project::GetActive())
+			{
+				return Project::GetCacheDirectory() / "Colliders";
+			}
+			else
+			{
+				return "Resources/Cache/Colliders";
+			}
+		}
+
+		static Fs::Path GetCookedMeshFilepath(const Fs::Path& directory, uint64_t hash)
+		{
+			return directory / fmt::format("{:016x}.vxcm", hash);
+		}
+
+		static bool GetMeshSource(const SharedReference<StaticMesh>& staticMesh, uint32_t submeshIndex, CookingMeshSource& source)
+		{
+			if (!staticMesh || !staticMesh->HasSubmesh(submeshIndex))
+				return false;
+
+			const StaticSubmesh& submesh = staticMesh->GetSubmesh(submeshIndex);
+			const std::vector<StaticVertex>& vertices = submesh.GetVertices();
+
+			source.Positions.resize(vertices.size());
+			for (size_t i = 0; i < vertices.size(); i++)
+			{
+				source.Positions[i] = vertices[i].Position;
+			}
+
+			source.Indices = submesh.GetIndices();
+
+			return !source.Positions.empty();
+		}
+
+		// Hashes everything that affects the cooked output
+		static uint64_t HashMeshSource(const CookingMeshSource& source, ColliderType type)
+		{
+			Fnv1a hasher;
+
+			const uint32_t header[] = { s_CookedMeshVersion, PX_PHYSICS_VERSION, (uint32_t)type };
+			hasher.AddBytes(header, sizeof(header));
+			hasher.AddBytes(source.Positions.data(), source.Positions.size() * sizeof(Math::vec3));
+
+			// Convex hulls ignore the triangles, point clouds can share a cooked hull
+			if (type == ColliderType::TriangleMesh)
+			{
+				hasher.AddBytes(source.Indices.data(), source.Indices.size() * sizeof(uint32_t));
+			}
+
+			return hasher.GetHash();
+		}
+
+		static CookingResult FromPhysXCookingResult(physx::PxConvexMeshCookingResult::Enum result)
+		{
+			switch (result)
+			{
+				case physx::PxConvexMeshCookingResult::eSUCCESS:                return CookingResult::Success;
+				case physx::PxConvexMeshCookingResult::eZERO_AREA_TEST_FAILED:  return CookingResult::ZeroAreaTestFailed;
+				case physx::PxConvexMeshCookingResult::ePOLYGONS_LIMIT_REACHED: return CookingResult::PolygonLimitReached;
+				case physx::PxConvexMeshCookingResult::eFAILURE:                return CookingResult::Failure;
+			}
+
+			VX_CORE_ASSERT(false, "Unknown Cooking Result!");
+			return CookingResult::None;
+		}
+
+	}
+
+	static bool ReadCookedMesh(const Fs::Path& directory, uint64_t hash, std::vector<uint8_t>& outData)
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.CacheMutex);
+
+		std::ifstream stream(Utils::GetCookedMeshFilepath(directory, hash), std::ios::binary);
+		if (!stream)
+			return false;
+
+		CookedMeshHeader header;
+		stream.read((char*)&header, sizeof(CookedMeshHeader));
+
+		if (!stream || header.Magic != Utils::s_CookedMeshMagic || header.Version != Utils::s_CookedMeshVersion || header.Hash != hash)
+			return false;
+
+		outData.resize(header.DataSize);
+		stream.read((char*)outData.data(), header.DataSize);
+
+		return (bool)stream;
+	}
+
+	static void WriteCookedMesh(const Fs::Path& directory, uint64_t hash, const uint8_t* data, uint64_t size)
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.CacheMutex);
+
+		if (!FileSystem::Exists(directory))
+		{
+			FileSystem::CreateDirectoriesV(directory);
+		}
+
+		const Fs::Path filepath = Utils::GetCookedMeshFilepath(directory, hash);
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		if (!stream)
+		{
+			VX_CORE_ERROR_TAG("Physics", "Failed to cache cooked mesh to {}", filepath.string());
+			return;
+		}
+
+		CookedMeshHeader header;
+		header.Magic = Utils::s_CookedMeshMagic;
+		header.Version = Utils::s_CookedMeshVersion;
+		header.Hash = hash;
+		header.DataSize = size;
+
+		stream.write((const char*)&header, sizeof(CookedMeshHeader));
+		stream.write((const char*)data, size);
+	}
+
+	static bool IsMeshCached(const Fs::Path& directory, uint64_t hash)
+	{
+		std::scoped_lock<std::mutex> lock(s_Data.CacheMutex);
+		return FileSystem::Exists(Utils::GetCookedMeshFilepath(directory, hash));
+	}
+
+	static CookingResult CookMeshInternal(const CookingMeshSource& source, ColliderType type, physx::PxDefaultMemoryOutputStream& outStream)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (type == ColliderType::ConvexMesh)
+		{
+			physx::PxConvexMeshDesc convexDesc;
+			convexDesc.points.count = (physx::PxU32)source.Positions.size();
+			convexDesc.points.stride = sizeof(Math::vec3);
+			convexDesc.points.data = source.Positions.data();
+			convexDesc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
+
+			physx::PxConvexMeshCookingResult::Enum result = physx::PxConvexMeshCookingResult::eFAILURE;
+			s_Data.CookingSDK->cookConvexMesh(convexDesc, outStream, &result);
+
+			return Utils::FromPhysXCookingResult(result);
+		}
+
+		VX_CORE_ASSERT(type == ColliderType::TriangleMesh, "Only mesh colliders can be cooked!");
+
+		if (source.Indices.size() < 3)
+			return CookingResult::InvalidMesh;
+
+		physx::PxTriangleMeshDesc triangleDesc;
+		triangleDesc.points.count = (physx::PxU32)source.Positions.size();
+		triangleDesc.points.stride = sizeof(Math::vec3);
+		triangleDesc.points.data = source.Positions.data();
+		triangleDesc.triangles.count = (physx::PxU32)(source.Indices.size() / 3);
+		triangleDesc.triangles.stride = 3 * sizeof(uint32_t);
+		triangleDesc.triangles.data = source.Indices.data();
+
+		physx::PxTriangleMeshCookingResult::Enum result = physx::PxTriangleMeshCookingResult::eFAILURE;
+		if (!s_Data.CookingSDK->cookTriangleMesh(triangleDesc, outStream, &result))
+			return CookingResult::Failure;
+
+		// Large triangles are only a performance warning, the mesh is still usable
+		if (result == physx::PxTriangleMeshCookingResult::eLARGE_TRIANGLE)
+		{
+			VX_CORE_WARN_TAG("Physics", "Triangle mesh contains very large triangles, consider tessellating it");
+		}
+
+		return CookingResult::Success;
+	}
+
+	static CookingResult CookToCache(const CookingMeshSource& source, ColliderType type, const Fs::Path& directory)
+	{
+		const uint64_t hash = Utils::HashMeshSource(source, type);
+		if (IsMeshCached(directory, hash))
+			return CookingResult::Success;
+
+		physx::PxDefaultMemoryOutputStream stream;
+		const CookingResult result = CookMeshInternal(source, type, stream);
+		if (result != CookingResult::Success)
+			return result;
+
+		WriteCookedMesh(directory, hash, stream.getData(), stream.getSize());
+		return result;
+	}
+
+	static bool LoadOrCookMesh(const CookingMeshSource& source, ColliderType type, uint64_t hash, std::vector<uint8_t>& outData)
+	{
+		const Fs::Path directory = Utils::GetCookedMeshCacheDirectory();
+
+		if (ReadCookedMesh(directory, hash, outData))
+			return true;
+
+		physx::PxDefaultMemoryOutputStream stream;
+		const CookingResult result = CookMeshInternal(source, type, stream);
+		if (result != CookingResult::Success)
+		{
+			VX_CORE_ERROR_TAG("Physics", "Failed to cook mesh collider, result: {}", (uint32_t)result);
+			return false;
+		}
+
+		WriteCookedMesh(directory, hash, stream.getData(), stream.getSize());
+		outData.assign(stream.getData(), stream.getData() + stream.getSize());
+		return true;
+	}
+
 	void CookingFactory::Init()
 	{
 		physx::PxCookingParams cookingParams = physx::PxCookingParams(*((physx::PxTolerancesScale*)Physics::GetTolerancesScale()));
@@ -25,20 +266,127 @@ namespace Vortex {
 
 	void CookingFactory::Shutdown()
 	{
+		WaitForPendingCooks();
+
+		for (auto& [hash, convexMesh] : s_Data.ConvexMeshes)
+		{
+			convexMesh->release();
+		}
+
+		for (auto& [hash, triangleMesh] : s_Data.TriangleMeshes)
+		{
+			triangleMesh->release();
+		}
+
+		s_Data.ConvexMeshes.clear();
+		s_Data.TriangleMeshes.clear();
+
 		s_Data.CookingSDK->release();
 		s_Data.CookingSDK = nullptr;
 	}
 
-	CookingResult CookingFactory::CookConvexMesh(SharedReference<StaticMesh> staticMesh)
+	CookingResult CookingFactory::CookConvexMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex)
+	{
+		CookingMeshSource source;
+		if (!Utils::GetMeshSource(staticMesh, submeshIndex, source))
+			return CookingResult::InvalidMesh;
+
+		return CookToCache(source, ColliderType::ConvexMesh, Utils::GetCookedMeshCacheDirectory());
+	}
+
+	CookingResult CookingFactory::CookTriangleMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex)
+	{
+		CookingMeshSource source;
+		if (!Utils::GetMeshSource(staticMesh, submeshIndex, source))
+			return CookingResult::InvalidMesh;
+
+		return CookToCache(source, ColliderType::TriangleMesh, Utils::GetCookedMeshCacheDirectory());
+	}
+
+	void CookingFactory::CookStaticMeshAsync(SharedReference<StaticMesh> staticMesh, ColliderType type)
+	{
+		VX_PROFILE_FUNCTION();
+
+		VX_CORE_ASSERT(type == ColliderType::ConvexMesh || type == ColliderType::TriangleMesh, "Only mesh colliders can be cooked!");
+
+		if (!staticMesh)
+			return;
+
+		// Resolved here, the active project shouldn't be read from worker threads
+		const Fs::Path directory = Utils::GetCookedMeshCacheDirectory();
+
+		for (const auto& [submeshIndex, submesh] : staticMesh->GetSubmeshes())
+		{
+			SharedRef<CookingMeshSource> source = CreateShared<CookingMeshSource>();
+			if (!Utils::GetMeshSource(staticMesh, submeshIndex, *source))
+				continue;
+
+			JobSystem::Submit([source, type, directory]()
+			{
+				const CookingResult result = CookToCache(*source, type, directory);
+				if (result != CookingResult::Success)
+				{
+					VX_CORE_WARN_TAG("Physics", "Background cook of mesh collider failed, result: {}", (uint32_t)result);
+				}
+			}, &s_Data.CookJobs);
+		}
+	}
+
+	void CookingFactory::WaitForPendingCooks()
 	{
-		VX_CORE_ASSERT(false, "Not implemented yet!");
-		return CookingResult::Failure;
+		JobSystem::Wait(s_Data.CookJobs);
 	}
 
-	CookingResult CookingFactory::CookTriangleMesh(SharedReference<StaticMesh> staticMesh)
+	physx::PxConvexMesh* CookingFactory::GetConvexMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex)
 	{
-		VX_CORE_ASSERT(false, "Not implemented yet!");
-		return CookingResult::Failure;
+		VX_PROFILE_FUNCTION();
+
+		CookingMeshSource source;
+		if (!Utils::GetMeshSource(staticMesh, submeshIndex, source))
+			return nullptr;
+
+		const uint64_t hash = Utils::HashMeshSource(source, ColliderType::ConvexMesh);
+		if (auto it = s_Data.ConvexMeshes.find(hash); it != s_Data.ConvexMeshes.end())
+			return it->second;
+
+		std::vector<uint8_t> cookedData;
+		if (!LoadOrCookMesh(source, ColliderType::ConvexMesh, hash, cookedData))
+			return nullptr;
+
+		physx::PxDefaultMemoryInputData input(cookedData.data(), (physx::PxU32)cookedData.size());
+		physx::PxConvexMesh* convexMesh = ((physx::PxPhysics*)Physics::GetPhysicsSDK())->createConvexMesh(input);
+		if (convexMesh)
+		{
+			s_Data.ConvexMeshes[hash] = convexMesh;
+		}
+
+		return convexMesh;
+	}
+
+	physx::PxTriangleMesh* CookingFactory::GetTriangleMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex)
+	{
+		VX_PROFILE_FUNCTION();
+
+		CookingMeshSource source;
+		if (!Utils::GetMeshSource(staticMesh, submeshIndex, source))
+			return nullptr;
+
+		const uint64_t hash = Utils::HashMeshSource(source, ColliderType::TriangleMesh);
+		if (auto it = s_Data.TriangleMeshes.find(hash); it != s_Data.TriangleMeshes.end())
+			return it->second;
+
+		std::vector<uint8_t> cookedData;
+		if (!LoadOrCookMesh(source, ColliderType::TriangleMesh, hash, cookedData))
+			return nullptr;
+
+		physx::PxDefaultMemoryInputData input(cookedData.data(), (physx::PxU32)cookedData.size());
+		physx::PxTriangleMesh* triangleMesh = ((physx::PxPhysics*)Physics::GetPhysicsSDK())->createTriangleMesh(input);
+		if (triangleMesh)
+		{
+			s_Data.TriangleMeshes[hash] = triangleMesh;
+		}
+
+		return triangleMesh;
 	}
 
 }
@@ -7,6 +7,13 @@
 
 #include <vector>
 
+namespace physx {
+
+	class PxConvexMesh;
+	class PxTriangleMesh;
+
+}
+
 namespace Vortex {
 
 	class VORTEX_API CookingFactory
@@ -15,8 +22,18 @@ namespace Vortex {
 		static void Init();
 		static void Shutdown();
 
-		static CookingResult CookConvexMesh(SharedReference<StaticMesh> staticMesh);
-		static CookingResult CookTriangleMesh(SharedReference<StaticMesh> staticMesh);
+		// Cooks a submesh into the project cache, returns straight away if it was already cooked
+		static CookingResult CookConvexMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex = 0);
+		static CookingResult CookTriangleMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex = 0);
+
+		// Cooks every submesh on the job system so the cache is warm by the time play starts
+		static void CookStaticMeshAsync(SharedReference<StaticMesh> staticMesh, ColliderType type);
+		static void WaitForPendingCooks();
+
+		// Loads the cooked mesh from the cache, cooking it first on a miss
+		// Colliders built from the same vertex data share a single mesh
+		static physx::PxConvexMesh* GetConvexMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex);
+		static physx::PxTriangleMesh* GetTriangleMesh(SharedReference<StaticMesh> staticMesh, uint32_t submeshIndex);
 	};
 
 }
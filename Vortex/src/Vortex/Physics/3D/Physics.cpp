@@ -2,23 +2,46 @@
 #include "Physics.h"
 
 #include "Vortex/Core/Application.h"
+#include "Vortex/Core/JobSystem.h"
 
 #include "Vortex/Module/Module.h"
 
 #include "Vortex/Project/Project.h"
 
+#include "Vortex/Asset/AssetManager.h"
+
 #include "Vortex/Renderer/Renderer2D.h"
 
 #include "Vortex/Physics/3D/PhysicsScene.h"
 #include "Vortex/Physics/3D/CookingFactory.h"
 #include "Vortex/Physics/3D/PhysicsUtils.h"
+#include "Vortex/Physics/3D/PhysicsJobDispatcher.h"
 
 #include "Vortex/Scripting/ScriptEngine.h"
 
 #include "Vortex/Utils/Time.h"
+#include "Vortex/Utils/FileSystem.h"
+#include "Vortex/Utils/Hash.h"
+
+#include <chrono>
+#include <fstream>
 
 namespace Vortex {
 
+	// Body data plus what only the engine needs, every rigid actor's userData points to one of these
+	struct PhysicsActorData : public PhysicsBodyData
+	{
+		physx::PxRigidDynamic* DynamicActor = nullptr;
+		bool PendingWriteback = false;
+
+		// Rigidbody properties as of the last push, unchanged bodies are skipped
+		RigidBodyComponent PushedProperties;
+		bool PendingPropertyPush = false;
+
+		// A non zero component velocity is applied every update until it's cleared
+		bool VelocityDriven = false;
+	};
+
 	struct PhysicsEngineInternalData
 	{
 		physx::PxDefaultAllocator DefaultAllocator;
@@ -27,21 +50,24 @@ namespace Vortex {
 		physx::PxPhysics* PhysXSDK = nullptr;
 		physx::PxControllerManager* ControllerManager = nullptr;
 		physx::PxTolerancesScale TolerancesScale;
-		physx::PxDefaultCpuDispatcher* Dispatcher = nullptr;
+		physx::PxCpuDispatcher* Dispatcher = nullptr;
+		physx::PxDefaultCpuDispatcher* DefaultDispatcher = nullptr;
+		PhysicsJobDispatcher JobDispatcher;
 
 #ifndef VX_DIST
 		physx::PxSimulationStatistics SimulationStats;
 #endif
 
-		// TODO substep through the simulation
 		struct SubstepInfo
 		{
 			float SubstepSize = 0.0f;
 			float Accumulator = 0.0f;
 			uint32_t NumSubsteps = 0;
-			inline static constexpr uint32_t MaxSubsteps = 8;
+			float InterpolationFactor = 0.0f;
 		} SubstepInfo;
 
+		PhysicsStepTimings StepTimings;
+
 		Scene* ContextScene = nullptr;
 
 		std::unordered_map<UUID, physx::PxRigidActor*> ActiveActors;
@@ -58,13 +84,223 @@ namespace Vortex {
 		std::unordered_map<UUID, PhysicsBodyData*> PhysicsBodyData;
 		std::unordered_map<UUID, ConstrainedJointData*> ConstrainedJointData;
 
-		constexpr static float FixedTimeStep = 1.0f / 100.0f;
+		// Bodies that moved in the most recent step, or stopped since the last write back
+		std::vector<PhysicsActorData*> WritebackActors;
+		uint64_t StepIndex = 0;
+
+		// Bodies whose RigidBodyComponent changed since the last push, and those with a velocity to apply
+		std::vector<PhysicsActorData*> DirtyActors;
+		std::vector<PhysicsActorData*> VelocityDrivenActors;
+
+		// Objects restored from a serialized scene live inside this block until the scene shuts down
+		std::unique_ptr<uint8_t[]> SerializedMemory;
 
 		SubModule Module;
 	};
 
 	static PhysicsEngineInternalData* s_Data = nullptr;
 
+	namespace Utils {
+
+		// Velocities aren't compared, they drive the body every frame while non zero
+		static bool DynamicPropertiesChanged(const RigidBodyComponent& pushed, const RigidBodyComponent& current)
+		{
+			return pushed.Mass != current.Mass
+				|| pushed.IsKinematic != current.IsKinematic
+				|| pushed.DisableGravity != current.DisableGravity
+				|| pushed.MaxLinearVelocity != current.MaxLinearVelocity
+				|| pushed.LinearDrag != current.LinearDrag
+				|| pushed.MaxAngularVelocity != current.MaxAngularVelocity
+				|| pushed.AngularDrag != current.AngularDrag
+				|| pushed.LockFlags != current.LockFlags
+				|| pushed.CollisionDetection != current.CollisionDetection;
+		}
+
+		using Clock = std::chrono::steady_clock;
+
+		static float GetElapsedMilliseconds(Clock::time_point start)
+		{
+			return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+		}
+
+		// Keeps a body in the write back list for the next update even if it doesn't move in the next step
+		static void QueueWriteback(PhysicsActorData* actorData)
+		{
+			actorData->LastActiveStep = s_Data->StepIndex;
+
+			if (!actorData->PendingWriteback)
+			{
+				actorData->PendingWriteback = true;
+				s_Data->WritebackActors.push_back(actorData);
+			}
+		}
+
+		// Bump whenever the hashed state or the way actors are built changes
+		static constexpr uint32_t s_SceneCacheVersion = 1;
+
+		static void HashPhysicsMaterial(Fnv1a& hasher, AssetHandle materialHandle)
+		{
+			SharedReference<PhysicsMaterial> material = AssetManager::GetAsset<PhysicsMaterial>(materialHandle);
+			if (!material)
+			{
+				hasher.Add(0u);
+				return;
+			}
+
+			hasher.Add(material->StaticFriction);
+			hasher.Add(material->DynamicFriction);
+			hasher.Add(material->Bounciness);
+			hasher.Add(material->FrictionCombineMode);
+			hasher.Add(material->BouncinessCombineMode);
+		}
+
+		// Everything that goes into building the rigid actors, an unchanged hash means a cached scene still matches
+		static uint64_t HashScenePhysics(Scene* scene)
+		{
+			uint64_t sceneHash = 0;
+
+			auto view = scene->GetAllActorsWith<TransformComponent, RigidBodyComponent>();
+
+			for (const auto e : view)
+			{
+				Actor actor{ e, scene };
+
+				// Controllers are always built, they aren't part of the cached scene
+				if (!actor.IsActive() || actor.HasComponent<CharacterControllerComponent>())
+					continue;
+
+				Fnv1a hasher;
+				hasher.Add(s_SceneCacheVersion);
+				hasher.Add((uint32_t)PX_PHYSICS_VERSION);
+				hasher.Add((uint64_t)actor.GetUUID());
+
+				const TransformComponent& transform = actor.GetTransform();
+				hasher.Add(transform.Translation);
+				hasher.Add(transform.GetRotation());
+				hasher.Add(scene->GetCachedWorldSpaceTransform(actor).Scale);
+
+				const RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
+				hasher.Add(rigidbody.Type);
+				hasher.Add(rigidbody.LayerID);
+				hasher.Add(rigidbody.Mass);
+				hasher.Add(rigidbody.LinearVelocity);
+				hasher.Add(rigidbody.MaxLinearVelocity);
+				hasher.Add(rigidbody.LinearDrag);
+				hasher.Add(rigidbody.AngularVelocity);
+				hasher.Add(rigidbody.MaxAngularVelocity);
+				hasher.Add(rigidbody.AngularDrag);
+				hasher.Add(rigidbody.DisableGravity);
+				hasher.Add(rigidbody.IsKinematic);
+				hasher.Add(rigidbody.CollisionDetection);
+				hasher.Add(rigidbody.LockFlags);
+
+				// Same priority as RT_CreateCollider, only one collider is ever built
+				if (actor.HasComponent<BoxColliderComponent>())
+				{
+					const BoxColliderComponent& boxCollider = actor.GetComponent<BoxColliderComponent>();
+					hasher.Add(ColliderType::Box);
+					hasher.Add(boxCollider.HalfSize);
+					hasher.Add(boxCollider.Offset);
+					hasher.Add(boxCollider.IsTrigger);
+					HashPhysicsMaterial(hasher, boxCollider.Material);
+				}
+				else if (actor.HasComponent<SphereColliderComponent>())
+				{
+					const SphereColliderComponent& sphereCollider = actor.GetComponent<SphereColliderComponent>();
+					hasher.Add(ColliderType::Sphere);
+					hasher.Add(sphereCollider.Radius);
+					hasher.Add(sphereCollider.Offset);
+					hasher.Add(sphereCollider.IsTrigger);
+					HashPhysicsMaterial(hasher, sphereCollider.Material);
+				}
+				else if (actor.HasComponent<CapsuleColliderComponent>())
+				{
+					const CapsuleColliderComponent& capsuleCollider = actor.GetComponent<CapsuleColliderComponent>();
+					hasher.Add(ColliderType::Capsule);
+					hasher.Add(capsuleCollider.Radius);
+					hasher.Add(capsuleCollider.Height);
+					hasher.Add(capsuleCollider.Offset);
+					hasher.Add(capsuleCollider.IsTrigger);
+					HashPhysicsMaterial(hasher, capsuleCollider.Material);
+				}
+				else if (actor.HasComponent<MeshColliderComponent>())
+				{
+					const MeshColliderComponent& meshCollider = actor.GetComponent<MeshColliderComponent>();
+					SharedReference<StaticMesh> colliderMesh = Physics::GetMeshColliderAsset(actor);
+					hasher.Add(Physics::GetMeshColliderType(actor));
+					hasher.Add((uint64_t)(colliderMesh ? colliderMesh->Handle : AssetHandle(0)));
+					hasher.Add(meshCollider.SubmeshIndex);
+					hasher.Add(meshCollider.IsTrigger);
+					HashPhysicsMaterial(hasher, meshCollider.Material);
+				}
+
+				// Combined by addition so the registry's iteration order doesn't matter
+				sceneHash += hasher.GetHash();
+			}
+
+			return sceneHash;
+		}
+
+		static Fs::Path GetSceneCacheFilepath(uint64_t sceneHash)
+		{
+			return Project::GetCacheDirectory() / "PhysicsScenes" / fmt::format("{:016x}.vxps", sceneHash);
+		}
+
+		// Every edit to a scene produces a new hash, so only the most recently used entries are kept
+		static constexpr size_t s_MaxCachedScenes = 8;
+
+		static void PruneSceneCache(const Fs::Path& directory)
+		{
+			std::vector<std::pair<uint64_t, Fs::Path>> entries;
+
+			std::error_code error;
+			for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+			{
+				if (entry.is_regular_file() && entry.path().extension() == ".vxps")
+				{
+					entries.emplace_back(FileSystem::GetLastWriteTime(entry.path()), entry.path());
+				}
+			}
+
+			if (entries.size() <= s_MaxCachedScenes)
+				return;
+
+			// Newest first, everything past the cap is removed
+			std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+			for (size_t i = s_MaxCachedScenes; i < entries.size(); i++)
+			{
+				// A failed removal is retried on the next write
+				std::filesystem::remove(entries[i].second, error);
+			}
+		}
+
+		static void RemoveActorData(std::vector<PhysicsActorData*>& actors, const PhysicsActorData* actorData)
+		{
+			actors.erase(std::remove(actors.begin(), actors.end(), actorData), actors.end());
+		}
+
+		static void UpdateVelocityDriven(PhysicsActorData* actorData, const RigidBodyComponent& rigidbody)
+		{
+			const bool velocityDriven = rigidbody.LinearVelocity != Math::vec3(0.0f) || rigidbody.AngularVelocity != Math::vec3(0.0f);
+
+			if (velocityDriven == actorData->VelocityDriven)
+				return;
+
+			actorData->VelocityDriven = velocityDriven;
+
+			if (velocityDriven)
+			{
+				s_Data->VelocityDrivenActors.push_back(actorData);
+			}
+			else
+			{
+				RemoveActorData(s_Data->VelocityDrivenActors, actorData);
+			}
+		}
+
+	}
+
 	void Physics::Init()
 	{
 		InitPhysicsSDKInternal();
@@ -94,20 +330,68 @@ namespace Vortex {
 		InitPhysicsSceneInternal();
 
 		s_Data->ContextScene = contextScene;
+		s_Data->SubstepInfo = {};
+
+		// An unchanged scene restores its actors from the last play instead of building them one by one
+		const uint64_t sceneHash = Utils::HashScenePhysics(contextScene);
+		const bool restored = RT_RestoreCachedScene(sceneHash);
 
 		InitializeUninitializedActors();
+
+		if (!restored)
+		{
+			RT_CacheScene(sceneHash);
+		}
 	}
 
 	void Physics::OnSimulationUpdate(TimeStep delta)
 	{
+		PhysicsStepTimings& timings = s_Data->StepTimings;
+		timings = PhysicsStepTimings();
+
+		Utils::Clock::time_point start = Utils::Clock::now();
+
 		InitializeUninitializedActors();
 
-		RT_SimulationStep();
+		RT_UpdateActorProperties();
+
+		timings.Push = Utils::GetElapsedMilliseconds(start);
+		start = Utils::Clock::now();
+
+		// The last step is left running, results are picked up in OnSimulationFetchResults
+		RT_SimulationStep(delta);
+
+		timings.Simulate = Utils::GetElapsedMilliseconds(start);
+		timings.Substeps = s_Data->SubstepInfo.NumSubsteps;
+	}
+
+	void Physics::OnSimulationFetchResults()
+	{
+		PhysicsStepTimings& timings = s_Data->StepTimings;
+
+		Utils::Clock::time_point start = Utils::Clock::now();
+
+		if (PhysicsScene::IsSimulating())
+		{
+			PhysicsScene::FetchResults(true);
+			RT_GatherActiveActors();
+		}
+
+		timings.Fetch = Utils::GetElapsedMilliseconds(start);
+		start = Utils::Clock::now();
 
 		RT_UpdateActors();
 		RT_UpdateControllers();
 		RT_UpdateJoints();
 
+		timings.Writeback = Utils::GetElapsedMilliseconds(start);
+		start = Utils::Clock::now();
+
+		// Scripts see contacts once every body has its new transform
+		PhysicsScene::DispatchContactEvents();
+
+		timings.ContactCallbacks += Utils::GetElapsedMilliseconds(start);
+
 #ifndef VX_DIST
 		((physx::PxScene*)PhysicsScene::GetScene())->getSimulationStatistics(s_Data->SimulationStats);
 #endif
@@ -115,6 +399,12 @@ namespace Vortex {
 
 	void Physics::OnSimulationStop(Scene* contextScene)
 	{
+		// The scene can't be modified while a step is running
+		if (PhysicsScene::IsSimulating())
+		{
+			PhysicsScene::FetchResults(true);
+		}
+
 		std::vector<UUID> actorsToDestroy;
 
 		for (const auto& [actorUUID, fixedJoint] : s_Data->ActiveFixedJoints)
@@ -212,6 +502,20 @@ namespace Vortex {
 		RT_DestroyPhysicsBodyDataInternal(actorUUID);
 	}
 
+	void Physics::MarkActorDirty(Actor actor)
+	{
+		auto it = s_Data->ActiveActors.find(actor.GetUUID());
+		if (it == s_Data->ActiveActors.end())
+			return;
+
+		PhysicsActorData* actorData = (PhysicsActorData*)it->second->userData;
+		if (!actorData || !actorData->DynamicActor || actorData->PendingPropertyPush)
+			return;
+
+		actorData->PendingPropertyPush = true;
+		s_Data->DirtyActors.push_back(actorData);
+	}
+
 	void Physics::WakeUpActor(Actor actor)
 	{
 		if (!actor.HasComponent<RigidBodyComponent>())
@@ -236,6 +540,383 @@ namespace Vortex {
 		}
 	}
 
+	SharedReference<StaticMesh> Physics::GetMeshColliderAsset(Actor actor)
+	{
+		const MeshColliderComponent& meshCollider = actor.GetComponent<MeshColliderComponent>();
+
+		if (AssetManager::IsHandleValid(meshCollider.ColliderAsset))
+		{
+			return AssetManager::GetAsset<StaticMesh>(meshCollider.ColliderAsset);
+		}
+
+		if (actor.HasComponent<StaticMeshRendererComponent>())
+		{
+			const StaticMeshRendererComponent& staticMeshRenderer = actor.GetComponent<StaticMeshRendererComponent>();
+			if (AssetManager::IsHandleValid(staticMeshRenderer.StaticMesh))
+			{
+				return AssetManager::GetAsset<StaticMesh>(staticMeshRenderer.StaticMesh);
+			}
+		}
+
+		return nullptr;
+	}
+
+	ColliderType Physics::GetMeshColliderType(Actor actor)
+	{
+		const MeshColliderComponent& meshCollider = actor.GetComponent<MeshColliderComponent>();
+
+		if (meshCollider.CollisionComplexity != ECollisionComplexity::UseComplexAsSimple)
+			return ColliderType::ConvexMesh;
+
+		if (actor.HasComponent<RigidBodyComponent>())
+		{
+			const RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
+			if (rigidbody.Type == RigidBodyType::Dynamic && !rigidbody.IsKinematic)
+				return ColliderType::ConvexMesh;
+		}
+
+		return ColliderType::TriangleMesh;
+	}
+
+	void Physics::CaptureSnapshot(PhysicsSnapshot& outSnapshot)
+	{
+		VX_PROFILE_FUNCTION();
+
+		// Actor state can't be read while a step is running
+		if (PhysicsScene::IsSimulating())
+		{
+			PhysicsScene::FetchResults(true);
+			RT_GatherActiveActors();
+		}
+
+		outSnapshot.Actors.clear();
+		outSnapshot.Controllers.clear();
+		outSnapshot.Actors.reserve(s_Data->ActiveActors.size());
+
+		// Static actors don't simulate, only dynamic state is captured
+		for (const auto& [actorUUID, pxActor] : s_Data->ActiveActors)
+		{
+			if (s_Data->ActiveControllers.contains(actorUUID))
+				continue;
+
+			const physx::PxRigidDynamic* dynamicActor = pxActor->is<physx::PxRigidDynamic>();
+			if (!dynamicActor)
+				continue;
+
+			const physx::PxTransform pose = dynamicActor->getGlobalPose();
+
+			PhysicsActorSnapshot& actorSnapshot = outSnapshot.Actors.emplace_back();
+			actorSnapshot.ActorUUID = actorUUID;
+			actorSnapshot.Translation = PhysicsUtils::FromPhysXVector(pose.p);
+			actorSnapshot.Rotation = PhysicsUtils::FromPhysXQuat(pose.q);
+			actorSnapshot.LinearVelocity = PhysicsUtils::FromPhysXVector(dynamicActor->getLinearVelocity());
+			actorSnapshot.AngularVelocity = PhysicsUtils::FromPhysXVector(dynamicActor->getAngularVelocity());
+			actorSnapshot.IsSleeping = dynamicActor->isSleeping();
+		}
+
+		for (const auto& [actorUUID, controller] : s_Data->ActiveControllers)
+		{
+			PhysicsControllerSnapshot& controllerSnapshot = outSnapshot.Controllers.emplace_back();
+			controllerSnapshot.ActorUUID = actorUUID;
+			controllerSnapshot.Position = PhysicsUtils::FromPhysXExtendedVector(controller->getPosition());
+		}
+
+		outSnapshot.Accumulator = s_Data->SubstepInfo.Accumulator;
+	}
+
+	void Physics::RestoreSnapshot(const PhysicsSnapshot& snapshot)
+	{
+		VX_PROFILE_FUNCTION();
+
+		// A running step would overwrite the restored state when it completes
+		if (PhysicsScene::IsSimulating())
+		{
+			PhysicsScene::FetchResults(true);
+			RT_GatherActiveActors();
+		}
+
+		for (const PhysicsActorSnapshot& actorSnapshot : snapshot.Actors)
+		{
+			auto it = s_Data->ActiveActors.find(actorSnapshot.ActorUUID);
+			if (it == s_Data->ActiveActors.end())
+				continue;
+
+			physx::PxRigidDynamic* dynamicActor = it->second->is<physx::PxRigidDynamic>();
+			if (!dynamicActor)
+				continue;
+
+			const physx::PxTransform pose(PhysicsUtils::ToPhysXVector(actorSnapshot.Translation), PhysicsUtils::ToPhysXQuat(actorSnapshot.Rotation));
+			RT_TeleportActor(dynamicActor, pose);
+			Utils::QueueWriteback((PhysicsActorData*)dynamicActor->userData);
+
+			if (dynamicActor->getRigidBodyFlags() & physx::PxRigidBodyFlag::eKINEMATIC)
+				continue;
+
+			dynamicActor->setLinearVelocity(PhysicsUtils::ToPhysXVector(actorSnapshot.LinearVelocity), false);
+			dynamicActor->setAngularVelocity(PhysicsUtils::ToPhysXVector(actorSnapshot.AngularVelocity), false);
+
+			if (actorSnapshot.IsSleeping)
+			{
+				dynamicActor->putToSleep();
+			}
+			else
+			{
+				dynamicActor->wakeUp();
+			}
+		}
+
+		for (const PhysicsControllerSnapshot& controllerSnapshot : snapshot.Controllers)
+		{
+			auto it = s_Data->ActiveControllers.find(controllerSnapshot.ActorUUID);
+			if (it == s_Data->ActiveControllers.end())
+				continue;
+
+			it->second->setPosition(PhysicsUtils::ToPhysXExtendedVector(controllerSnapshot.Position));
+		}
+
+		s_Data->SubstepInfo.Accumulator = snapshot.Accumulator;
+	}
+
+	bool Physics::SerializeScene(std::vector<uint8_t>& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (PhysicsScene::IsSimulating())
+		{
+			PhysicsScene::FetchResults(true);
+			RT_GatherActiveActors();
+		}
+
+		physx::PxSerializationRegistry* registry = physx::PxSerialization::createSerializationRegistry(*s_Data->PhysXSDK);
+		physx::PxCollection* collection = PxCreateCollection();
+
+		std::vector<UUID> actorUUIDs;
+		actorUUIDs.reserve(s_Data->ActiveActors.size());
+
+		for (const auto& [actorUUID, pxActor] : s_Data->ActiveActors)
+		{
+			// Controllers own their actors, they're always built
+			if (s_Data->ActiveControllers.contains(actorUUID))
+				continue;
+
+			actorUUIDs.push_back(actorUUID);
+		}
+
+		// Restored actors are added to the scene in collection order, match the sorted order a cold start creates them in
+		std::sort(actorUUIDs.begin(), actorUUIDs.end());
+
+		for (const UUID actorUUID : actorUUIDs)
+		{
+			collection->add(*s_Data->ActiveActors[actorUUID], (physx::PxSerialObjectId)(uint64_t)actorUUID);
+		}
+
+		// Pulls in the shapes, materials and meshes the actors reference
+		physx::PxSerialization::complete(*collection, *registry);
+
+		physx::PxDefaultMemoryOutputStream stream;
+		const bool serialized = physx::PxSerialization::serializeCollectionToBinary(stream, *collection, *registry);
+
+		if (serialized)
+		{
+			outData.assign(stream.getData(), stream.getData() + stream.getSize());
+		}
+
+		collection->release();
+		registry->release();
+
+		return serialized;
+	}
+
+	bool Physics::DeserializeScene(const uint8_t* data, uint64_t size)
+	{
+		VX_PROFILE_FUNCTION();
+
+		VX_CORE_ASSERT(!s_Data->SerializedMemory, "A serialized scene was already restored!");
+
+		// PhysX wants the block aligned and expects it to outlive every object in it
+		s_Data->SerializedMemory = std::make_unique<uint8_t[]>(size + PX_SERIAL_FILE_ALIGN);
+		const uintptr_t alignment = PX_SERIAL_FILE_ALIGN;
+		uint8_t* alignedMemory = (uint8_t*)(((uintptr_t)s_Data->SerializedMemory.get() + alignment - 1) & ~(alignment - 1));
+		memcpy(alignedMemory, data, size);
+
+		physx::PxSerializationRegistry* registry = physx::PxSerialization::createSerializationRegistry(*s_Data->PhysXSDK);
+		physx::PxCollection* collection = physx::PxSerialization::createCollectionFromBinary(alignedMemory, *registry);
+
+		if (!collection)
+		{
+			registry->release();
+			s_Data->SerializedMemory.reset();
+			return false;
+		}
+
+		Scene* contextScene = s_Data->ContextScene;
+		const uint32_t objectCount = collection->getNbObjects();
+
+		// Every actor has to map to one we would have built, otherwise nothing is adopted
+		bool valid = true;
+
+		for (uint32_t i = 0; i < objectCount && valid; i++)
+		{
+			physx::PxBase& object = collection->getObject(i);
+			if (!object.is<physx::PxRigidActor>())
+				continue;
+
+			const UUID actorUUID = (uint64_t)collection->getId(object);
+			Actor actor = contextScene->TryGetActorWithUUID(actorUUID);
+
+			valid = actor && actor.IsActive()
+				&& actor.HasComponent<RigidBodyComponent>()
+				&& !actor.HasComponent<CharacterControllerComponent>()
+				&& !s_Data->ActiveActors.contains(actorUUID);
+		}
+
+		if (!valid)
+		{
+			physx::PxCollectionExt::releaseObjects(*collection);
+			collection->release();
+			registry->release();
+			s_Data->SerializedMemory.reset();
+			return false;
+		}
+
+		std::vector<physx::PxBase*> userReferences;
+
+		for (uint32_t i = 0; i < objectCount; i++)
+		{
+			physx::PxBase& object = collection->getObject(i);
+
+			if (physx::PxRigidActor* pxActor = object.is<physx::PxRigidActor>())
+			{
+				Actor actor = contextScene->TryGetActorWithUUID((uint64_t)collection->getId(object));
+
+				RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
+				rigidbody.RuntimeActor = (void*)pxActor;
+
+				RT_RegisterPhysicsActor(actor, pxActor);
+				RT_AdoptColliderShapes(actor, pxActor);
+			}
+			else if (object.is<physx::PxShape>() || object.is<physx::PxConvexMesh>() || object.is<physx::PxTriangleMesh>())
+			{
+				userReferences.push_back(&object);
+			}
+		}
+
+		((physx::PxScene*)PhysicsScene::GetScene())->addCollection(*collection);
+
+		// Actors keep their shapes and shapes their meshes alive, materials now belong to the collider shapes
+		for (physx::PxBase* object : userReferences)
+		{
+			object->release();
+		}
+
+		collection->release();
+		registry->release();
+
+		return true;
+	}
+
+	bool Physics::RT_RestoreCachedScene(uint64_t sceneHash)
+	{
+		if (sceneHash == 0)
+			return false;
+
+		const Fs::Path filepath = Utils::GetSceneCacheFilepath(sceneHash);
+		if (!FileSystem::Exists(filepath))
+			return false;
+
+		Buffer buffer = FileSystem::ReadBinary(filepath);
+		const bool restored = buffer && DeserializeScene(buffer.Data, buffer.Size);
+		buffer.Release();
+
+		if (!restored)
+		{
+			VX_CORE_WARN_TAG("Physics", "Failed to restore cached physics scene {}, rebuilding", filepath.string());
+		}
+		else
+		{
+			// Restored entries count as recently used so pruning keeps them
+			std::error_code error;
+			std::filesystem::last_write_time(filepath, std::filesystem::file_time_type::clock::now(), error);
+		}
+
+		return restored;
+	}
+
+	void Physics::RT_CacheScene(uint64_t sceneHash)
+	{
+		if (sceneHash == 0)
+			return;
+
+		SharedRef<std::vector<uint8_t>> data = CreateShared<std::vector<uint8_t>>();
+		if (!SerializeScene(*data))
+			return;
+
+		const Fs::Path filepath = Utils::GetSceneCacheFilepath(sceneHash);
+
+		// Only the file write is deferred, the collection has to be serialized before the first step changes it
+		JobSystem::Submit([data, filepath]()
+		{
+			const Fs::Path directory = filepath.parent_path();
+			if (!FileSystem::Exists(directory))
+			{
+				FileSystem::CreateDirectoriesV(directory);
+			}
+
+			// Written to the side first so a play started mid write never reads half a file
+			Fs::Path tempFilepath = filepath;
+			FileSystem::ReplaceExtension(tempFilepath, ".tmp");
+
+			{
+				std::ofstream stream(tempFilepath, std::ios::binary | std::ios::trunc);
+				if (!stream)
+				{
+					VX_CORE_ERROR_TAG("Physics", "Failed to cache physics scene to {}", filepath.string());
+					return;
+				}
+
+				stream.write((const char*)data->data(), data->size());
+			}
+
+			FileSystem::Rename(tempFilepath, filepath);
+
+			Utils::PruneSceneCache(directory);
+		});
+	}
+
+	void Physics::RT_AdoptColliderShapes(Actor actor, physx::PxRigidActor* pxActor)
+	{
+		std::vector<SharedReference<ColliderShape>>& shapes = GetActorColliderShapesInternal(actor.GetUUID());
+
+		const uint32_t shapeCount = pxActor->getNbShapes();
+		std::vector<physx::PxShape*> pxShapes(shapeCount);
+		pxActor->getShapes(pxShapes.data(), shapeCount);
+
+		for (physx::PxShape* pxShape : pxShapes)
+		{
+			switch (pxShape->getGeometryType())
+			{
+				case physx::PxGeometryType::eBOX:
+					shapes.push_back(SharedReference<BoxColliderShape>::Create(actor.GetComponent<BoxColliderComponent>(), *pxShape, actor));
+					break;
+				case physx::PxGeometryType::eSPHERE:
+					shapes.push_back(SharedReference<SphereColliderShape>::Create(actor.GetComponent<SphereColliderComponent>(), *pxShape, actor));
+					break;
+				case physx::PxGeometryType::eCAPSULE:
+					shapes.push_back(SharedReference<CapsuleColliderShape>::Create(actor.GetComponent<CapsuleColliderComponent>(), *pxShape, actor));
+					break;
+				case physx::PxGeometryType::eCONVEXMESH:
+					shapes.push_back(SharedReference<ConvexMeshShape>::Create(actor.GetComponent<MeshColliderComponent>(), *pxShape, actor));
+					break;
+				case physx::PxGeometryType::eTRIANGLEMESH:
+					shapes.push_back(SharedReference<TriangleMeshShape>::Create(actor.GetComponent<MeshColliderComponent>(), *pxShape, actor));
+					break;
+				default:
+					VX_CORE_ASSERT(false, "Unknown collider geometry!");
+					break;
+			}
+		}
+	}
+
 	bool Physics::IsConstraintBroken(UUID actorUUID)
 	{
 		if (s_Data->ActiveFixedJoints.contains(actorUUID))
@@ -301,41 +982,161 @@ namespace Vortex {
 		}
     }
 
-	void Physics::RT_SimulationStep()
+	void Physics::RT_SimulationStep(TimeStep delta)
 	{
-		PhysicsScene::Simulate(s_Data->FixedTimeStep, true);
+		auto& substepInfo = s_Data->SubstepInfo;
+		substepInfo.SubstepSize = 1.0f / (float)PhysicsScene::GetTickRate();
+		substepInfo.Accumulator += delta;
+		substepInfo.NumSubsteps = 0;
+
+		const uint32_t maxSubsteps = PhysicsScene::GetMaxSubsteps();
+
+		while (substepInfo.Accumulator >= substepInfo.SubstepSize && substepInfo.NumSubsteps < maxSubsteps)
+		{
+			substepInfo.Accumulator -= substepInfo.SubstepSize;
+			substepInfo.NumSubsteps++;
+		}
+
+		// Catch up steps have to block, only the final one overlaps with the rest of the frame
+		for (uint32_t i = 0; i < substepInfo.NumSubsteps; i++)
+		{
+			if (i + 1 < substepInfo.NumSubsteps)
+			{
+				PhysicsScene::Simulate(substepInfo.SubstepSize, true);
+				RT_GatherActiveActors();
+			}
+			else
+			{
+				PhysicsScene::BeginSimulate(substepInfo.SubstepSize);
+			}
+		}
+
+		// Drop whatever we couldn't catch up on instead of spiraling on the next frame
+		if (substepInfo.Accumulator >= substepInfo.SubstepSize)
+		{
+			substepInfo.Accumulator = fmod(substepInfo.Accumulator, substepInfo.SubstepSize);
+		}
+
+		substepInfo.InterpolationFactor = substepInfo.Accumulator / substepInfo.SubstepSize;
 	}
 
-	void Physics::RT_UpdateActors()
+	void Physics::RT_GatherActiveActors()
 	{
-		for (const auto& [actorUUID, pxActor] : s_Data->ActiveActors)
+		const uint64_t step = ++s_Data->StepIndex;
+
+		std::vector<PhysicsActorData*>& writebackActors = s_Data->WritebackActors;
+
+		// Only bodies PhysX actually moved are reported, sleeping bodies cost nothing here
+		uint32_t activeActorCount = 0;
+		physx::PxActor** activeActors = ((physx::PxScene*)PhysicsScene::GetScene())->getActiveActors(activeActorCount);
+
+		for (uint32_t i = 0; i < activeActorCount; i++)
 		{
-			Actor actor = s_Data->ContextScene->TryGetActorWithUUID(actorUUID);
-			if (!actor)
+			PhysicsActorData* actorData = (PhysicsActorData*)activeActors[i]->userData;
+			if (!actorData || !actorData->DynamicActor)
 				continue;
 
+			const physx::PxTransform pose = actorData->DynamicActor->getGlobalPose();
+			actorData->PreviousTranslation = actorData->CurrentTranslation;
+			actorData->PreviousRotation = actorData->CurrentRotation;
+			actorData->CurrentTranslation = PhysicsUtils::FromPhysXVector(pose.p);
+			actorData->CurrentRotation = PhysicsUtils::FromPhysXQuat(pose.q);
+			actorData->LastActiveStep = step;
+
+			if (!actorData->PendingWriteback)
+			{
+				actorData->PendingWriteback = true;
+				writebackActors.push_back(actorData);
+			}
+		}
+
+		// Bodies that stopped moving settle on their final pose
+		for (PhysicsActorData* actorData : writebackActors)
+		{
+			if (actorData->LastActiveStep == step)
+				continue;
+
+			actorData->PreviousTranslation = actorData->CurrentTranslation;
+			actorData->PreviousRotation = actorData->CurrentRotation;
+		}
+	}
+
+	void Physics::RT_UpdateActors()
+	{
+		Scene* contextScene = s_Data->ContextScene;
+
+		// Render between the last two fixed steps so motion stays smooth at any frame rate
+		const float alpha = s_Data->SubstepInfo.InterpolationFactor;
+
+		std::vector<PhysicsActorData*>& writebackActors = s_Data->WritebackActors;
+
+		for (const PhysicsActorData* actorData : writebackActors)
+		{
+			Actor actor{ actorData->ActorHandle, contextScene };
 			const TransformComponent& transform = actor.GetTransform();
-			const RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
 
-			switch (rigidbody.Type)
+			const Math::vec3 translation = Math::Mix(actorData->PreviousTranslation, actorData->CurrentTranslation, alpha);
+			const Math::quaternion rotation = Math::Slerp(actorData->PreviousRotation, actorData->CurrentRotation, alpha);
+
+			actor.SetTransform(Math::Translate(translation) * Math::ToMat4(rotation) * Math::Scale(transform.Scale));
+		}
+
+		// Bodies that didn't move in the latest step have been written at rest, drop them until they wake up
+		const uint64_t step = s_Data->StepIndex;
+		size_t writeIndex = 0;
+
+		for (PhysicsActorData* actorData : writebackActors)
+		{
+			if (actorData->LastActiveStep != step)
 			{
-				case RigidBodyType::Static:
-				{
-					// unfortunately we can't just synchronize transforms,
-					// physx says it causes a performance penalty and you should use dynamic actor with kinematic abilities
-					// Synchronize with actor Transform
-					//pxActor->setGlobalPose(PhysicsUtils::ToPhysXTransform(transform));
-					break;
-				}
-				case RigidBodyType::Dynamic:
-				{
-					physx::PxRigidDynamic* dynamicActor = pxActor->is<physx::PxRigidDynamic>();
-					actor.SetTransform(PhysicsUtils::FromPhysXTransform(dynamicActor->getGlobalPose()) * Math::Scale(transform.Scale));
-					RT_UpdateDynamicActorProperties(rigidbody, dynamicActor);
-					break;
-				}
+				actorData->PendingWriteback = false;
+				continue;
 			}
+
+			writebackActors[writeIndex++] = actorData;
+		}
+
+		writebackActors.resize(writeIndex);
+	}
+
+	void Physics::RT_UpdateActorProperties()
+	{
+		Scene* contextScene = s_Data->ContextScene;
+
+		// Only bodies marked since the last update are compared against what PhysX already has
+		for (PhysicsActorData* actorData : s_Data->DirtyActors)
+		{
+			actorData->PendingPropertyPush = false;
+
+			Actor actor{ actorData->ActorHandle, contextScene };
+			const RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
+
+			Utils::UpdateVelocityDriven(actorData, rigidbody);
+
+			if (!Utils::DynamicPropertiesChanged(actorData->PushedProperties, rigidbody))
+				continue;
+
+			RT_UpdateDynamicActorProperties(rigidbody, actorData->DynamicActor);
+			actorData->PushedProperties = rigidbody;
 		}
+
+		s_Data->DirtyActors.clear();
+
+		for (const PhysicsActorData* actorData : s_Data->VelocityDrivenActors)
+		{
+			Actor actor{ actorData->ActorHandle, contextScene };
+			RT_UpdateDynamicActorVelocities(actor.GetComponent<RigidBodyComponent>(), actorData->DynamicActor);
+		}
+	}
+
+	void Physics::RT_TeleportActor(physx::PxRigidDynamic* dynamicActor, const physx::PxTransform& pose)
+	{
+		dynamicActor->setGlobalPose(pose);
+
+		// Start the next blend from the new pose instead of sweeping across from the old one
+		PhysicsActorData* actorData = (PhysicsActorData*)dynamicActor->userData;
+		actorData->PreviousTranslation = actorData->CurrentTranslation = PhysicsUtils::FromPhysXVector(pose.p);
+		actorData->PreviousRotation = actorData->CurrentRotation = PhysicsUtils::FromPhysXQuat(pose.q);
 	}
 
 	void Physics::RT_UpdateControllers()
@@ -395,9 +1196,25 @@ namespace Vortex {
 	void Physics::RT_RegisterPhysicsActor(Actor actor, physx::PxRigidActor* pxActor)
 	{
 		UUID actorUUID = actor.GetUUID();
-		PhysicsBodyData* physicsBodyData = new PhysicsBodyData();
+		PhysicsActorData* physicsBodyData = new PhysicsActorData();
 		physicsBodyData->ActorUUID = actorUUID;
+		physicsBodyData->ActorHandle = (entt::entity)actor;
 		physicsBodyData->ContextScene = actor.GetContextScene();
+		physicsBodyData->DynamicActor = pxActor->is<physx::PxRigidDynamic>();
+
+		const physx::PxTransform pose = pxActor->getGlobalPose();
+		physicsBodyData->PreviousTranslation = physicsBodyData->CurrentTranslation = PhysicsUtils::FromPhysXVector(pose.p);
+		physicsBodyData->PreviousRotation = physicsBodyData->CurrentRotation = PhysicsUtils::FromPhysXQuat(pose.q);
+
+		// Properties were applied when the actor was created
+		const RigidBodyComponent& rigidbody = actor.GetComponent<RigidBodyComponent>();
+		physicsBodyData->PushedProperties = rigidbody;
+
+		if (physicsBodyData->DynamicActor && rigidbody.Type == RigidBodyType::Dynamic)
+		{
+			Utils::UpdateVelocityDriven(physicsBodyData, rigidbody);
+		}
+
 		pxActor->userData = physicsBodyData;
 
 		VX_CORE_ASSERT(!s_Data->PhysicsBodyData.contains(actorUUID), "only one rigid actor allowed per actor!");
@@ -456,6 +1273,8 @@ namespace Vortex {
 			case RigidBodyType::Dynamic: RT_SetCollisionFilters(pxActor, (uint32_t)FilterGroup::Dynamic, filterMask); break;
 		}
 
+		RT_SetQueryFilters(pxActor, rigidbody.LayerID);
+
 		((physx::PxScene*)PhysicsScene::GetScene())->addActor(*pxActor);
 	}
 
@@ -477,6 +1296,7 @@ namespace Vortex {
 		pxActor->setName(actor.Name().c_str());
 
 		RT_SetCollisionFilters(pxActor, (uint32_t)FilterGroup::Dynamic, (uint32_t)FilterGroup::All);
+		RT_SetQueryFilters(pxActor, rigidbody.LayerID);
 	}
 
 	void Physics::RT_CreateCollider(Actor actor, physx::PxRigidActor* pxActor)
@@ -495,8 +1315,7 @@ namespace Vortex {
 		}
 		else if (actor.HasComponent<MeshColliderComponent>())
 		{
-			// TODO
-			//AddColliderShape(actor, pxActor, ColliderType::TriangleMesh);
+			AddColliderShape(actor, pxActor, GetMeshColliderType(actor));
 		}
 	}
 
@@ -686,16 +1505,29 @@ namespace Vortex {
 		s_Data->DefaultAllocator.deallocate(shapes);
 	}
 
-	void Physics::RT_UpdateDynamicActorProperties(const RigidBodyComponent& rigidbody, physx::PxRigidDynamic* dynamicActor)
+	void Physics::RT_SetQueryFilters(physx::PxRigidActor* actor, uint32_t layerID)
 	{
-		dynamicActor->setMass(rigidbody.Mass);
-		dynamicActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, rigidbody.IsKinematic);
-		dynamicActor->setActorFlag(physx::PxActorFlag::eDISABLE_GRAVITY, rigidbody.DisableGravity);
+		VX_CORE_ASSERT(layerID < 32, "Layer ID doesn't fit in a query layer mask!");
 
-		const uint32_t minPositionIterations = PhysicsScene::GetPositionIterations();
-		const uint32_t minVelocityIterations = PhysicsScene::GetVelocityIterations();
-		dynamicActor->setSolverIterationCounts(minPositionIterations, minVelocityIterations);
+		physx::PxFilterData filterData;
+		filterData.word0 = 1u << layerID; // word0 = layer bit tested against SceneQueryFilter::LayerMask
+
+		const physx::PxU32 numShapes = actor->getNbShapes();
+
+		physx::PxShape** shapes = (physx::PxShape**)s_Data->DefaultAllocator.allocate(sizeof(physx::PxShape*) * numShapes, "", "", 0);
+		actor->getShapes(shapes, numShapes);
+
+		for (physx::PxU32 i = 0; i < numShapes; i++)
+		{
+			physx::PxShape* shape = shapes[i];
+			shape->setQueryFilterData(filterData);
+		}
 
+		s_Data->DefaultAllocator.deallocate(shapes);
+	}
+
+	void Physics::RT_UpdateDynamicActorVelocities(const RigidBodyComponent& rigidbody, physx::PxRigidDynamic* dynamicActor)
+	{
 		if (rigidbody.LinearVelocity != Math::vec3(0.0f))
 		{
 			Math::vec3 linearVelocity = rigidbody.LinearVelocity;
@@ -706,9 +1538,6 @@ namespace Vortex {
 			dynamicActor->setLinearVelocity(PhysicsUtils::ToPhysXVector(linearVelocity));
 		}
 
-		dynamicActor->setMaxLinearVelocity(rigidbody.MaxLinearVelocity);
-		dynamicActor->setLinearDamping(rigidbody.LinearDrag);
-
 		if (rigidbody.AngularVelocity != Math::vec3(0.0f))
 		{
 			Math::vec3 angularVelocity = rigidbody.AngularVelocity;
@@ -718,6 +1547,22 @@ namespace Vortex {
 
 			dynamicActor->setAngularVelocity(PhysicsUtils::ToPhysXVector(angularVelocity));
 		}
+	}
+
+	void Physics::RT_UpdateDynamicActorProperties(const RigidBodyComponent& rigidbody, physx::PxRigidDynamic* dynamicActor)
+	{
+		dynamicActor->setMass(rigidbody.Mass);
+		dynamicActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, rigidbody.IsKinematic);
+		dynamicActor->setActorFlag(physx::PxActorFlag::eDISABLE_GRAVITY, rigidbody.DisableGravity);
+
+		const uint32_t minPositionIterations = PhysicsScene::GetPositionIterations();
+		const uint32_t minVelocityIterations = PhysicsScene::GetVelocityIterations();
+		dynamicActor->setSolverIterationCounts(minPositionIterations, minVelocityIterations);
+
+		RT_UpdateDynamicActorVelocities(rigidbody, dynamicActor);
+
+		dynamicActor->setMaxLinearVelocity(rigidbody.MaxLinearVelocity);
+		dynamicActor->setLinearDamping(rigidbody.LinearDrag);
 
 		dynamicActor->setMaxAngularVelocity(rigidbody.MaxAngularVelocity);
 		dynamicActor->setAngularDamping(rigidbody.AngularDrag);
@@ -787,6 +1632,12 @@ namespace Vortex {
 
 		actorsToCreate.assign(uniqueActors.begin(), uniqueActors.end());
 
+		// Colliders are sized from the cached world transforms, refresh them once for the whole batch
+		if (!actorsToCreate.empty())
+		{
+			s_Data->ContextScene->UpdateWorldSpaceTransforms();
+		}
+
 		for (UUID uuid : actorsToCreate)
 		{
 			Actor actor = s_Data->ContextScene->TryGetActorWithUUID(uuid);
@@ -883,10 +1734,14 @@ namespace Vortex {
 
 	void Physics::RT_DestroyPhysicsBodyDataInternal(UUID actorUUID)
 	{
-		const PhysicsBodyData* physicsBodyData = GetPhysicsBodyData(actorUUID);
+		const PhysicsActorData* physicsBodyData = (const PhysicsActorData*)GetPhysicsBodyData(actorUUID);
 		if (physicsBodyData == nullptr)
 			return;
 
+		Utils::RemoveActorData(s_Data->WritebackActors, physicsBodyData);
+		Utils::RemoveActorData(s_Data->DirtyActors, physicsBodyData);
+		Utils::RemoveActorData(s_Data->VelocityDrivenActors, physicsBodyData);
+
 		delete physicsBodyData;
 		s_Data->PhysicsBodyData.erase(actorUUID);
 	}
@@ -917,13 +1772,26 @@ namespace Vortex {
 		bool extentionsLoaded = PxInitExtensions(*s_Data->PhysXSDK, nullptr);
 		VX_CORE_ASSERT(extentionsLoaded, "Failed to initialize PhysX Extensions");
 
-		s_Data->Dispatcher = physx::PxDefaultCpuDispatcherCreate(1);
-
 		CookingFactory::Init();
 	}
 
 	void Physics::InitPhysicsSceneInternal()
 	{
+		SharedReference<Project> project = Project::GetActive();
+		const ProjectProperties& properties = project->GetProperties();
+
+		// Zero threads shares the job system workers, otherwise PhysX gets its own pool
+		const uint32_t dispatcherThreads = properties.PhysicsProps.Physics3DDispatcherThreads;
+		if (dispatcherThreads > 0)
+		{
+			s_Data->DefaultDispatcher = physx::PxDefaultCpuDispatcherCreate(dispatcherThreads);
+			s_Data->Dispatcher = s_Data->DefaultDispatcher;
+		}
+		else
+		{
+			s_Data->Dispatcher = &s_Data->JobDispatcher;
+		}
+
 		PhysicsScene::Init();
 		s_Data->ControllerManager = PxCreateControllerManager(*((physx::PxScene*)PhysicsScene::GetScene()));
 	}
@@ -932,7 +1800,6 @@ namespace Vortex {
 	{
 		CookingFactory::Shutdown();
 
-		s_Data->Dispatcher->release();
 		PxCloseExtensions();
 		s_Data->PhysXSDK->release();
 		s_Data->Foundation->release();
@@ -945,6 +1812,14 @@ namespace Vortex {
 
 		PhysicsScene::Shutdown();
 
+		if (s_Data->DefaultDispatcher)
+		{
+			s_Data->DefaultDispatcher->release();
+			s_Data->DefaultDispatcher = nullptr;
+		}
+
+		s_Data->Dispatcher = nullptr;
+
 		s_Data->ContextScene = nullptr;
 
 		s_Data->ActiveFixedJoints.clear();
@@ -955,6 +1830,11 @@ namespace Vortex {
 
 		s_Data->ConstrainedJointData.clear();
 		s_Data->PhysicsBodyData.clear();
+		s_Data->WritebackActors.clear();
+		s_Data->DirtyActors.clear();
+		s_Data->VelocityDrivenActors.clear();
+
+		s_Data->SerializedMemory.reset();
 	}
 
 	const std::unordered_map<UUID, physx::PxRigidActor*>& Physics::GetPhysicsActors()
@@ -1050,6 +1930,16 @@ namespace Vortex {
 		return nullptr;
 	}
 
+	const PhysicsStepTimings& Physics::GetStepTimings()
+	{
+		return s_Data->StepTimings;
+	}
+
+	void Physics::RT_AddContactCallbackTime(float milliseconds)
+	{
+		s_Data->StepTimings.ContactCallbacks += milliseconds;
+	}
+
 	Scene* Physics::GetContextScene()
 	{
 		return s_Data->ContextScene;
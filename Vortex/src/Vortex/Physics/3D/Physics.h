@@ -23,6 +23,7 @@ namespace physx {
 	class PxFixedJoint;
 	class PxRigidActor;
 	class PxRigidDynamic;
+	class PxTransform;
 	class PxControllerManager;
 	class PxSimulationStatistics;
 
@@ -30,6 +31,8 @@ namespace physx {
 
 namespace Vortex {
 
+	class StaticMesh;
+
 	class VORTEX_API Physics
 	{
 	public:
@@ -37,7 +40,10 @@ namespace Vortex {
 		static void Shutdown();
 
 		static void OnSimulationStart(Scene* contextScene);
+		// Kicks the physics step, it keeps running until OnSimulationFetchResults
 		static void OnSimulationUpdate(TimeStep delta);
+		// Sync point, waits for the running step and writes the results back to the scene
+		static void OnSimulationFetchResults();
 		static void OnSimulationStop(Scene* contextScene);
 
 		static bool IsPhysicsActor(UUID actorUUID);
@@ -46,11 +52,31 @@ namespace Vortex {
 		static void ReCreateActor(Actor actor);
 		static void DestroyPhysicsActor(Actor actor);
 
+		// Queues the actor's RigidBodyComponent to be pushed on the next update, call after changing its fields at runtime
+		static void MarkActorDirty(Actor actor);
 		static void WakeUpActor(Actor actor);
 
+		// The collider asset if one is set, otherwise the mesh the actor renders
+		static SharedReference<StaticMesh> GetMeshColliderAsset(Actor actor);
+		// Triangle meshes can't simulate on dynamic bodies, those always use a convex hull
+		static ColliderType GetMeshColliderType(Actor actor);
+
+		// Rollback, poses and velocities are written back in place without rebuilding anything
+		// Actors destroyed after the capture aren't brought back
+		static void CaptureSnapshot(PhysicsSnapshot& outSnapshot);
+		static void RestoreSnapshot(const PhysicsSnapshot& snapshot);
+
+		// Every built rigid actor with its shapes, materials and cooked meshes as a PhysX binary collection
+		static bool SerializeScene(std::vector<uint8_t>& outData);
+		// Adds a serialized collection to the running scene in one call, its actors are not built again
+		static bool DeserializeScene(const uint8_t* data, uint64_t size);
+
 		static bool IsConstraintBroken(UUID actorUUID);
 		static void BreakJoint(UUID actorUUID);
 
+		// Moves a dynamic actor without interpolating from its old pose
+		static void RT_TeleportActor(physx::PxRigidDynamic* dynamicActor, const physx::PxTransform& pose);
+
 		static void RT_DisplaceCharacterController(TimeStep delta, UUID actorUUID, const Math::vec3& displacement);
 
 		static const std::unordered_map<UUID, physx::PxRigidActor*>& GetPhysicsActors();
@@ -67,6 +93,10 @@ namespace Vortex {
 		static const PhysicsBodyData* GetPhysicsBodyData(UUID actorUUID);
 		static const ConstrainedJointData* GetConstrainedJointData(UUID actorUUID);
 
+		static const PhysicsStepTimings& GetStepTimings();
+		// Called by the contact listener, callbacks run inside the fetch
+		static void RT_AddContactCallbackTime(float milliseconds);
+
 		static Scene* GetContextScene();
 
 		static void* GetDispatcher();
@@ -86,9 +116,11 @@ namespace Vortex {
 		static void ShutdownPhysicsSDKInternal();
 		static void ShutdownPhysicsSceneInternal();
 
-		static void RT_SimulationStep();
+		static void RT_SimulationStep(TimeStep delta);
+		static void RT_GatherActiveActors();
 
 		static void RT_UpdateActors();
+		static void RT_UpdateActorProperties();
 		static void RT_UpdateControllers();
 		static void RT_UpdateJoints();
 
@@ -97,6 +129,10 @@ namespace Vortex {
 		static void RT_CreatePhysicsActorInternal(Actor actor);
 		static void RT_CreateCharacterControllerInternal(Actor actor);
 
+		static bool RT_RestoreCachedScene(uint64_t sceneHash);
+		static void RT_CacheScene(uint64_t sceneHash);
+		static void RT_AdoptColliderShapes(Actor actor, physx::PxRigidActor* pxActor);
+
 		static void RT_CreateCollider(Actor actor, physx::PxRigidActor* pxActor);
 		static void AddColliderShape(Actor actor, physx::PxRigidActor* pxActor, ColliderType type);
 		static std::vector<SharedReference<ColliderShape>>& GetActorColliderShapesInternal(UUID actorUUID);
@@ -105,6 +141,8 @@ namespace Vortex {
 		static physx::PxController* RT_CreateController(Actor actor, physx::PxRigidActor* pxActor);
 
 		static void RT_SetCollisionFilters(physx::PxRigidActor* actor, uint32_t filterGroup, uint32_t filterMask);
+		static void RT_SetQueryFilters(physx::PxRigidActor* actor, uint32_t layerID);
+		static void RT_UpdateDynamicActorVelocities(const RigidBodyComponent& rigidbody, physx::PxRigidDynamic* dynamicActor);
 		static void RT_UpdateDynamicActorProperties(const RigidBodyComponent& rigidbody, physx::PxRigidDynamic* dynamicActor);
 		static void InitializeUninitializedActors();
 
@@ -4,12 +4,58 @@
 #include "Vortex/Physics/3D/Physics.h"
 
 #include "Vortex/Scripting/ScriptEngine.h"
+#include "Vortex/Scripting/ScriptInstance.h"
+#include "Vortex/Scripting/ScriptUtils.h"
+#include "Vortex/Scripting/ManagedArray.h"
 #include "Vortex/Scripting/RuntimeMethodArgument.h"
 
+#include <chrono>
+
 namespace Vortex {
 
+	namespace Utils {
+
+		// Adds the time spent in a callback to the step timings, whichever way the callback returns
+		class ScopedCallbackTimer
+		{
+		public:
+			ScopedCallbackTimer()
+				: m_Start(std::chrono::steady_clock::now()) { }
+
+			~ScopedCallbackTimer()
+			{
+				Physics::RT_AddContactCallbackTime(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_Start).count());
+			}
+
+		private:
+			std::chrono::steady_clock::time_point m_Start;
+		};
+
+		static constexpr ScriptMethod s_ContactMethods[] =
+		{
+			ScriptMethod::OnCollisionEnter, ScriptMethod::OnCollisionExit,
+			ScriptMethod::OnTriggerEnter, ScriptMethod::OnTriggerExit,
+		};
+
+		static uint8_t ContactMethodBit(ScriptMethod method)
+		{
+			return (uint8_t)(1u << ((uint32_t)method - (uint32_t)ScriptMethod::OnCollisionEnter));
+		}
+
+		// Matches the order of the managed ContactEventType
+		static uint32_t ContactEventType(ScriptMethod method)
+		{
+			return (uint32_t)method - (uint32_t)ScriptMethod::OnCollisionEnter;
+		}
+
+		static constexpr uint32_t s_InvalidReceiverIndex = UINT32_MAX;
+
+	}
+
 	void PhysicsContactListener::onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count)
 	{
+		Utils::ScopedCallbackTimer timer;
+
 		Scene* contextScene = ScriptEngine::GetContextScene();
 
 		if (!contextScene || !contextScene->IsRunning())
@@ -49,16 +95,10 @@ namespace Vortex {
 				continue;
 			}
 
-			if (nativeJoint->is<physx::PxFixedJoint>())
+			// Scripts can't run inside the fetch, the forces are captured now and delivered with the contact events
+			if (physx::PxFixedJoint* fixedJoint = nativeJoint->is<physx::PxFixedJoint>())
 			{
-				ScriptMethod method = ScriptMethod::OnFixedJointDisconnected;
-				physx::PxFixedJoint* fixedJoint = nativeJoint->is<physx::PxFixedJoint>();
-				const std::pair<Math::vec3, Math::vec3>& forceAndTorque = Physics::GetLastReportedFixedJointForces(fixedJoint);
-
-				RuntimeMethodArgument arg0(forceAndTorque);
-
-				actor.CallMethod(method, { arg0 });
-				connectedActor.CallMethod(method, { arg0 });
+				m_JointBreakEvents.push_back({ actor.GetUUID(), connectedActor.GetUUID(), Physics::GetLastReportedFixedJointForces(fixedJoint) });
 			}
 		}
 	}
@@ -77,6 +117,8 @@ namespace Vortex {
 
 	void PhysicsContactListener::onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs)
 	{
+		Utils::ScopedCallbackTimer timer;
+
 		Scene* contextScene = ScriptEngine::GetContextScene();
 
 		if (!contextScene || !contextScene->IsRunning())
@@ -105,44 +147,26 @@ namespace Vortex {
 			return;
 		}
 
-		Actor actorA = contextScene->TryGetActorWithUUID(actorA_UserData->ActorUUID);
-		Actor actorB = contextScene->TryGetActorWithUUID(actorB_UserData->ActorUUID);
-
-		if (!actorA || !actorB)
+		// Scripts can't run inside the fetch, events are buffered and delivered once the step is written back
+		for (uint32_t i = 0; i < nbPairs; i++)
 		{
-			return;
-		}
-
-		if (pairs->flags == physx::PxContactPairFlag::eACTOR_PAIR_HAS_FIRST_TOUCH)
-		{
-			ScriptMethod method = ScriptMethod::OnCollisionEnter;
-			Collision collision{};
-
-			collision.ActorID = actorB.GetUUID();
-			RuntimeMethodArgument arg0(collision);
-			actorA.CallMethod(method, { arg0 });
-
-			collision.ActorID = actorA.GetUUID();
-			RuntimeMethodArgument arg1(collision);
-			actorB.CallMethod(method, { arg1 });
-		}
-		else if (pairs->flags == physx::PxContactPairFlag::eACTOR_PAIR_LOST_TOUCH)
-		{
-			ScriptMethod method = ScriptMethod::OnCollisionExit;
-			Collision collision{};
-
-			collision.ActorID = actorB.GetUUID();
-			RuntimeMethodArgument arg0(collision);
-			actorA.CallMethod(method, { arg0 });
+			// A pair that touches and separates within one step reports both, the enter comes first
+			if (pairs[i].flags & physx::PxContactPairFlag::eACTOR_PAIR_HAS_FIRST_TOUCH)
+			{
+				RecordEvent(contextScene, actorA_UserData->ActorUUID, actorB_UserData->ActorUUID, ScriptMethod::OnCollisionEnter, false);
+			}
 
-			collision.ActorID = actorA.GetUUID();
-			RuntimeMethodArgument arg1(collision);
-			actorB.CallMethod(method, { arg1 });
+			if (pairs[i].flags & physx::PxContactPairFlag::eACTOR_PAIR_LOST_TOUCH)
+			{
+				RecordEvent(contextScene, actorA_UserData->ActorUUID, actorB_UserData->ActorUUID, ScriptMethod::OnCollisionExit, false);
+			}
 		}
 	}
 
 	void PhysicsContactListener::onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count)
 	{
+		Utils::ScopedCallbackTimer timer;
+
 		Scene* contextScene = ScriptEngine::GetContextScene();
 
 		if (!contextScene || !contextScene->IsRunning())
@@ -156,86 +180,220 @@ namespace Vortex {
 				continue;
 
 			const PhysicsBodyData* triggerActorUserData = (const PhysicsBodyData*)pairs[i].triggerActor->userData;
-			PhysicsBodyData* otherActorUserData = (PhysicsBodyData*)pairs[i].otherActor->userData;
+			const PhysicsBodyData* otherActorUserData = (const PhysicsBodyData*)pairs[i].otherActor->userData;
 
 			if (!triggerActorUserData)
 				continue;
 
-			bool foundController = false;
+			UUID otherActorUUID = 0;
 
 			// TODO: currently we just look for the first controller
 			// in the scene and use is as the 'otherActor', this will probably need to be
 			// expanded in the future to find the actual controller, (i.e. if we had a scene with multiple character controllers we would have some weird bugs with triggers)
-			if (!otherActorUserData)
+			if (otherActorUserData)
+			{
+				otherActorUUID = otherActorUserData->ActorUUID;
+			}
+			else
 			{
 				// since all rigid actors have userData because Physics creates it for them
 				// lets try to look for a controller, because nothing else in the scene could be the 'otherActor'
 				const std::unordered_map<UUID, physx::PxController*>& controllers = Physics::GetControllers();
 
-				for (const auto& [actorUUID, pxController] : controllers)
-				{
-					otherActorUserData = new PhysicsBodyData();
-					otherActorUserData->ActorUUID = actorUUID;
-					otherActorUserData->ContextScene = contextScene;
-					foundController = true;
-					break;
-				}
-
 				// we didn't find a controller
-				if (otherActorUserData == nullptr)
+				if (controllers.empty())
 					continue;
+
+				otherActorUUID = controllers.begin()->first;
+			}
+
+			if (pairs[i].status == physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
+			{
+				RecordEvent(contextScene, triggerActorUserData->ActorUUID, otherActorUUID, ScriptMethod::OnTriggerEnter, true);
+			}
+			else if (pairs[i].status == physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
+			{
+				RecordEvent(contextScene, triggerActorUserData->ActorUUID, otherActorUUID, ScriptMethod::OnTriggerExit, true);
 			}
+		}
+	}
+
+	void PhysicsContactListener::onAdvance(const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count)
+	{
+		PX_UNUSED(bodyBuffer);
+		PX_UNUSED(poseBuffer);
+		PX_UNUSED(count);
+	}
+
+	void PhysicsContactListener::DispatchEvents()
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (m_Events.empty() && m_JointBreakEvents.empty())
+		{
+			ClearEvents();
+			return;
+		}
+
+		Scene* contextScene = ScriptEngine::GetContextScene();
 
-			Actor triggerActor = contextScene->TryGetActorWithUUID(triggerActorUserData->ActorUUID);
-			Actor otherActor = contextScene->TryGetActorWithUUID(otherActorUserData->ActorUUID);
+		if (!contextScene || !contextScene->IsRunning())
+		{
+			ClearEvents();
+			return;
+		}
+
+		// Scripts can move bodies or force a fetch, anything recorded from here on waits for the next dispatch
+		m_DispatchEvents.swap(m_Events);
+		m_DispatchJointBreakEvents.swap(m_JointBreakEvents);
+		ClearEvents();
+
+		DispatchContactEvents(contextScene);
+		DispatchJointBreakEvents(contextScene);
+
+		m_DispatchEvents.clear();
+		m_DispatchJointBreakEvents.clear();
+	}
+
+	void PhysicsContactListener::DispatchContactEvents(Scene* contextScene)
+	{
+		if (m_DispatchEvents.empty())
+			return;
 
-#ifdef VX_DEBUG
-			const std::string& triggerActorName = triggerActor.GetName();
-			const std::string& otherActorName = otherActor.GetName();
-#endif
+		m_ReceiverIndices.clear();
+		m_Receivers.clear();
+		m_ManagedEvents.clear();
 
-			if (foundController)
+		// Each receiver is resolved once, events for actors whose script went away or was disabled are dropped
+		for (const ContactEvent& contactEvent : m_DispatchEvents)
+		{
+			auto [it, inserted] = m_ReceiverIndices.try_emplace(contactEvent.Receiver, Utils::s_InvalidReceiverIndex);
+
+			if (inserted)
 			{
-				delete otherActorUserData;
+				Actor receiver = contextScene->TryGetActorWithUUID(contactEvent.Receiver);
+
+				if (receiver && ScriptEngine::ScriptInstanceExists(contactEvent.Receiver) && ScriptEngine::IsScriptComponentEnabled(receiver))
+				{
+					it->second = (uint32_t)m_Receivers.size();
+					m_Receivers.push_back(contactEvent.Receiver);
+				}
 			}
 
-			if (!triggerActor || !otherActor)
+			if (it->second == Utils::s_InvalidReceiverIndex)
 				continue;
 
-			if (pairs[i].status == physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
-			{
-				ScriptMethod method = ScriptMethod::OnTriggerEnter;
-				Collision collision{};
+			m_ManagedEvents.push_back({ it->second, Utils::ContactEventType(contactEvent.Method), (uint64_t)contactEvent.Other });
+		}
+
+		if (m_ManagedEvents.empty())
+			return;
 
-				collision.ActorID = otherActor.GetUUID();
-				RuntimeMethodArgument arg0(collision);
-				triggerActor.CallMethod(method, { arg0 });
+		SharedReference<ScriptClass> actorClass = ScriptEngine::GetCoreActorClass();
+		MonoClass* eventClass = ScriptUtils::GetClassFromAssemblyImageByName(ScriptEngine::GetScriptCoreAssemblyImage(), "Vortex", "ContactEvent");
+		MonoMethod* dispatchMethod = actorClass->GetMethod("DispatchContactEvents", 2);
+
+		VX_CORE_ASSERT(eventClass && dispatchMethod, "Script core is missing the contact event dispatcher!");
+		if (!eventClass || !dispatchMethod)
+			return;
+
+		// One managed call for the whole step instead of one per event
+		ManagedArray events(eventClass, m_ManagedEvents.size());
+		memcpy(mono_array_addr(events.GetHandle(), ManagedContactEvent, 0), m_ManagedEvents.data(), m_ManagedEvents.size() * sizeof(ManagedContactEvent));
+
+		ManagedArray receivers(actorClass->GetMonoClass(), m_Receivers.size());
+		for (uint32_t i = 0; i < (uint32_t)m_Receivers.size(); i++)
+		{
+			mono_array_setref(receivers.GetHandle(), i, ScriptEngine::GetScriptInstance(m_Receivers[i])->GetManagedObject());
+		}
 
-				collision.ActorID = triggerActor.GetUUID();
-				RuntimeMethodArgument arg1(collision);
-				otherActor.CallMethod(method, { arg1 });
+		void* params[] = { receivers.GetHandle(), events.GetHandle() };
+		ScriptUtils::RT_HandleInvokeResult(ScriptUtils::InvokeManagedMethod(nullptr, dispatchMethod, params));
+	}
+
+	void PhysicsContactListener::DispatchJointBreakEvents(Scene* contextScene)
+	{
+		for (const JointBreakEvent& breakEvent : m_DispatchJointBreakEvents)
+		{
+			const ScriptMethod method = ScriptMethod::OnFixedJointDisconnected;
+			RuntimeMethodArgument arg0(breakEvent.ForceAndTorque);
+
+			if (Actor actor = contextScene->TryGetActorWithUUID(breakEvent.ActorUUID))
+			{
+				actor.CallMethod(method, { arg0 });
 			}
-			else if (pairs[i].status == physx::PxPairFlag::eNOTIFY_TOUCH_LOST)
+
+			if (Actor connectedActor = contextScene->TryGetActorWithUUID(breakEvent.ConnectedActorUUID))
 			{
-				ScriptMethod method = ScriptMethod::OnTriggerExit;
-				Collision collision{};
+				connectedActor.CallMethod(method, { arg0 });
+			}
+		}
+	}
 
-				collision.ActorID = otherActor.GetUUID();
-				RuntimeMethodArgument arg0(collision);
-				triggerActor.CallMethod(method, { arg0 });
+	void PhysicsContactListener::ClearEvents()
+	{
+		m_Events.clear();
+		m_JointBreakEvents.clear();
+		m_LastPairEvents.clear();
+		m_MethodMasks.clear();
+	}
 
-				collision.ActorID = triggerActor.GetUUID();
-				RuntimeMethodArgument arg1(collision);
-				otherActor.CallMethod(method, { arg1 });
-			}
+	void PhysicsContactListener::RecordEvent(Scene* contextScene, UUID first, UUID second, ScriptMethod method, bool isTrigger)
+	{
+		const ContactPair pair = (uint64_t)first < (uint64_t)second
+			? ContactPair{ first, second, isTrigger }
+			: ContactPair{ second, first, isTrigger };
+
+		// Multi shape actors and catch up steps report the same transition more than once
+		auto [it, inserted] = m_LastPairEvents.try_emplace(pair, method);
+		if (!inserted)
+		{
+			if (it->second == method)
+				return;
+
+			it->second = method;
+		}
+
+		const uint8_t methodBit = Utils::ContactMethodBit(method);
+
+		if (GetMethodMask(contextScene, first) & methodBit)
+		{
+			m_Events.push_back({ first, second, method });
+		}
+
+		if (GetMethodMask(contextScene, second) & methodBit)
+		{
+			m_Events.push_back({ second, first, method });
 		}
 	}
 
-	void PhysicsContactListener::onAdvance(const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count)
+	uint8_t PhysicsContactListener::GetMethodMask(Scene* contextScene, UUID actorUUID)
 	{
-		PX_UNUSED(bodyBuffer);
-		PX_UNUSED(poseBuffer);
-		PX_UNUSED(count);
+		auto it = m_MethodMasks.find(actorUUID);
+		if (it != m_MethodMasks.end())
+		{
+			return it->second;
+		}
+
+		uint8_t methodMask = 0;
+
+		// Actors without a script that implements the method never make it into the buffer
+		Actor actor = contextScene->TryGetActorWithUUID(actorUUID);
+		if (actor && actor.HasComponent<ScriptComponent>() && ScriptEngine::ScriptInstanceExists(actorUUID))
+		{
+			SharedReference<ScriptInstance> instance = ScriptEngine::GetScriptInstance(actorUUID);
+
+			for (ScriptMethod method : Utils::s_ContactMethods)
+			{
+				if (instance && instance->ScriptMethodExists(method))
+				{
+					methodMask |= Utils::ContactMethodBit(method);
+				}
+			}
+		}
+
+		m_MethodMasks[actorUUID] = methodMask;
+		return methodMask;
 	}
 
 }
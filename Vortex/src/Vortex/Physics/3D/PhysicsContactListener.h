@@ -1,9 +1,20 @@
 #pragma once
 
+#include "Vortex/Core/UUID.h"
+
+#include "Vortex/Math/Math.h"
+
+#include "Vortex/Scripting/ScriptMethods.h"
+
 #include <PhysX/PxPhysicsAPI.h>
 
+#include <unordered_map>
+#include <vector>
+
 namespace Vortex {
 
+	class Scene;
+
 	class PhysicsContactListener : public physx::PxSimulationEventCallback
 	{
 	public:
@@ -15,6 +26,72 @@ namespace Vortex {
 		virtual void onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs) override;
 		virtual void onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count) override;
 		virtual void onAdvance(const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count) override;
+
+		// Delivers the buffered contact, trigger and joint break events once the step has been written back
+		void DispatchEvents();
+		void ClearEvents();
+
+	private:
+		struct ContactEvent
+		{
+			UUID Receiver;
+			UUID Other;
+			ScriptMethod Method;
+		};
+
+		struct JointBreakEvent
+		{
+			UUID ActorUUID;
+			UUID ConnectedActorUUID;
+			std::pair<Math::vec3, Math::vec3> ForceAndTorque;
+		};
+
+		// Layout must match the managed ContactEvent in Collision.cs
+		struct ManagedContactEvent
+		{
+			uint32_t ReceiverIndex;
+			uint32_t Type;
+			uint64_t OtherID;
+		};
+
+		struct ContactPair
+		{
+			UUID First;
+			UUID Second;
+			bool IsTrigger;
+
+			bool operator==(const ContactPair& other) const = default;
+		};
+
+		struct ContactPairHash
+		{
+			size_t operator()(const ContactPair& pair) const
+			{
+				return std::hash<UUID>()(pair.First) ^ (std::hash<UUID>()(pair.Second) << 1) ^ (size_t)pair.IsTrigger;
+			}
+		};
+
+		void DispatchContactEvents(Scene* contextScene);
+		void DispatchJointBreakEvents(Scene* contextScene);
+
+		void RecordEvent(Scene* contextScene, UUID first, UUID second, ScriptMethod method, bool isTrigger);
+		uint8_t GetMethodMask(Scene* contextScene, UUID actorUUID);
+
+	private:
+		std::vector<ContactEvent> m_Events;
+		std::vector<ContactEvent> m_DispatchEvents;
+		std::vector<JointBreakEvent> m_JointBreakEvents;
+		std::vector<JointBreakEvent> m_DispatchJointBreakEvents;
+
+		// Scratch for building the managed batch, kept to reuse their allocations
+		std::unordered_map<UUID, uint32_t> m_ReceiverIndices;
+		std::vector<UUID> m_Receivers;
+		std::vector<ManagedContactEvent> m_ManagedEvents;
+
+		// Last event recorded for each pair, repeats from other shapes or catch up steps are dropped
+		std::unordered_map<ContactPair, ScriptMethod, ContactPairHash> m_LastPairEvents;
+		// Which contact methods each actor's script implements, looked up once per dispatch
+		std::unordered_map<UUID, uint8_t> m_MethodMasks;
 	};
 
 }
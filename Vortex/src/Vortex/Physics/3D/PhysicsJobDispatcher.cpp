@@ -0,0 +1,27 @@
+#include "vxpch.h"
+#include "PhysicsJobDispatcher.h"
+
+#include "Vortex/Core/JobSystem.h"
+
+namespace Vortex {
+
+	void PhysicsJobDispatcher::submitTask(physx::PxBaseTask& task)
+	{
+		physx::PxBaseTask* pxTask = &task;
+
+		JobSystem::Submit([pxTask]()
+		{
+			VX_PROFILE_SCOPE("PhysX Task");
+
+			pxTask->run();
+			// Releasing the task is what lets PhysX schedule its dependents
+			pxTask->release();
+		});
+	}
+
+	physx::PxU32 PhysicsJobDispatcher::getWorkerCount() const
+	{
+		return JobSystem::GetWorkerCount();
+	}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <PhysX/PxPhysicsAPI.h>
+
+namespace Vortex {
+
+	// Runs PhysX tasks on the engine's job system workers so physics
+	// shares cores with the rest of the frame instead of owning its own threads
+	class PhysicsJobDispatcher : public physx::PxCpuDispatcher
+	{
+	public:
+		virtual ~PhysicsJobDispatcher() override = default;
+
+		virtual void submitTask(physx::PxBaseTask& task) override;
+		virtual physx::PxU32 getWorkerCount() const override;
+	};
+
+}
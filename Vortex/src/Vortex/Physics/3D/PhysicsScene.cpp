@@ -8,6 +8,8 @@
 
 #include "Vortex/Project/Project.h"
 
+#include "Vortex/Core/JobSystem.h"
+
 #include <PhysX/PxPhysicsAPI.h>
 
 namespace Vortex {
@@ -21,10 +23,111 @@ namespace Vortex {
 		Math::vec3 Gravity = Math::vec3(0.0f, -9.81f, 0.0f);
 		uint32_t PositionIterations = 8;
 		uint32_t VeloctiyIterations = 2;
+		uint32_t TickRate = 100;
+		uint32_t MaxSubsteps = 8;
+
+		bool IsSimulating = false;
 	};
 
 	static PhysicsSceneInternalData s_Data;
 
+	// Queries handed to each job, enough to amortize the job overhead for cheap rays
+	static constexpr uint32_t s_QueryBatchSize = 32;
+
+	namespace Utils {
+
+		// Turns every shape that passes the layer test into a touch so the query reports all hits
+		class TouchAllQueryFilter : public physx::PxQueryFilterCallback
+		{
+		public:
+			virtual physx::PxQueryHitType::Enum preFilter(const physx::PxFilterData& filterData, const physx::PxShape* shape, const physx::PxRigidActor* actor, physx::PxHitFlags& queryFlags) override
+			{
+				return physx::PxQueryHitType::eTOUCH;
+			}
+
+			virtual physx::PxQueryHitType::Enum postFilter(const physx::PxFilterData& filterData, const physx::PxQueryHit& hit) override
+			{
+				return physx::PxQueryHitType::eTOUCH;
+			}
+		};
+
+		static physx::PxQueryFilterData ToPhysXQueryFilterData(const SceneQueryFilter& filter)
+		{
+			physx::PxQueryFilterData filterData;
+
+			// A full mask skips the layer test entirely, shapes without query data still get hit
+			if (filter.LayerMask != 0xFFFFFFFF)
+			{
+				filterData.data.word0 = filter.LayerMask;
+			}
+
+			if (filter.MaxHits > 1)
+			{
+				filterData.flags |= physx::PxQueryFlag::ePREFILTER;
+			}
+
+			return filterData;
+		}
+
+		static physx::PxGeometryHolder ToPhysXGeometry(const QueryGeometry& geometry)
+		{
+			switch (geometry.Type)
+			{
+				case QueryGeometryType::Sphere:  return physx::PxSphereGeometry(geometry.Radius);
+				case QueryGeometryType::Box:     return physx::PxBoxGeometry(PhysicsUtils::ToPhysXVector(geometry.HalfSize));
+				case QueryGeometryType::Capsule: return physx::PxCapsuleGeometry(geometry.Radius, geometry.HalfHeight);
+			}
+
+			VX_CORE_ASSERT(false, "Unknown query geometry type!");
+			return physx::PxSphereGeometry(geometry.Radius);
+		}
+
+		static uint64_t GetHitActorID(const physx::PxRigidActor* actor)
+		{
+			const PhysicsBodyData* physicsBodyData = (const PhysicsBodyData*)actor->userData;
+			return physicsBodyData ? (uint64_t)physicsBodyData->ActorUUID : 0;
+		}
+
+		static void FromPhysXHit(const physx::PxLocationHit& hit, RaycastHit* outHit)
+		{
+			outHit->ActorID = GetHitActorID(hit.actor);
+			outHit->Position = PhysicsUtils::FromPhysXVector(hit.position);
+			outHit->Normal = PhysicsUtils::FromPhysXVector(hit.normal);
+			outHit->Distance = hit.distance;
+		}
+
+		template <typename THit>
+		static THit* GetTouchBuffer(uint32_t size)
+		{
+			thread_local std::vector<THit> s_Touches;
+			if (s_Touches.size() < size)
+			{
+				s_Touches.resize(size);
+			}
+
+			return s_Touches.data();
+		}
+
+		// Touches come back in whatever order PhysX found them, if the buffer
+		// fills up these are the first hits found rather than the closest ones
+		template <typename THit>
+		static uint32_t CopyTouches(physx::PxHitBuffer<THit>& buffer, RaycastHit* outHits)
+		{
+			THit* touches = buffer.touches;
+			const uint32_t touchCount = buffer.nbTouches;
+
+			std::sort(touches, touches + touchCount, [](const THit& lhs, const THit& rhs) { return lhs.distance < rhs.distance; });
+
+			for (uint32_t i = 0; i < touchCount; i++)
+			{
+				FromPhysXHit(touches[i], outHits + i);
+			}
+
+			return touchCount;
+		}
+
+	}
+
 	void PhysicsScene::Init()
 	{
 		physx::PxSceneDesc sceneDescription = physx::PxSceneDesc(*((physx::PxTolerancesScale*)Physics::GetTolerancesScale()));
@@ -40,7 +143,7 @@ namespace Vortex {
 		sceneDescription.broadPhaseType = PhysicsUtils::VortexBroadphaseTypeToPhysXBroadphaseType(properties.PhysicsProps.BroadphaseModel);
 		sceneDescription.frictionType = PhysicsUtils::VortexFrictionTypeToPhysXFrictionType(properties.PhysicsProps.FrictionModel);
 
-		sceneDescription.cpuDispatcher = ((physx::PxDefaultCpuDispatcher*)Physics::GetDispatcher());
+		sceneDescription.cpuDispatcher = ((physx::PxCpuDispatcher*)Physics::GetDispatcher());
 		sceneDescription.filterShader = PhysicsFilterShader::FilterShader;
 		sceneDescription.simulationEventCallback = &s_Data.ContactListener;
 
@@ -49,14 +152,47 @@ namespace Vortex {
 
 	void PhysicsScene::Shutdown()
 	{
+		FetchResults(true);
+		s_Data.ContactListener.ClearEvents();
+
 		s_Data.Scene->release();
 		s_Data.Scene = nullptr;
 	}
 
 	void PhysicsScene::Simulate(TimeStep delta, bool block)
 	{
+		BeginSimulate(delta);
+		FetchResults(block);
+	}
+
+	void PhysicsScene::BeginSimulate(TimeStep delta)
+	{
+		VX_CORE_ASSERT(!s_Data.IsSimulating, "Physics scene is already simulating!");
+
 		s_Data.Scene->simulate(delta);
-		s_Data.Scene->fetchResults(block);
+		s_Data.IsSimulating = true;
+	}
+
+	bool PhysicsScene::FetchResults(bool block)
+	{
+		if (!s_Data.IsSimulating)
+			return true;
+
+		if (!s_Data.Scene->fetchResults(block))
+			return false;
+
+		s_Data.IsSimulating = false;
+		return true;
+	}
+
+	bool PhysicsScene::IsSimulating()
+	{
+		return s_Data.IsSimulating;
+	}
+
+	void PhysicsScene::DispatchContactEvents()
+	{
+		s_Data.ContactListener.DispatchEvents();
 	}
 
 	const Math::vec3& PhysicsScene::GetGravity()
@@ -97,6 +233,26 @@ namespace Vortex {
 		s_Data.PositionIterations = iterations;
 	}
 
+	uint32_t PhysicsScene::GetTickRate()
+	{
+		return s_Data.TickRate;
+	}
+
+	void PhysicsScene::SetTickRate(uint32_t tickRate)
+	{
+		s_Data.TickRate = Math::Max(tickRate, 1u);
+	}
+
+	uint32_t PhysicsScene::GetMaxSubsteps()
+	{
+		return s_Data.MaxSubsteps;
+	}
+
+	void PhysicsScene::SetMaxSubsteps(uint32_t maxSubsteps)
+	{
+		s_Data.MaxSubsteps = Math::Max(maxSubsteps, 1u);
+	}
+
 	void PhysicsScene::WakeUpActors()
 	{
 		VX_PROFILE_FUNCTION();
@@ -160,4 +316,127 @@ namespace Vortex {
 		return 1;
 	}
 
+	void PhysicsScene::RaycastBatch(const RaycastQuery* queries, uint32_t count, const SceneQueryFilter& filter, RaycastHit* outHits, uint32_t* outHitCounts)
+	{
+		VX_PROFILE_FUNCTION();
+
+		const physx::PxQueryFilterData filterData = Utils::ToPhysXQueryFilterData(filter);
+		const uint32_t maxHits = Math::Max(filter.MaxHits, 1u);
+
+		JobSystem::ParallelFor(count, [&](uint32_t index)
+		{
+			const RaycastQuery& query = queries[index];
+			RaycastHit* hits = outHits + (size_t)index * maxHits;
+
+			const physx::PxVec3 origin = PhysicsUtils::ToPhysXVector(query.Origin);
+			const physx::PxVec3 direction = PhysicsUtils::ToPhysXVector(Math::Normalize(query.Direction));
+
+			if (maxHits == 1)
+			{
+				physx::PxRaycastBuffer buffer;
+				s_Data.Scene->raycast(origin, direction, query.MaxDistance, buffer, physx::PxHitFlag::eDEFAULT, filterData);
+
+				outHitCounts[index] = buffer.hasBlock ? 1 : 0;
+				if (buffer.hasBlock)
+				{
+					Utils::FromPhysXHit(buffer.block, hits);
+				}
+
+				return;
+			}
+
+			Utils::TouchAllQueryFilter touchAllFilter;
+			physx::PxRaycastBuffer buffer(Utils::GetTouchBuffer<physx::PxRaycastHit>(maxHits), maxHits);
+			s_Data.Scene->raycast(origin, direction, query.MaxDistance, buffer, physx::PxHitFlag::eDEFAULT, filterData, &touchAllFilter);
+
+			outHitCounts[index] = Utils::CopyTouches(buffer, hits);
+		}, nullptr, s_QueryBatchSize);
+	}
+
+	void PhysicsScene::SweepBatch(const SweepQuery* queries, uint32_t count, const SceneQueryFilter& filter, RaycastHit* outHits, uint32_t* outHitCounts)
+	{
+		VX_PROFILE_FUNCTION();
+
+		const physx::PxQueryFilterData filterData = Utils::ToPhysXQueryFilterData(filter);
+		const uint32_t maxHits = Math::Max(filter.MaxHits, 1u);
+
+		JobSystem::ParallelFor(count, [&](uint32_t index)
+		{
+			const SweepQuery& query = queries[index];
+			RaycastHit* hits = outHits + (size_t)index * maxHits;
+
+			const physx::PxGeometryHolder geometry = Utils::ToPhysXGeometry(query.Geometry);
+			const physx::PxTransform pose = PhysicsUtils::ToPhysXTransform(query.Origin, query.Rotation);
+			const physx::PxVec3 direction = PhysicsUtils::ToPhysXVector(Math::Normalize(query.Direction));
+
+			if (maxHits == 1)
+			{
+				physx::PxSweepBuffer buffer;
+				s_Data.Scene->sweep(geometry.any(), pose, direction, query.MaxDistance, buffer, physx::PxHitFlag::eDEFAULT, filterData);
+
+				outHitCounts[index] = buffer.hasBlock ? 1 : 0;
+				if (buffer.hasBlock)
+				{
+					Utils::FromPhysXHit(buffer.block, hits);
+				}
+
+				return;
+			}
+
+			Utils::TouchAllQueryFilter touchAllFilter;
+			physx::PxSweepBuffer buffer(Utils::GetTouchBuffer<physx::PxSweepHit>(maxHits), maxHits);
+			s_Data.Scene->sweep(geometry.any(), pose, direction, query.MaxDistance, buffer, physx::PxHitFlag::eDEFAULT, filterData, &touchAllFilter);
+
+			outHitCounts[index] = Utils::CopyTouches(buffer, hits);
+		}, nullptr, s_QueryBatchSize);
+	}
+
+	void PhysicsScene::OverlapBatch(const OverlapQuery* queries, uint32_t count, const SceneQueryFilter& filter, OverlapHit* outHits, uint32_t* outHitCounts)
+	{
+		VX_PROFILE_FUNCTION();
+
+		physx::PxQueryFilterData filterData = Utils::ToPhysXQueryFilterData(filter);
+		const uint32_t maxHits = Math::Max(filter.MaxHits, 1u);
+
+		// Overlaps have no closest hit, a single slot just takes whichever shape is found first
+		if (maxHits == 1)
+		{
+			filterData.flags |= physx::PxQueryFlag::eANY_HIT;
+		}
+
+		JobSystem::ParallelFor(count, [&](uint32_t index)
+		{
+			const OverlapQuery& query = queries[index];
+			OverlapHit* hits = outHits + (size_t)index * maxHits;
+
+			const physx::PxGeometryHolder geometry = Utils::ToPhysXGeometry(query.Geometry);
+			const physx::PxTransform pose = PhysicsUtils::ToPhysXTransform(query.Origin, query.Rotation);
+
+			if (maxHits == 1)
+			{
+				physx::PxOverlapBuffer buffer;
+				s_Data.Scene->overlap(geometry.any(), pose, buffer, filterData);
+
+				outHitCounts[index] = buffer.hasBlock ? 1 : 0;
+				if (buffer.hasBlock)
+				{
+					hits[0].ActorID = Utils::GetHitActorID(buffer.block.actor);
+				}
+
+				return;
+			}
+
+			Utils::TouchAllQueryFilter touchAllFilter;
+			physx::PxOverlapBuffer buffer(Utils::GetTouchBuffer<physx::PxOverlapHit>(maxHits), maxHits);
+			s_Data.Scene->overlap(geometry.any(), pose, buffer, filterData, &touchAllFilter);
+
+			for (uint32_t i = 0; i < buffer.nbTouches; i++)
+			{
+				hits[i].ActorID = Utils::GetHitActorID(buffer.touches[i].actor);
+			}
+
+			outHitCounts[index] = buffer.nbTouches;
+		}, nullptr, s_QueryBatchSize);
+	}
+
 }
@@ -16,6 +16,14 @@ namespace Vortex {
 
 		static void Simulate(TimeStep delta, bool block = true);
 
+		// Split step, the scene must not be modified between these two calls
+		static void BeginSimulate(TimeStep delta);
+		static bool FetchResults(bool block = true);
+		static bool IsSimulating();
+
+		// Delivers the contact and trigger events buffered during the last fetch to scripts
+		static void DispatchContactEvents();
+
 		static const Math::vec3& GetGravity();
 		static void SetGravity(const Math::vec3& gravity);
 
@@ -25,11 +33,25 @@ namespace Vortex {
 		static uint32_t GetPositionIterations();
 		static void SetPositionIterations(uint32_t iterations);
 
+		// Number of fixed simulation steps per second
+		static uint32_t GetTickRate();
+		static void SetTickRate(uint32_t tickRate);
+
+		// Upper bound on steps taken in a single frame, anything past it is dropped
+		static uint32_t GetMaxSubsteps();
+		static void SetMaxSubsteps(uint32_t maxSubsteps);
+
 		static void WakeUpActors();
 
 		static void* GetScene();
 
 		static uint32_t Raycast(const Math::vec3& origin, const Math::vec3& direction, float maxDistance, RaycastHit* outInfo);
+
+		// Batched queries run in parallel on the job system workers. Hits for query i are written to
+		// outHits[i * filter.MaxHits] onwards, sorted by distance, and outHitCounts[i] holds how many there are
+		static void RaycastBatch(const RaycastQuery* queries, uint32_t count, const SceneQueryFilter& filter, RaycastHit* outHits, uint32_t* outHitCounts);
+		static void SweepBatch(const SweepQuery* queries, uint32_t count, const SceneQueryFilter& filter, RaycastHit* outHits, uint32_t* outHitCounts);
+		static void OverlapBatch(const OverlapQuery* queries, uint32_t count, const SceneQueryFilter& filter, OverlapHit* outHits, uint32_t* outHitCounts);
 	};
 
 }
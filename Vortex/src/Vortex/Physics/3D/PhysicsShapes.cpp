@@ -4,6 +4,7 @@
 #include "Vortex/Physics/3D/Physics.h"
 #include "Vortex/Physics/3D/PhysicsTypes.h"
 #include "Vortex/Physics/3D/PhysicsUtils.h"
+#include "Vortex/Physics/3D/CookingFactory.h"
 
 #include "Vortex/Project/Project.h"
 
@@ -13,6 +14,31 @@
 
 namespace Vortex {
 
+	namespace Utils {
+
+		// Mesh colliders have no offset, the cooked mesh is already in the actor's local space
+		static const Math::vec3 s_MeshColliderOffset = Math::vec3(0.0f);
+
+		static SharedReference<PhysicsMaterial> GetOrCreateMaterial(AssetHandle& materialHandle)
+		{
+			SharedReference<PhysicsMaterial> material = AssetManager::GetAsset<PhysicsMaterial>(materialHandle);
+			if (!material)
+			{
+				materialHandle = AssetManager::CreateMemoryOnlyAsset<PhysicsMaterial>(0.6f, 0.6f, 0.0f);
+				material = AssetManager::GetAsset<PhysicsMaterial>(materialHandle);
+			}
+
+			return material;
+		}
+
+		static void SetMeshShapeFlags(physx::PxShape* shape, bool isTrigger)
+		{
+			shape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, !isTrigger);
+			shape->setFlag(physx::PxShapeFlag::eTRIGGER_SHAPE, isTrigger);
+		}
+
+	}
+
 	ColliderShape::ColliderShape(ColliderType type, Actor actor, bool isShared)
 		: m_Type(type), m_Material(nullptr), m_Actor(actor), m_IsShared(isShared) { }
 
@@ -33,6 +59,13 @@ namespace Vortex {
 		m_Material->release();
 	}
 
+	void ColliderShape::AdoptShape(physx::PxShape& shape)
+	{
+		// The restored material reference becomes ours, Release() drops it like one we created
+		shape.getMaterials(&m_Material, 1);
+		shape.userData = this;
+	}
+
 	void ColliderShape::SetMaterial(SharedReference<PhysicsMaterial>& material)
 	{
 		if (m_Material != nullptr)
@@ -56,7 +89,7 @@ namespace Vortex {
 		SetMaterial(material);
 
 		Scene* scene = Physics::GetContextScene();
-		TransformComponent worldSpaceTransform = scene->GetWorldSpaceTransform(actor);
+		TransformComponent worldSpaceTransform = scene->GetCachedWorldSpaceTransform(actor);
 
 		Math::vec3 colliderSize = Math::Abs(worldSpaceTransform.Scale * component.HalfSize);
 		physx::PxBoxGeometry boxGeometry = physx::PxBoxGeometry(colliderSize.x, colliderSize.y, colliderSize.z);
@@ -67,6 +100,15 @@ namespace Vortex {
 		m_Shape->userData = this;
 	}
 
+	BoxColliderShape::BoxColliderShape(BoxColliderComponent& component, physx::PxShape& shape, Actor actor)
+		: ColliderShape(ColliderType::Box, actor)
+	{
+		Utils::GetOrCreateMaterial(component.Material);
+
+		m_Shape = &shape;
+		AdoptShape(shape);
+	}
+
 	const Math::vec3& BoxColliderShape::GetHalfSize() const
 	{
 		return m_Actor.GetComponent<BoxColliderComponent>().HalfSize;
@@ -136,7 +178,7 @@ namespace Vortex {
 		SetMaterial(material);
 
 		Scene* scene = Physics::GetContextScene();
-		TransformComponent worldSpaceTransform = scene->GetWorldSpaceTransform(actor);
+		TransformComponent worldSpaceTransform = scene->GetCachedWorldSpaceTransform(actor);
 
 		float largestComponent = Math::Max(worldSpaceTransform.Scale.x, Math::Max(worldSpaceTransform.Scale.y, worldSpaceTransform.Scale.z));
 
@@ -148,6 +190,15 @@ namespace Vortex {
 		m_Shape->userData = this;
 	}
 
+	SphereColliderShape::SphereColliderShape(SphereColliderComponent& component, physx::PxShape& shape, Actor actor)
+		: ColliderShape(ColliderType::Sphere, actor)
+	{
+		Utils::GetOrCreateMaterial(component.Material);
+
+		m_Shape = &shape;
+		AdoptShape(shape);
+	}
+
 	float SphereColliderShape::GetRadius() const
 	{
 		return m_Actor.GetComponent<SphereColliderComponent>().Radius;
@@ -217,7 +268,7 @@ namespace Vortex {
 		SetMaterial(material);
 
 		Scene* scene = Physics::GetContextScene();
-		TransformComponent worldSpaceTransform = scene->GetWorldSpaceTransform(actor);
+		TransformComponent worldSpaceTransform = scene->GetCachedWorldSpaceTransform(actor);
 
 		float radiusScale = Math::Max(worldSpaceTransform.Scale.x, worldSpaceTransform.Scale.z);
 
@@ -229,6 +280,15 @@ namespace Vortex {
 		m_Shape->userData = this;
 	}
 
+	CapsuleColliderShape::CapsuleColliderShape(CapsuleColliderComponent& component, physx::PxShape& shape, Actor actor)
+		: ColliderShape(ColliderType::Capsule, actor)
+	{
+		Utils::GetOrCreateMaterial(component.Material);
+
+		m_Shape = &shape;
+		AdoptShape(shape);
+	}
+
 	float CapsuleColliderShape::GetRadius() const
 	{
 		return m_Actor.GetComponent<CapsuleColliderComponent>().Radius;
@@ -311,12 +371,42 @@ namespace Vortex {
 	ConvexMeshShape::ConvexMeshShape(MeshColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor)
 		: ColliderShape(ColliderType::ConvexMesh, actor, component.UseSharedShape)
 	{
+		SharedReference<PhysicsMaterial> material = Utils::GetOrCreateMaterial(component.Material);
+		SetMaterial(material);
+
+		SharedReference<StaticMesh> staticMesh = Physics::GetMeshColliderAsset(actor);
+		physx::PxConvexMesh* convexMesh = CookingFactory::GetConvexMesh(staticMesh, component.SubmeshIndex);
+		if (convexMesh == nullptr)
+		{
+			VX_CORE_WARN_TAG("Physics", "Failed to create convex mesh collider for actor '{}'", actor.Name());
+			return;
+		}
+
+		Scene* scene = Physics::GetContextScene();
+		TransformComponent worldSpaceTransform = scene->GetCachedWorldSpaceTransform(actor);
+
+		physx::PxMeshScale meshScale(PhysicsUtils::ToPhysXVector(worldSpaceTransform.Scale), physx::PxQuat(physx::PxIdentity));
+		physx::PxConvexMeshGeometry convexGeometry = physx::PxConvexMeshGeometry(convexMesh, meshScale);
+
+		physx::PxShape* shape = physx::PxRigidActorExt::createExclusiveShape(pxActor, convexGeometry, *m_Material);
+		Utils::SetMeshShapeFlags(shape, component.IsTrigger);
+		shape->userData = this;
+
+		m_Shapes.push_back(shape);
+	}
+
+	ConvexMeshShape::ConvexMeshShape(MeshColliderComponent& component, physx::PxShape& shape, Actor actor)
+		: ColliderShape(ColliderType::ConvexMesh, actor, component.UseSharedShape)
+	{
+		Utils::GetOrCreateMaterial(component.Material);
 
+		m_Shapes.push_back(&shape);
+		AdoptShape(shape);
 	}
 
 	const Math::vec3& ConvexMeshShape::GetOffset() const
 	{
-		return Math::vec3(); // TODO: insert return statement here
+		return Utils::s_MeshColliderOffset;
 	}
 
 	void ConvexMeshShape::SetOffset(const Math::vec3& offset)
@@ -325,12 +415,18 @@ namespace Vortex {
 
 	bool ConvexMeshShape::IsTrigger() const
 	{
-		return false;
+		return m_Actor.GetComponent<MeshColliderComponent>().IsTrigger;
 	}
 
 	void ConvexMeshShape::SetTrigger(bool isTrigger)
 	{
+		for (auto& shape : m_Shapes)
+		{
+			Utils::SetMeshShapeFlags(shape, isTrigger);
+		}
 
+		MeshColliderComponent& meshCollider = m_Actor.GetComponent<MeshColliderComponent>();
+		meshCollider.IsTrigger = isTrigger;
 	}
 
 	void ConvexMeshShape::SetFilterData(const physx::PxFilterData& filterData)
@@ -355,12 +451,42 @@ namespace Vortex {
 	TriangleMeshShape::TriangleMeshShape(MeshColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor)
 		: ColliderShape(ColliderType::TriangleMesh, actor, component.UseSharedShape)
 	{
+		SharedReference<PhysicsMaterial> material = Utils::GetOrCreateMaterial(component.Material);
+		SetMaterial(material);
 
+		SharedReference<StaticMesh> staticMesh = Physics::GetMeshColliderAsset(actor);
+		physx::PxTriangleMesh* triangleMesh = CookingFactory::GetTriangleMesh(staticMesh, component.SubmeshIndex);
+		if (triangleMesh == nullptr)
+		{
+			VX_CORE_WARN_TAG("Physics", "Failed to create triangle mesh collider for actor '{}'", actor.Name());
+			return;
+		}
+
+		Scene* scene = Physics::GetContextScene();
+		TransformComponent worldSpaceTransform = scene->GetCachedWorldSpaceTransform(actor);
+
+		physx::PxMeshScale meshScale(PhysicsUtils::ToPhysXVector(worldSpaceTransform.Scale), physx::PxQuat(physx::PxIdentity));
+		physx::PxTriangleMeshGeometry triangleGeometry = physx::PxTriangleMeshGeometry(triangleMesh, meshScale);
+
+		physx::PxShape* shape = physx::PxRigidActorExt::createExclusiveShape(pxActor, triangleGeometry, *m_Material);
+		Utils::SetMeshShapeFlags(shape, component.IsTrigger);
+		shape->userData = this;
+
+		m_Shapes.push_back(shape);
+	}
+
+	TriangleMeshShape::TriangleMeshShape(MeshColliderComponent& component, physx::PxShape& shape, Actor actor)
+		: ColliderShape(ColliderType::TriangleMesh, actor, component.UseSharedShape)
+	{
+		Utils::GetOrCreateMaterial(component.Material);
+
+		m_Shapes.push_back(&shape);
+		AdoptShape(shape);
 	}
 
 	const Math::vec3& TriangleMeshShape::GetOffset() const
 	{
-		return Math::vec3(); // TODO: insert return statement here
+		return Utils::s_MeshColliderOffset;
 	}
 
 	void TriangleMeshShape::SetOffset(const Math::vec3& offset)
@@ -369,12 +495,18 @@ namespace Vortex {
 
 	bool TriangleMeshShape::IsTrigger() const
 	{
-		return false;
+		return m_Actor.GetComponent<MeshColliderComponent>().IsTrigger;
 	}
 
 	void TriangleMeshShape::SetTrigger(bool isTrigger)
 	{
+		for (auto& shape : m_Shapes)
+		{
+			Utils::SetMeshShapeFlags(shape, isTrigger);
+		}
 
+		MeshColliderComponent& meshCollider = m_Actor.GetComponent<MeshColliderComponent>();
+		meshCollider.IsTrigger = isTrigger;
 	}
 
 	void TriangleMeshShape::SetFilterData(const physx::PxFilterData& filterData)
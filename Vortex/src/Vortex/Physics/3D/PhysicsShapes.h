@@ -52,6 +52,10 @@ namespace Vortex {
 		inline virtual bool IsShared() const { return m_IsShared; }
 		inline virtual bool IsValid() const { return m_Material != nullptr; }
 
+	protected:
+		// Takes over a shape restored from a serialized scene along with its material
+		void AdoptShape(physx::PxShape& shape);
+
 	protected:
 		ColliderType m_Type;
 		Actor m_Actor;
@@ -63,6 +67,7 @@ namespace Vortex {
 	{
 	public:
 		BoxColliderShape(BoxColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor);
+		BoxColliderShape(BoxColliderComponent& component, physx::PxShape& shape, Actor actor);
 		~BoxColliderShape() override = default;
 
 		const Math::vec3& GetHalfSize() const;
@@ -91,6 +96,7 @@ namespace Vortex {
 	{
 	public:
 		SphereColliderShape(SphereColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor);
+		SphereColliderShape(SphereColliderComponent& component, physx::PxShape& shape, Actor actor);
 		~SphereColliderShape() override = default;
 
 		float GetRadius() const;
@@ -119,6 +125,7 @@ namespace Vortex {
 	{
 	public:
 		CapsuleColliderShape(CapsuleColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor);
+		CapsuleColliderShape(CapsuleColliderComponent& component, physx::PxShape& shape, Actor actor);
 		~CapsuleColliderShape() override = default;
 
 		float GetRadius() const;
@@ -150,6 +157,7 @@ namespace Vortex {
 	{
 	public:
 		ConvexMeshShape(MeshColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor);
+		ConvexMeshShape(MeshColliderComponent& component, physx::PxShape& shape, Actor actor);
 		~ConvexMeshShape() override = default;
 
 		virtual const Math::vec3& GetOffset() const override;
@@ -175,6 +183,7 @@ namespace Vortex {
 	{
 	public:
 		TriangleMeshShape(MeshColliderComponent& component, physx::PxRigidActor& pxActor, Actor actor);
+		TriangleMeshShape(MeshColliderComponent& component, physx::PxShape& shape, Actor actor);
 		~TriangleMeshShape() override = default;
 
 		const Math::vec3& GetOffset() const override;
@@ -6,7 +6,10 @@
 
 #include "Vortex/Math/Math.h"
 
+#include <entt/entt.hpp>
+
 #include <cstdint>
+#include <vector>
 
 namespace Vortex {
 
@@ -15,7 +18,15 @@ namespace Vortex {
 	struct VORTEX_API PhysicsBodyData
 	{
 		UUID ActorUUID = 0;
+		entt::entity ActorHandle = entt::null;
 		Scene* ContextScene = nullptr;
+
+		// Poses around the last step the body moved in, rendering blends between them
+		Math::vec3 PreviousTranslation = Math::vec3(0.0f);
+		Math::quaternion PreviousRotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+		Math::vec3 CurrentTranslation = Math::vec3(0.0f);
+		Math::quaternion CurrentRotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+		uint64_t LastActiveStep = 0;
 	};
 
 	struct VORTEX_API ConstrainedJointData
@@ -23,6 +34,42 @@ namespace Vortex {
 		UUID ActorUUID = 0;
 	};
 
+	struct VORTEX_API PhysicsActorSnapshot
+	{
+		UUID ActorUUID = 0;
+		Math::vec3 Translation = Math::vec3(0.0f);
+		Math::quaternion Rotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+		Math::vec3 LinearVelocity = Math::vec3(0.0f);
+		Math::vec3 AngularVelocity = Math::vec3(0.0f);
+		bool IsSleeping = false;
+	};
+
+	struct VORTEX_API PhysicsControllerSnapshot
+	{
+		UUID ActorUUID = 0;
+		Math::vec3 Position = Math::vec3(0.0f);
+	};
+
+	// Simulation state of a running scene, restoring it rewinds the world without rebuilding any actors
+	struct VORTEX_API PhysicsSnapshot
+	{
+		std::vector<PhysicsActorSnapshot> Actors;
+		std::vector<PhysicsControllerSnapshot> Controllers;
+		float Accumulator = 0.0f;
+	};
+
+	// Wall time spent in each phase of the last simulation update, in milliseconds
+	struct VORTEX_API PhysicsStepTimings
+	{
+		float Push = 0.0f;
+		float Simulate = 0.0f;
+		float Fetch = 0.0f;
+		// Buffering inside fetchResults (part of Fetch) plus delivering the events to scripts after Writeback
+		float ContactCallbacks = 0.0f;
+		float Writeback = 0.0f;
+		uint32_t Substeps = 0;
+	};
+
 	struct VORTEX_API RaycastHit
 	{
 		uint64_t ActorID;
@@ -41,6 +88,52 @@ namespace Vortex {
 		uint64_t ActorID;
 	};
 
+	// Batched scene queries, these structs are shared with the script core so keep the layouts in sync
+
+	enum class VORTEX_API QueryGeometryType : uint32_t
+	{
+		Sphere, Box, Capsule,
+	};
+
+	struct VORTEX_API QueryGeometry
+	{
+		QueryGeometryType Type = QueryGeometryType::Sphere;
+		Math::vec3 HalfSize = Math::vec3(0.5f); // Box
+		float Radius = 0.5f; // Sphere, Capsule
+		float HalfHeight = 0.5f; // Capsule
+	};
+
+	struct VORTEX_API RaycastQuery
+	{
+		Math::vec3 Origin = Math::vec3(0.0f);
+		Math::vec3 Direction = Math::vec3(0.0f, 0.0f, -1.0f);
+		float MaxDistance = 0.0f;
+	};
+
+	struct VORTEX_API SweepQuery
+	{
+		QueryGeometry Geometry;
+		Math::vec3 Origin = Math::vec3(0.0f);
+		Math::quaternion Rotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+		Math::vec3 Direction = Math::vec3(0.0f, 0.0f, -1.0f);
+		float MaxDistance = 0.0f;
+	};
+
+	struct VORTEX_API OverlapQuery
+	{
+		QueryGeometry Geometry;
+		Math::vec3 Origin = Math::vec3(0.0f);
+		Math::quaternion Rotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+	};
+
+	struct VORTEX_API SceneQueryFilter
+	{
+		// Bit N matches actors with RigidBodyComponent::LayerID N
+		uint32_t LayerMask = 0xFFFFFFFF;
+		// Hit slots reserved per query, more than one returns every hit instead of just the closest
+		uint32_t MaxHits = 1;
+	};
+
 	enum class VORTEX_API BroadphaseType
 	{
 		SweepAndPrune,
@@ -106,4 +106,31 @@ namespace Vortex {
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, NULL);
 	}
 
+	/// Storage Buffer //////////////////////////////////////////////////////////
+
+	OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size, uint32_t binding)
+		: m_Size(size), m_Binding(binding)
+	{
+		VX_PROFILE_FUNCTION();
+
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+	}
+
+	OpenGLStorageBuffer::~OpenGLStorageBuffer()
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (m_RendererID)
+			glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset) const
+	{
+		VX_CORE_ASSERT(offset + size <= m_Size, "Storage Buffer write out of bounds!");
+
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
+
 }
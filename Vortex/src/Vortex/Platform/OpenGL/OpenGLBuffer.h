@@ -44,4 +44,21 @@ namespace Vortex {
 		uint32_t m_Count;
 	};
 
+	class OpenGLStorageBuffer : public StorageBuffer
+	{
+	public:
+		OpenGLStorageBuffer(uint32_t size, uint32_t binding);
+		~OpenGLStorageBuffer() override;
+
+		void SetData(const void* data, uint32_t size, uint32_t offset = 0) const override;
+
+		inline uint32_t GetSize() const override { return m_Size; }
+		inline uint32_t GetBinding() const override { return m_Binding; }
+
+	private:
+		uint32_t m_RendererID = 0;
+		uint32_t m_Size;
+		uint32_t m_Binding;
+	};
+
 }
@@ -95,6 +95,13 @@ namespace Vortex {
 		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
 		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
 	}
+
+	void OpenGLRendererAPI::DrawIndexedInstanced(const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance) const
+	{
+		vertexArray->Bind();
+		uint32_t count = vertexArray->GetIndexBuffer()->GetCount();
+		glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount, baseInstance);
+	}
 	
 	void OpenGLRendererAPI::DrawLines(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount) const
 	{
@@ -19,6 +19,7 @@ namespace Vortex {
 
 		void DrawTriangles(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount) const override;
 		void DrawIndexed(const SharedReference<VertexArray>& vertexArray, uint32_t indexCount = 0) const override;
+		void DrawIndexedInstanced(const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance = 0) const override;
 		void DrawLines(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount) const override;
 		void DrawTriangleStrip(const SharedReference<VertexArray>& vertexArray, uint32_t indexCount) const override;
 
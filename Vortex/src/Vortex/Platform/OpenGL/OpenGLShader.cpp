@@ -224,6 +224,9 @@ namespace Vortex {
 		if (m_RendererID)
 			glDeleteProgram(m_RendererID);
 
+		// Locations can move when the program is relinked
+		m_UniformLocationCache.clear();
+
 		CreateShader(m_Filepath);
 	}
 
@@ -379,6 +382,38 @@ namespace Vortex {
 		glProgramUniformMatrix4fv(m_RendererID, GetUniformLocation(uniformName), 1, false, Math::ValuePtr(matrix));
 	}
 
+	ShaderUniformHandle OpenGLShader::GetUniformHandle(const std::string& name) const
+	{
+		ShaderUniformHandle handle;
+		handle.Location = GetUniformLocation(name);
+		return handle;
+	}
+
+	void OpenGLShader::SetBool(ShaderUniformHandle handle, bool value) const
+	{
+		glProgramUniform1i(m_RendererID, handle.Location, (int)value);
+	}
+
+	void OpenGLShader::SetInt(ShaderUniformHandle handle, int value) const
+	{
+		glProgramUniform1i(m_RendererID, handle.Location, value);
+	}
+
+	void OpenGLShader::SetFloat(ShaderUniformHandle handle, float value) const
+	{
+		glProgramUniform1f(m_RendererID, handle.Location, value);
+	}
+
+	void OpenGLShader::SetFloat3(ShaderUniformHandle handle, const Math::vec3& vector) const
+	{
+		glProgramUniform3f(m_RendererID, handle.Location, vector.x, vector.y, vector.z);
+	}
+
+	void OpenGLShader::SetMat4(ShaderUniformHandle handle, const Math::mat4& matrix) const
+	{
+		glProgramUniformMatrix4fv(m_RendererID, handle.Location, 1, false, Math::ValuePtr(matrix));
+	}
+
 	int OpenGLShader::GetUniformLocation(const std::string& uniformName) const
 	{
 		auto it = m_UniformLocationCache.find(uniformName);
@@ -35,6 +35,14 @@ namespace Vortex {
 		void SetFloat3(const std::string & name, const Math::vec3 & vector) const override;
 		void SetFloat4(const std::string & name, const Math::vec4 & vector) const override;
 
+		ShaderUniformHandle GetUniformHandle(const std::string& name) const override;
+
+		void SetBool(ShaderUniformHandle handle, bool value) const override;
+		void SetInt(ShaderUniformHandle handle, int value) const override;
+		void SetFloat(ShaderUniformHandle handle, float value) const override;
+		void SetFloat3(ShaderUniformHandle handle, const Math::vec3& vector) const override;
+		void SetMat4(ShaderUniformHandle handle, const Math::mat4& matrix) const override;
+
 		inline const std::string& GetName() const override { return m_Name; };
 
 		void Reload() override;
@@ -2,13 +2,34 @@
 #include "OpenGLTexture.h"
 
 #include <Glad/glad.h>
-#include <stb_image.h>
 #include <stb_image_write.h>
 
+// From EXT_texture_compression_s3tc, which the generated loader doesn't include
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+	#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+	#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace Vortex {
 	
 	namespace Utils {
 
+		static GLenum VortexTextureCompressionToGL(TextureCompression compression)
+		{
+			switch (compression)
+			{
+				case TextureCompression::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+				case TextureCompression::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+				case TextureCompression::BC5: return GL_COMPRESSED_RG_RGTC2;
+			}
+
+			VX_CORE_ASSERT(false, "Unknown Texture Compression!");
+			return 0;
+		}
+
 		static int VortexImageWrapModeToGL(ImageWrap wrapMode)
 		{
 			switch (wrapMode)
@@ -54,23 +75,21 @@ namespace Vortex {
 		}
 
 		// Create Texture from file
-		stbi_set_flip_vertically_on_load(m_Properties.FlipVertical);
-
-		const bool isHdrFile = m_Properties.TextureFormat == ImageFormat::RGBA16F || stbi_is_hdr(m_Properties.Filepath.c_str());
-		
-		if (isHdrFile)
+		TextureData data;
+		if (Texture2D::Decode(m_Properties, data))
 		{
-			CreateImageFromHDRFile();
-		}
-		else
-		{
-			CreateImageFromFile();
+			CreateImageFromData(data);
 		}
 
-		if (m_Properties.GenerateMipmaps)
-		{
-			glGenerateTextureMipmap(m_RendererID);
-		}
+		data.Release();
+	}
+
+	OpenGLTexture2D::OpenGLTexture2D(const TextureProperties& imageProps, const TextureData& data)
+		: m_Properties(imageProps)
+	{
+		VX_PROFILE_FUNCTION();
+
+		CreateImageFromData(data);
 	}
 
     OpenGLTexture2D::~OpenGLTexture2D()
@@ -164,24 +183,23 @@ namespace Vortex {
 		m_Properties.IsLoaded = true;
 	}
 
-	void OpenGLTexture2D::CreateImageFromHDRFile()
+	void OpenGLTexture2D::CreateImageFromHDRData(const TextureData& data)
 	{
-		int width, height, channels;
+		m_Properties.Width = data.Width;
+		m_Properties.Height = data.Height;
 
-		float* dataF32 = nullptr;
+		glGenTextures(1, &m_RendererID);
+		glBindTexture(GL_TEXTURE_2D, m_RendererID);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, m_Properties.Width, m_Properties.Height, 0, GL_RGB, GL_FLOAT, data.Pixels);
 
+		if (m_Properties.GenerateMipmaps)
 		{
-			VX_PROFILE_SCOPE("stbi_loadf - OpenGLTexture2D::OpenGLTexture2D(const std::string&, bool)");
-			dataF32 = stbi_loadf(m_Properties.Filepath.c_str(), &width, &height, &channels, 0);
+			for (uint32_t i = 0; i < (uint32_t)data.Mips.size(); i++)
+			{
+				const TextureMip& mip = data.Mips[i];
+				glTexImage2D(GL_TEXTURE_2D, i + 1, GL_RGB16F, mip.Width, mip.Height, 0, GL_RGB, GL_FLOAT, mip.Pixels);
+			}
 		}
-		VX_CORE_ASSERT(dataF32, "Failed to load HDR Image!");
-
-		m_Properties.Width = width;
-		m_Properties.Height = height;
-
-		glGenTextures(1, &m_RendererID);
-		glBindTexture(GL_TEXTURE_2D, m_RendererID);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, m_Properties.Width, m_Properties.Height, 0, GL_RGB, GL_FLOAT, dataF32);
 
 		int wrap = Utils::VortexImageWrapModeToGL(m_Properties.WrapMode);
 
@@ -193,40 +211,87 @@ namespace Vortex {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_Properties.GenerateMipmaps ? GL_LINEAR_MIPMAP_LINEAR : filter);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
 
-		stbi_image_free(dataF32);
+		m_Properties.IsLoaded = true;
+	}
+
+	void OpenGLTexture2D::CreateImageFromCompressedData(const TextureData& data)
+	{
+		m_Properties.Width = data.Width;
+		m_Properties.Height = data.Height;
+
+		m_InternalFormat = Utils::VortexTextureCompressionToGL(data.Compression);
+		m_DataFormat = data.Channels == 4 ? GL_RGBA : GL_RGB;
+
+		const uint32_t levels = m_Properties.GenerateMipmaps ? 1 + (uint32_t)data.Mips.size() : 1;
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+		glTextureStorage2D(m_RendererID, levels, m_InternalFormat, m_Properties.Width, m_Properties.Height);
+
+		int wrap = Utils::VortexImageWrapModeToGL(m_Properties.WrapMode);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, wrap);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, wrap);
+
+		int filter = Utils::VortexImageFilterModeToGL(m_Properties.TextureFilter);
+
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, m_Properties.GenerateMipmaps ? GL_LINEAR_MIPMAP_LINEAR : filter);
+		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, filter);
+
+		// Two channel images are grey and alpha, they're sampled the same way an uncompressed one would be
+		if (data.Compression == TextureCompression::BC5 && data.Channels == 2)
+		{
+			const GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+			glTextureParameteriv(m_RendererID, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+		}
+
+		// Compressed textures can't generate their own mips, every level comes from the data
+		glCompressedTextureSubImage2D(m_RendererID, 0, 0, 0, data.Width, data.Height, m_InternalFormat, (GLsizei)data.GetLevelSize(data.Width, data.Height), data.Pixels);
+
+		for (uint32_t i = 1; i < levels; i++)
+		{
+			const TextureMip& mip = data.Mips[i - 1];
+			glCompressedTextureSubImage2D(m_RendererID, i, 0, 0, mip.Width, mip.Height, m_InternalFormat, (GLsizei)data.GetLevelSize(mip.Width, mip.Height), mip.Pixels);
+		}
 
 		m_Properties.IsLoaded = true;
 	}
 
-	void OpenGLTexture2D::CreateImageFromFile()
+	void OpenGLTexture2D::CreateImageFromData(const TextureData& data)
 	{
-		int width, height, channels;
+		VX_PROFILE_FUNCTION();
 
-		stbi_uc* data = nullptr;
+		if (!data)
+		{
+			return;
+		}
 
+		if (data.Compression != TextureCompression::None)
 		{
-			VX_PROFILE_SCOPE("stbi_load - OpenGLTexture2D::OpenGLTexture2D(const std::string&, bool)");
-			data = stbi_load(m_Properties.Filepath.c_str(), &width, &height, &channels, 0);
+			CreateImageFromCompressedData(data);
+			return;
 		}
-		VX_CORE_ASSERT(data, "Failed to load Image!");
 
-		if (data)
+		if (data.IsHDR)
+		{
+			CreateImageFromHDRData(data);
+		}
+		else
 		{
-			m_Properties.Width = width;
-			m_Properties.Height = height;
+			m_Properties.Width = data.Width;
+			m_Properties.Height = data.Height;
 
 			GLenum internalFormat = 0, dataFormat = 0;
-			if (channels == 4)
+			if (data.Channels == 4)
 			{
 				internalFormat = GL_RGBA8;
 				dataFormat = GL_RGBA;
 			}
-			else if (channels == 3)
+			else if (data.Channels == 3)
 			{
 				internalFormat = GL_RGB8;
 				dataFormat = GL_RGB;
 			}
-			else if (channels == 1)
+			else if (data.Channels == 1)
 			{
 				internalFormat = GL_R8;
 				dataFormat = GL_RED;
@@ -237,8 +302,11 @@ namespace Vortex {
 
 			VX_CORE_ASSERT(internalFormat & dataFormat, "Format not supported!");
 
+			// Pre-baked mips are uploaded as they are, otherwise only the base level exists
+			const uint32_t levels = m_Properties.GenerateMipmaps ? 1 + (uint32_t)data.Mips.size() : 1;
+
 			glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-			glTextureStorage2D(m_RendererID, 1, internalFormat, m_Properties.Width, m_Properties.Height);
+			glTextureStorage2D(m_RendererID, levels, internalFormat, m_Properties.Width, m_Properties.Height);
 
 			int wrap = Utils::VortexImageWrapModeToGL(m_Properties.WrapMode);
 
@@ -250,12 +318,26 @@ namespace Vortex {
 			glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, m_Properties.GenerateMipmaps ? GL_LINEAR_MIPMAP_LINEAR : filter);
 			glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, filter);
 
-			glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Properties.Width, m_Properties.Height, dataFormat, GL_UNSIGNED_BYTE, data);
+			// Rows of RGB and single channel levels aren't four byte aligned
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Properties.Width, m_Properties.Height, dataFormat, GL_UNSIGNED_BYTE, data.Pixels);
+
+			for (uint32_t i = 1; i < levels; i++)
+			{
+				const TextureMip& mip = data.Mips[i - 1];
+				glTextureSubImage2D(m_RendererID, i, 0, 0, mip.Width, mip.Height, dataFormat, GL_UNSIGNED_BYTE, mip.Pixels);
+			}
 
-			stbi_image_free(data);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
 			m_Properties.IsLoaded = true;
 		}
+
+		if (m_Properties.GenerateMipmaps && data.Mips.empty())
+		{
+			glGenerateTextureMipmap(m_RendererID);
+		}
 	}
 
 }
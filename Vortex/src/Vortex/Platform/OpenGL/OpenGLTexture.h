@@ -10,6 +10,7 @@ namespace Vortex {
 	{
 	public:
 		OpenGLTexture2D(const TextureProperties& imageProps);
+		OpenGLTexture2D(const TextureProperties& imageProps, const TextureData& data);
 		~OpenGLTexture2D() override;
 
 		const TextureProperties& GetProperties() const override { return m_Properties; }
@@ -40,8 +41,9 @@ namespace Vortex {
 
 	private:
 		void CreateImageFromWidthAndHeight();
-		void CreateImageFromHDRFile();
-		void CreateImageFromFile();
+		void CreateImageFromHDRData(const TextureData& data);
+		void CreateImageFromCompressedData(const TextureData& data);
+		void CreateImageFromData(const TextureData& data);
 
 	private:
 		TextureProperties m_Properties;
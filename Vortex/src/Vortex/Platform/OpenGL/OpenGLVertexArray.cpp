@@ -60,13 +60,46 @@ namespace Vortex {
 		VX_PROFILE_FUNCTION();
 
 		VX_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+		VX_CORE_ASSERT(!m_InstanceBuffer, "Vertex Buffers must be added before the Instance Buffer!");
 
 		glBindVertexArray(m_RendererID);
 		vertexBuffer->Bind();
 
-		uint32_t index = 0;
-		const auto& layout = vertexBuffer->GetLayout();
+		m_VertexBufferIndex = SetVertexAttributes(vertexBuffer->GetLayout(), m_VertexBufferIndex);
 
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+
+	void OpenGLVertexArray::SetIndexBuffer(SharedReference<IndexBuffer>& indexBuffer)
+	{
+		VX_PROFILE_FUNCTION();
+
+		glBindVertexArray(m_RendererID);
+		indexBuffer->Bind();
+
+		m_IndexBuffer = indexBuffer;
+	}
+
+	void OpenGLVertexArray::SetInstanceBuffer(const SharedReference<VertexBuffer>& instanceBuffer)
+	{
+		VX_PROFILE_FUNCTION();
+
+		// The attribute pointers capture the buffer, only re-point them when it changes
+		if (m_InstanceBuffer.Raw() == instanceBuffer.Raw())
+			return;
+
+		VX_CORE_ASSERT(instanceBuffer->GetLayout().GetElements().size(), "Instance Buffer has no layout!");
+
+		glBindVertexArray(m_RendererID);
+		instanceBuffer->Bind();
+
+		SetVertexAttributes(instanceBuffer->GetLayout(), m_VertexBufferIndex);
+
+		m_InstanceBuffer = instanceBuffer;
+	}
+
+	uint32_t OpenGLVertexArray::SetVertexAttributes(const BufferLayout& layout, uint32_t attributeIndex)
+	{
 		for (auto& element : layout)
 		{
 			switch (element.Type)
@@ -76,14 +109,15 @@ namespace Vortex {
 				case ShaderDataType::Float3:
 				case ShaderDataType::Float4:
 				{
-					glEnableVertexAttribArray(m_VertexBufferIndex);
-					glVertexAttribPointer(m_VertexBufferIndex,
+					glEnableVertexAttribArray(attributeIndex);
+					glVertexAttribPointer(attributeIndex,
 						element.GetComponentCount(),
 						ShaderDataTypeToOpenGLDataType(element.Type),
 						element.Normalized ? GL_TRUE : GL_FALSE,
 						layout.GetStride(),
-						(const void*)element.Offset);
-					m_VertexBufferIndex++;
+						(const void*)(uintptr_t)element.Offset);
+					glVertexAttribDivisor(attributeIndex, element.Instanced ? 1 : 0);
+					attributeIndex++;
 					break;
 				}
 
@@ -93,31 +127,33 @@ namespace Vortex {
 				case ShaderDataType::Int4:
 				case ShaderDataType::Boolean:
 				{
-					glEnableVertexAttribArray(m_VertexBufferIndex);
-					glVertexAttribIPointer(m_VertexBufferIndex,
+					glEnableVertexAttribArray(attributeIndex);
+					glVertexAttribIPointer(attributeIndex,
 						element.GetComponentCount(),
 						ShaderDataTypeToOpenGLDataType(element.Type),
 						layout.GetStride(),
-						(const void*)element.Offset);
-					m_VertexBufferIndex++;
+						(const void*)(uintptr_t)element.Offset);
+					glVertexAttribDivisor(attributeIndex, element.Instanced ? 1 : 0);
+					attributeIndex++;
 					break;
 				}
 
 				case ShaderDataType::Mat3:
 				case ShaderDataType::Mat4:
 				{
-					uint8_t count = element.GetComponentCount();
-					for (uint8_t i = 0; i < count; i++)
+					// Matrices take one attribute slot per column
+					const uint8_t columns = element.Type == ShaderDataType::Mat3 ? 3 : 4;
+					for (uint8_t i = 0; i < columns; i++)
 					{
-						glEnableVertexAttribArray(m_VertexBufferIndex);
-						glVertexAttribPointer(m_VertexBufferIndex,
-							count,
+						glEnableVertexAttribArray(attributeIndex);
+						glVertexAttribPointer(attributeIndex,
+							columns,
 							ShaderDataTypeToOpenGLDataType(element.Type),
 							element.Normalized ? GL_TRUE : GL_FALSE,
 							layout.GetStride(),
-							(const void*)(sizeof(float) * count * i));
-						glVertexAttribDivisor(m_VertexBufferIndex, 1);
-						m_VertexBufferIndex++;
+							(const void*)(uintptr_t)(element.Offset + sizeof(float) * columns * i));
+						glVertexAttribDivisor(attributeIndex, element.Instanced ? 1 : 0);
+						attributeIndex++;
 					}
 					break;
 				}
@@ -126,17 +162,7 @@ namespace Vortex {
 			}
 		}
 
-		m_VertexBuffers.push_back(vertexBuffer);
-	}
-
-	void OpenGLVertexArray::SetIndexBuffer(SharedReference<IndexBuffer>& indexBuffer)
-	{
-		VX_PROFILE_FUNCTION();
-
-		glBindVertexArray(m_RendererID);
-		indexBuffer->Bind();
-
-		m_IndexBuffer = indexBuffer;
+		return attributeIndex;
 	}
 
 }
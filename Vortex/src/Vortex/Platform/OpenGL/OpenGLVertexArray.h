@@ -15,15 +15,20 @@ namespace Vortex {
 
 		void AddVertexBuffer(SharedReference<VertexBuffer>& vertexBuffer) override;
 		void SetIndexBuffer(SharedReference<IndexBuffer>& indexBuffer) override;
+		void SetInstanceBuffer(const SharedReference<VertexBuffer>& instanceBuffer) override;
 
 		inline const std::vector<SharedReference<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
 		inline const SharedReference<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
 
+	private:
+		uint32_t SetVertexAttributes(const BufferLayout& layout, uint32_t attributeIndex);
+
 	private:
 		uint32_t m_RendererID = 0;
 		uint32_t m_VertexBufferIndex = 0;
 		std::vector<SharedReference<VertexBuffer>> m_VertexBuffers;
 		SharedReference<IndexBuffer> m_IndexBuffer;
+		SharedReference<VertexBuffer> m_InstanceBuffer;
 	};
 
 }
@@ -1,6 +1,8 @@
 #include "vxpch.h"
 #include "Vortex/Utils/FileSystem.h"
 
+#include <Windows.h>
+
 #include <fstream>
 
 namespace Vortex {
@@ -61,6 +63,66 @@ namespace Vortex {
 		return result;
 	}
 
+	MappedFile FileSystem::MapFile(const Fs::Path& filepath)
+	{
+		MappedFile result;
+
+		HANDLE file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return result;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return result;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			return result;
+		}
+
+		const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!view)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return result;
+		}
+
+		result.Data = (const uint8_t*)view;
+		result.Size = (uint64_t)size.QuadPart;
+		result.FileHandle = file;
+		result.MappingHandle = mapping;
+
+		return result;
+	}
+
+	void FileSystem::UnmapFile(MappedFile& file)
+	{
+		if (file.Data)
+		{
+			UnmapViewOfFile(file.Data);
+		}
+
+		if (file.MappingHandle)
+		{
+			CloseHandle((HANDLE)file.MappingHandle);
+		}
+
+		if (file.FileHandle)
+		{
+			CloseHandle((HANDLE)file.FileHandle);
+		}
+
+		file = MappedFile();
+	}
+
 	bool FileSystem::Exists(const Fs::Path& filepath)
 	{
 		return std::filesystem::exists(filepath);
@@ -76,6 +138,22 @@ namespace Vortex {
         return std::filesystem::is_directory(filepath);
     }
 
+	uint64_t FileSystem::GetFileSize(const Fs::Path& filepath)
+	{
+		std::error_code error;
+		const uintmax_t size = std::filesystem::file_size(filepath, error);
+
+		return error ? 0 : (uint64_t)size;
+	}
+
+	uint64_t FileSystem::GetLastWriteTime(const Fs::Path& filepath)
+	{
+		std::error_code error;
+		const std::filesystem::file_time_type time = std::filesystem::last_write_time(filepath, error);
+
+		return error ? 0 : (uint64_t)time.time_since_epoch().count();
+	}
+
 	bool FileSystem::CreateDirectoryV(const Fs::Path& directory)
 	{
 		return std::filesystem::create_directory(directory);
@@ -55,6 +55,14 @@ namespace Vortex {
 		return GetAssetDirectory() / "Cache";
 	}
 
+	Fs::Path Project::GetAssetPackPath()
+	{
+		VX_CORE_ASSERT(s_ActiveProject, "No active project!");
+		Fs::Path assetPackPath = GetProjectFilepath();
+		FileSystem::ReplaceExtension(assetPackPath, ".vxpak");
+		return assetPackPath;
+	}
+
 	SharedReference<IAssetManager> Project::GetAssetManager()
     {
         return s_AssetManager;
@@ -115,15 +123,29 @@ namespace Vortex {
 	{
 		VX_PROFILE_FUNCTION();
 
-		Project::New();
+		SharedReference<Project> project = Project::New();
 
-		//ProjectSerializer serializer(s_ActiveProject);
-		//if (serializer.DeserializeRuntime())
+		ProjectSerializer serializer(project);
+		bool success = serializer.Deserialize(filepath);
+		if (!success)
 		{
-			//s_AssetManager = SharedReference<RuntimeAssetManager>::Create();
+			return nullptr;
 		}
 
-		return s_ActiveProject;
+		const Fs::Path directory = FileSystem::GetParentDirectory(filepath);
+
+		project->m_ProjectDirectory = directory;
+		project->m_ProjectFilepath = filepath;
+		project->s_AssetManager = SharedReference<RuntimeAssetManager>::Create();
+
+		success = GetRuntimeAssetManager()->OnProjectDeserialized();
+
+		if (!success)
+		{
+			return nullptr;
+		}
+
+		return project;
 	}
 
 	bool Project::SaveToDisk()
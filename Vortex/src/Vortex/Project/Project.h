@@ -29,6 +29,7 @@ namespace Vortex {
 		static Fs::Path GetAssetDirectory();
 		static Fs::Path GetAssetRegistryPath();
 		static Fs::Path GetCacheDirectory();
+		static Fs::Path GetAssetPackPath();
 
 		static SharedReference<IAssetManager> GetAssetManager();
 		static SharedReference<EditorAssetManager> GetEditorAssetManager();
@@ -48,10 +48,37 @@ namespace Vortex {
 		return true;
 	}
 
-	bool ProjectLoader::LoadRuntimeProject()
+	bool ProjectLoader::LoadRuntimeProject(const Fs::Path& filepath)
 	{
-		VX_CORE_ASSERT(false, "Not Implemented Yet!");
-		return false;
+		const std::string filename = filepath.filename().string();
+		if (filepath.extension() != ".vxproject")
+		{
+			VX_CONSOLE_LOG_ERROR("[Runtime] Failed to load project '{}' - not a vortex project file!", filename);
+			return false;
+		}
+
+		Fs::Path assetPackPath = filepath;
+		FileSystem::ReplaceExtension(assetPackPath, ".vxpak");
+
+		if (!FileSystem::Exists(assetPackPath))
+		{
+			VX_CONSOLE_LOG_INFO("[Runtime] No asset pack found for project '{}'", filename);
+			return false;
+		}
+
+		const std::string timerName = fmt::format("{} Project Load Time", filename);
+		InstrumentationTimer timer(timerName.c_str());
+
+		if (!Project::LoadRuntime(filepath))
+		{
+			VX_CONSOLE_LOG_ERROR("[Runtime] Failed to load project: '{}'", filepath.string());
+			return false;
+		}
+
+		ScriptEngine::Init();
+		TagComponent::ResetAddedMarkers();
+
+		return true;
 	}
 
 }
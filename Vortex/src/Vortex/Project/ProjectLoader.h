@@ -10,7 +10,8 @@ namespace Vortex {
 		static bool LoadEditorProject(const Fs::Path& filepath);
 		static bool SaveActiveEditorProject();
 
-		static bool LoadRuntimeProject();
+		// Boots from the .vxpak next to the project file, fails if the project was never built
+		static bool LoadRuntimeProject(const Fs::Path& filepath);
 	};
 
 }
@@ -101,10 +101,15 @@ namespace Vortex {
 			Math::vec3 Physics3DGravity = Math::vec3(0.0f, -9.81f, 0.0f);
 			uint32_t Physics3DPositionIterations = 8;
 			uint32_t Physics3DVelocityIterations = 2;
+			uint32_t Physics3DTickRate = 100;
+			uint32_t Physics3DMaxSubsteps = 8;
+			uint32_t Physics3DDispatcherThreads = 0; // zero runs on the job system workers
 			Math::vec4 Physics2DColliderColor = Math::vec4{ (44.0f / 255.0f), (151.0f / 255.0f), (167.0f / 255.0f), 1.0f };
 			Math::vec2 Physics2DGravity = Math::vec2(0.0f, -9.81f);
 			uint32_t Physics2DPositionIterations = 2;
 			uint32_t Physics2DVelocityIterations = 6;
+			uint32_t Physics2DTickRate = 60;
+			uint32_t Physics2DMaxSubsteps = 8;
 			bool ShowColliders = false;
 		} PhysicsProps;
 
@@ -140,6 +140,9 @@ namespace Vortex {
 				out << YAML::Key << "Gravity" << YAML::Value << PhysicsScene::GetGravity();
 				out << YAML::Key << "SolverPositionIterations" << YAML::Value << PhysicsScene::GetPositionIterations();
 				out << YAML::Key << "SolverVelocityIterations" << YAML::Value << PhysicsScene::GetVelocityIterations();
+				out << YAML::Key << "TickRate" << YAML::Value << PhysicsScene::GetTickRate();
+				out << YAML::Key << "MaxSubsteps" << YAML::Value << PhysicsScene::GetMaxSubsteps();
+				out << YAML::Key << "DispatcherThreads" << YAML::Value << props.PhysicsProps.Physics3DDispatcherThreads;
 				out << YAML::Key << YAML::EndMap; // Physics3D
 
 				out << YAML::Key << "Physics2D" << YAML::BeginMap; // Physics2D
@@ -147,6 +150,8 @@ namespace Vortex {
 				out << YAML::Key << "Gravity" << YAML::Value << Physics2D::GetPhysicsWorldGravity();
 				out << YAML::Key << "PositionIterations" << YAML::Value << Physics2D::GetPhysicsWorldPositionIterations();
 				out << YAML::Key << "VelocityIterations" << YAML::Value << Physics2D::GetPhysicsWorldVelocityIterations();
+				out << YAML::Key << "TickRate" << YAML::Value << Physics2D::GetPhysicsWorldTickRate();
+				out << YAML::Key << "MaxSubsteps" << YAML::Value << Physics2D::GetPhysicsWorldMaxSubsteps();
 				out << YAML::Key << YAML::EndMap; // Physics2D
 			}
 			out << YAML::EndMap; // Physics Properties
@@ -308,20 +313,34 @@ namespace Vortex {
 			props.PhysicsProps.Physics3DGravity = physics3DData["Gravity"].as<Math::vec3>();
 			props.PhysicsProps.Physics3DPositionIterations = physics3DData["SolverPositionIterations"].as<uint32_t>();
 			props.PhysicsProps.Physics3DVelocityIterations = physics3DData["SolverVelocityIterations"].as<uint32_t>();
+			if (physics3DData["TickRate"])
+				props.PhysicsProps.Physics3DTickRate = physics3DData["TickRate"].as<uint32_t>();
+			if (physics3DData["MaxSubsteps"])
+				props.PhysicsProps.Physics3DMaxSubsteps = physics3DData["MaxSubsteps"].as<uint32_t>();
+			if (physics3DData["DispatcherThreads"])
+				props.PhysicsProps.Physics3DDispatcherThreads = physics3DData["DispatcherThreads"].as<uint32_t>();
 
 			PhysicsScene::SetGravity(props.PhysicsProps.Physics3DGravity);
 			PhysicsScene::SetPositionIterations(props.PhysicsProps.Physics3DPositionIterations);
 			PhysicsScene::SetVelocityIterations(props.PhysicsProps.Physics3DVelocityIterations);
+			PhysicsScene::SetTickRate(props.PhysicsProps.Physics3DTickRate);
+			PhysicsScene::SetMaxSubsteps(props.PhysicsProps.Physics3DMaxSubsteps);
 
 			auto physics2DData = physicsData["Physics2D"];
 			props.PhysicsProps.Physics2DColliderColor = physics2DData["ColliderColor"].as<Math::vec4>();
 			props.PhysicsProps.Physics2DGravity = physics2DData["Gravity"].as<Math::vec2>();
 			props.PhysicsProps.Physics2DPositionIterations = physics2DData["PositionIterations"].as<uint32_t>();
 			props.PhysicsProps.Physics2DVelocityIterations = physics2DData["VelocityIterations"].as<uint32_t>();
+			if (physics2DData["TickRate"])
+				props.PhysicsProps.Physics2DTickRate = physics2DData["TickRate"].as<uint32_t>();
+			if (physics2DData["MaxSubsteps"])
+				props.PhysicsProps.Physics2DMaxSubsteps = physics2DData["MaxSubsteps"].as<uint32_t>();
 
 			Physics2D::SetPhysicsWorldGravitty(props.PhysicsProps.Physics2DGravity);
 			Physics2D::SetPhysicsWorldPositionIterations(props.PhysicsProps.Physics2DPositionIterations);
 			Physics2D::SetPhysicsWorldVelocityIterations(props.PhysicsProps.Physics2DVelocityIterations);
+			Physics2D::SetPhysicsWorldTickRate(props.PhysicsProps.Physics2DTickRate);
+			Physics2D::SetPhysicsWorldMaxSubsteps(props.PhysicsProps.Physics2DMaxSubsteps);
 		}
 
 		{
@@ -92,4 +92,20 @@ namespace Vortex {
 		return nullptr;
 	}
 
+	SharedReference<StorageBuffer> StorageBuffer::Create(uint32_t size, uint32_t binding)
+	{
+		switch (Renderer::GetGraphicsAPI())
+		{
+			case RendererAPI::API::None:     VX_CORE_ASSERT(false, "Renderer API was set to RendererAPI::None!"); return nullptr;
+			case RendererAPI::API::OpenGL:   return SharedReference<OpenGLStorageBuffer>::Create(size, binding);
+#ifdef VX_PLATFORM_WINDOWS
+			case RendererAPI::API::Direct3D: return nullptr;
+#endif // VX_PLATFORM_WINDOWS
+			case RendererAPI::API::Vulkan:   return nullptr;
+		}
+
+		VX_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
 }
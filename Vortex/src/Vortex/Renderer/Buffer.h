@@ -40,9 +40,10 @@ namespace Vortex {
 		uint32_t Size;
 		uint32_t Offset;
 		bool Normalized;
+		bool Instanced;
 
-		BufferElement(const ShaderDataType& type, const std::string& name, bool normalized = false)
-			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+		BufferElement(const ShaderDataType& type, const std::string& name, bool normalized = false, bool instanced = false)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized), Instanced(instanced)
 		{
 		}
 
@@ -139,4 +140,19 @@ namespace Vortex {
 		static SharedReference<IndexBuffer> Create(uint16_t* indices, uint32_t count);
 	};
 
+	// Shader storage block bound to a fixed binding point, lets arrays
+	// like bone palettes and lights be uploaded with one buffer write
+	class VORTEX_API StorageBuffer : public RefCounted
+	{
+	public:
+		virtual ~StorageBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) const = 0;
+
+		virtual uint32_t GetSize() const = 0;
+		virtual uint32_t GetBinding() const = 0;
+
+		static SharedReference<StorageBuffer> Create(uint32_t size, uint32_t binding);
+	};
+
 }
@@ -1,6 +1,8 @@
 #include "vxpch.h"
 #include "Font.h"
 
+#include "Vortex/Core/JobSystem.h"
+
 #include "Vortex/Project/Project.h"
 
 #include "Vortex/Renderer/Font/MSDFData.h"
@@ -41,7 +43,6 @@ namespace Vortex {
 #define DEFAULT_MITER_LIMIT 1.0
 #define LCG_MULTIPLIER 6364136223846793005ull
 #define LCG_INCREMENT 1442695040888963407ull
-#define THREADS 8
 
 	namespace Utils {
 
@@ -116,7 +117,8 @@ namespace Vortex {
 	{
 		ImmediateAtlasGenerator<S, N, GenFunc, BitmapAtlasStorage<T, N>> generator(config.width, config.height);
 		generator.setAttributes(config.generatorAttributes);
-		generator.setThreadCount(THREADS);
+		// The generator manages its own threads, size it to match the job system so we don't oversubscribe
+		generator.setThreadCount((int)Math::Max(JobSystem::GetWorkerCount(), 1u));
 		generator.generate(glyphs.data(), (int)glyphs.size());
 
 		msdfgen::BitmapConstRef<T, N> bitmap = (msdfgen::BitmapConstRef<T, N>) generator.atlasStorage();
@@ -366,12 +368,11 @@ namespace Vortex {
 		{
 			if (config.expensiveColoring)
 			{
-				Workload([&glyphs = m_MSDFData->Glyphs, &config](int i, int threadNo) -> bool
+				JobSystem::ParallelFor((uint32_t)m_MSDFData->Glyphs.size(), [&glyphs = m_MSDFData->Glyphs, &config](uint32_t i)
 				{
 					unsigned long long glyphSeed = (LCG_MULTIPLIER * (config.coloringSeed ^ i) + LCG_INCREMENT) * !!config.coloringSeed;
 					glyphs[i].edgeColoring(config.edgeColoring, config.angleThreshold, glyphSeed);
-					return true;
-				}, (int)m_MSDFData->Glyphs.size()).finish(THREADS);
+				});
 			}
 			else
 			{
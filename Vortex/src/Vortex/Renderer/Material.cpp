@@ -9,15 +9,27 @@
 
 namespace Vortex {
 
+	namespace Utils {
+
+		// Maps are streamed in the background, until one is ready the material renders without it
+		static SharedReference<Texture2D> GetResidentTexture(AssetHandle handle)
+		{
+			if (!handle)
+				return nullptr;
+
+			return Project::GetAssetManager()->GetAssetAsync(handle).As<Texture2D>();
+		}
+
+	}
+
 	Material::Material(SharedReference<Shader> shader, const MaterialProperties& props)
 		: m_Shader(shader), m_Properties(props) { }
 
 	void Material::Bind() const
 	{
-		if (AssetHandle handle = GetTexture("u_NormalMap"))
+		if (SharedReference<Texture2D> normalMap = Utils::GetResidentTexture(GetTexture("u_NormalMap")))
 		{
 			uint32_t normalMapTextureSlot = 6;
-			SharedReference<Texture2D> normalMap = AssetManager::GetAsset<Texture2D>(handle);
 			normalMap->Bind(normalMapTextureSlot);
 			m_Shader->SetInt("u_Material.NormalMap", normalMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasNormalMap", true);
@@ -26,10 +38,10 @@ namespace Vortex {
 			m_Shader->SetBool("u_Material.HasNormalMap", false);
 
 		m_Shader->SetFloat3("u_Material.Albedo", m_Properties.Albedo);
-		if (AssetHandle handle = GetTexture("u_AlbedoMap"))
+		m_Shader->SetFloat2("u_Material.UV", m_Properties.UV);
+		if (SharedReference<Texture2D> albedoMap = Utils::GetResidentTexture(GetTexture("u_AlbedoMap")))
 		{
 			uint32_t albedoMapTextureSlot = 7;
-			SharedReference<Texture2D> albedoMap = AssetManager::GetAsset<Texture2D>(handle);
 			albedoMap->Bind(albedoMapTextureSlot);
 			m_Shader->SetInt("u_Material.AlbedoMap", albedoMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasAlbedoMap", true);
@@ -38,10 +50,9 @@ namespace Vortex {
 			m_Shader->SetBool("u_Material.HasAlbedoMap", false);
 
 		m_Shader->SetFloat("u_Material.Metallic", m_Properties.Metallic);
-		if (AssetHandle handle = GetTexture("u_MetallicMap"))
+		if (SharedReference<Texture2D> metallicMap = Utils::GetResidentTexture(GetTexture("u_MetallicMap")))
 		{
 			uint32_t metallicMapTextureSlot = 8;
-			SharedReference<Texture2D> metallicMap = AssetManager::GetAsset<Texture2D>(handle);
 			metallicMap->Bind(metallicMapTextureSlot);
 			m_Shader->SetInt("u_Material.MetallicMap", metallicMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasMetallicMap", true);
@@ -50,10 +61,9 @@ namespace Vortex {
 			m_Shader->SetBool("u_Material.HasMetallicMap", false);
 
 		m_Shader->SetFloat("u_Material.Roughness", m_Properties.Roughness);
-		if (AssetHandle handle = GetTexture("u_RoughnessMap"))
+		if (SharedReference<Texture2D> roughnessMap = Utils::GetResidentTexture(GetTexture("u_RoughnessMap")))
 		{
 			uint32_t roughnessMapTextureSlot = 9;
-			SharedReference<Texture2D> roughnessMap = AssetManager::GetAsset<Texture2D>(handle);
 			roughnessMap->Bind(roughnessMapTextureSlot);
 			m_Shader->SetInt("u_Material.RoughnessMap", roughnessMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasRoughnessMap", true);
@@ -62,10 +72,9 @@ namespace Vortex {
 			m_Shader->SetBool("u_Material.HasRoughnessMap", false);
 
 		m_Shader->SetFloat("u_Material.Emission", m_Properties.Emission);
-		if (AssetHandle handle = GetTexture("u_EmissionMap"))
+		if (SharedReference<Texture2D> emissionMap = Utils::GetResidentTexture(GetTexture("u_EmissionMap")))
 		{
 			uint32_t emissionMapTextureSlot = 10;
-			SharedReference<Texture2D> emissionMap = AssetManager::GetAsset<Texture2D>(handle);
 			emissionMap->Bind(emissionMapTextureSlot);
 			m_Shader->SetInt("u_Material.EmissionMap", emissionMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasEmissionMap", true);
@@ -73,10 +82,9 @@ namespace Vortex {
 		else
 			m_Shader->SetBool("u_Material.HasEmissionMap", false);
 
-		if (AssetHandle handle = GetTexture("u_ParallaxOcclusionMap"))
+		if (SharedReference<Texture2D> parallaxOcclusionMap = Utils::GetResidentTexture(GetTexture("u_ParallaxOcclusionMap")))
 		{
 			uint32_t parallaxOcclusionMapTextureSlot = 11;
-			SharedReference<Texture2D> parallaxOcclusionMap = AssetManager::GetAsset<Texture2D>(handle);
 			parallaxOcclusionMap->Bind(parallaxOcclusionMapTextureSlot);
 			m_Shader->SetInt("u_Material.POMap", parallaxOcclusionMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasPOMap", true);
@@ -85,10 +93,9 @@ namespace Vortex {
 		else
 			m_Shader->SetBool("u_Material.HasPOMap", false);
 
-		if (AssetHandle handle = GetTexture("u_AmbientOcclusionMap"))
+		if (SharedReference<Texture2D> ambientOcclusionMap = Utils::GetResidentTexture(GetTexture("u_AmbientOcclusionMap")))
 		{
 			uint32_t ambientOcclusionMapTextureSlot = 12;
-			SharedReference<Texture2D> ambientOcclusionMap = AssetManager::GetAsset<Texture2D>(handle);
 			ambientOcclusionMap->Bind(ambientOcclusionMapTextureSlot);
 			m_Shader->SetInt("u_Material.AOMap", ambientOcclusionMapTextureSlot);
 			m_Shader->SetBool("u_Material.HasAOMap", true);
@@ -3,7 +3,9 @@
 
 #include "Vortex/Renderer/Texture.h"
 #include "Vortex/Renderer/Renderer.h"
+#include "Vortex/Renderer/MeshCache.h"
 #include "Vortex/Project/Project.h"
+#include "Vortex/Asset/AssetManager.h"
 #include "Vortex/Animation/Animator.h"
 #include "Vortex/Animation/AssimpAPIHelpers.h"
 #include "Vortex/Utils/FileSystem.h"
@@ -31,6 +33,10 @@ namespace Vortex {
 	{
 		static void Initialize()
 		{
+			// Imports run on job workers, only the first one may create the logger
+			static std::mutex s_InitializeMutex;
+			std::scoped_lock<std::mutex> lock(s_InitializeMutex);
+
 			if (Assimp::DefaultLogger::isNullLogger())
 			{
 				Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE);
@@ -46,6 +52,13 @@ namespace Vortex {
 
 	Submesh::Submesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, SharedReference<Material>& material)
 		: m_MeshName(name), m_Vertices(vertices), m_Indices(indices), m_Material(material)
+	{
+		CreateAndUploadMesh();
+		CreateBoundingBoxFromVertices();
+	}
+
+	Submesh::Submesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, SharedReference<Material>& material, const Math::AABB& boundingBox)
+		: m_MeshName(name), m_Vertices(vertices), m_Indices(indices), m_Material(material), m_BoundingBox(boundingBox)
 	{
 		CreateAndUploadMesh();
 	}
@@ -69,18 +82,14 @@ namespace Vortex {
 			{ ShaderDataType::Float3, "a_Tangent"     },
 			{ ShaderDataType::Float3, "a_BiTangent"   },
 			{ ShaderDataType::Float2, "a_TexCoord"    },
-			{ ShaderDataType::Float2, "a_TexScale"    },
 			{ ShaderDataType::Int4,   "a_BoneIDs"     },
 			{ ShaderDataType::Float4, "a_BoneWeights" },
-			{ ShaderDataType::Int,    "a_EntityID"    },
 		});
 
 		m_VertexArray->AddVertexBuffer(m_VertexBuffer);
 
 		m_IndexBuffer = IndexBuffer::Create(m_Indices.data(), m_Indices.size());
 		m_VertexArray->SetIndexBuffer(m_IndexBuffer);
-
-		CreateBoundingBoxFromVertices();
 	}
 
 	void Submesh::CreateBoundingBoxFromVertices()
@@ -120,51 +129,108 @@ namespace Vortex {
 		Renderer::DrawIndexed(shader, m_VertexArray);
 	}
 
-	Mesh::Mesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID)
+	Mesh::Mesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions)
 		: m_ImportOptions(importOptions)
 	{
-		LogStream::Initialize();
+		MeshData meshData;
+		if (!LoadMeshData(filepath, importOptions, meshData))
+		{
+			return;
+		}
+
+		CreateFromMeshData(filepath, meshData);
+	}
+
+	Mesh::Mesh(const std::string& filepath, const MeshImportOptions& importOptions, const MeshData& meshData)
+		: m_ImportOptions(importOptions)
+	{
+		CreateFromMeshData(filepath, meshData);
+	}
+
+	bool Mesh::LoadMeshData(const std::string& filepath, const MeshImportOptions& importOptions, MeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
 
 		VX_CORE_INFO_TAG("Mesh", "Loading Mesh: {}", filepath.c_str());
 
-		Assimp::Importer importer;
+		const uint64_t cacheKey = MeshCache::GetCacheKey(filepath, importOptions, MeshCacheType::Mesh);
 
-		const aiScene* scene = importer.ReadFile(filepath, s_MeshImportFlags);
-		if (!scene || !scene->HasMeshes())
+		if (MeshCache::TryLoad(filepath, cacheKey, outData))
+		{
+			return true;
+		}
+
+		if (!Import(filepath, importOptions, outData))
+		{
+			return false;
+		}
+
+		MeshCache::Write(cacheKey, outData);
+
+		return true;
+	}
+
+	void Mesh::CreateFromMeshData(const std::string& filepath, const MeshData& meshData)
+	{
+		const MeshSubmeshData<Vertex>& submeshData = meshData.Submesh;
+		if (submeshData.Vertices.empty())
 		{
-			VX_CORE_ERROR_TAG("Mesh", "Failed to load Mesh from: {}", filepath.c_str());
 			return;
 		}
 
-		m_Scene = scene;
+		SharedReference<Material> material = CreateMaterial(FileSystem::GetParentDirectory(filepath), submeshData.Material);
+		m_Submesh = Submesh(submeshData.Name, submeshData.Vertices, submeshData.Indices, material, submeshData.BoundingBox);
+
+		m_BoneInfoMap = meshData.BoneInfoMap;
+		m_BoneCounter = meshData.BoneCount;
+		m_HasAnimations = meshData.HasAnimations;
 
-		ProcessNode(filepath, m_Scene->mRootNode, m_Scene, importOptions, entityID);
 		CreateBoundingBoxFromSubmeshes();
 
 		m_IsLoaded = true;
 	}
 
-	void Mesh::ProcessNode(const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID)
+	bool Mesh::Import(const std::string& filepath, const MeshImportOptions& importOptions, MeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		LogStream::Initialize();
+
+		Assimp::Importer importer;
+
+		const aiScene* scene = importer.ReadFile(filepath, s_MeshImportFlags);
+		if (!scene || !scene->HasMeshes())
+		{
+			VX_CORE_ERROR_TAG("Mesh", "Failed to load Mesh from: {}", filepath.c_str());
+			return false;
+		}
+
+		ProcessNode(filepath, scene->mRootNode, scene, importOptions, outData);
+
+		return !outData.Submesh.Vertices.empty();
+	}
+
+	void Mesh::ProcessNode(const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, MeshData& outData)
 	{
 		// process all node meshes
 		for (uint32_t i = 0; i < node->mNumMeshes; i++)
 		{
 			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			m_Submesh = ProcessMesh(filepath, mesh, scene, importOptions, entityID);
+			outData.Submesh = ProcessMesh(filepath, mesh, scene, importOptions, outData);
 		}
 
 		// do the same for children nodes
 		for (uint32_t i = 0; i < node->mNumChildren; i++)
 		{
-			ProcessNode(filepath, node->mChildren[i], scene, importOptions, entityID);
+			ProcessNode(filepath, node->mChildren[i], scene, importOptions, outData);
 		}
 	}
 
-	Submesh Mesh::ProcessMesh(const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID)
+	MeshSubmeshData<Vertex> Mesh::ProcessMesh(const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, MeshData& outData)
 	{
 		std::vector<Vertex> vertices;
 		std::vector<uint32_t> indices;
-		SharedReference<Material> material = nullptr;
+		MeshMaterialBinding binding;
 
 		const TransformComponent& importTransform = importOptions.MeshTransformation;
 		Math::vec3 rotation = importTransform.GetRotationEuler();
@@ -214,8 +280,6 @@ namespace Vortex {
 				vertex.BiTangent = Math::vec3(transform * Math::vec4(Math::vec3{ mesh->mBitangents[i].x, mesh->mBitangents[i].y, mesh->mBitangents[i].z }, 1.0f));
 			}
 
-			vertex.TexScale = Math::vec2(1.0f);
-
 			vertex.TexCoord = Math::vec2(0.0f);
 			// does it contain texture coords?
 			if (mesh->mTextureCoords[0])
@@ -223,7 +287,6 @@ namespace Vortex {
 				vertex.TexCoord = { mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y };
 			}
 
-			vertex.EntityID = entityID;
 			vertices.push_back(vertex);
 		}
 
@@ -242,50 +305,84 @@ namespace Vortex {
 		{
 			aiMaterial* mat = scene->mMaterials[mesh->mMaterialIndex];
 
-			MaterialProperties materialProps;
-			materialProps.Name = std::string(mat->GetName().C_Str());
+			binding.Name = std::string(mat->GetName().C_Str());
 
 			Fs::Path directoryPath = FileSystem::GetParentDirectory(Fs::Path(filepath));
 
-			auto LoadMaterialTextureFunc = [&](auto textureType, auto index = 0)
+			// Only paths that exist are kept, the asset handles are looked up when the mesh is created
+			auto GetMaterialTextureFilepath = [&](auto textureType, auto index = 0) -> std::string
 			{
-				AssetHandle result = 0;
-
 				aiString textureFilepath;
 
 				if (mat->GetTexture(textureType, index, &textureFilepath) != AI_SUCCESS)
-					return result;
+					return "";
 
 				const char* pathCStr = textureFilepath.C_Str();
 				Fs::Path filepath = Fs::Path(pathCStr);
 				Fs::Path relativePath = directoryPath / filepath;
 
-				if (FileSystem::Exists(relativePath))
-				{
-					result = Project::GetEditorAssetManager()->GetAssetHandleFromFilepath(relativePath);
-				}
+				if (!FileSystem::Exists(relativePath))
+					return "";
 
-				return result;
+				return std::string(pathCStr);
 			};
 
-			std::unordered_map<std::string, AssetHandle>& materialTextures = materialProps.Textures;
+			auto& textures = binding.TextureFilepaths;
 
-			materialTextures["u_AlbedoMap"] = LoadMaterialTextureFunc(aiTextureType_DIFFUSE, 0);
-			if (!materialTextures["u_AlbedoMap"])
-				materialTextures["u_AlbedoMap"] = LoadMaterialTextureFunc(aiTextureType_BASE_COLOR, 0);
+			textures[(size_t)MeshMaterialTexture::Albedo] = GetMaterialTextureFilepath(aiTextureType_DIFFUSE, 0);
+			if (textures[(size_t)MeshMaterialTexture::Albedo].empty())
+				textures[(size_t)MeshMaterialTexture::Albedo] = GetMaterialTextureFilepath(aiTextureType_BASE_COLOR, 0);
 
-			materialTextures["u_NormalMap"] = LoadMaterialTextureFunc(aiTextureType_NORMALS, 0);
-			materialTextures["u_MetallicMap"] = LoadMaterialTextureFunc(aiTextureType_METALNESS, 0);
-			materialTextures["u_RoughnessMap"] = LoadMaterialTextureFunc(aiTextureType_REFLECTION, 0);
-			materialTextures["u_EmissionMap"] = LoadMaterialTextureFunc(aiTextureType_EMISSIVE, 0);
-			materialTextures["u_AmbientOcclusionMap"] = LoadMaterialTextureFunc(aiTextureType_AMBIENT_OCCLUSION, 0);
-			
-			material = Material::Create(Renderer::GetShaderLibrary().Get("PBR"), materialProps);
+			textures[(size_t)MeshMaterialTexture::Normal] = GetMaterialTextureFilepath(aiTextureType_NORMALS, 0);
+			textures[(size_t)MeshMaterialTexture::Metallic] = GetMaterialTextureFilepath(aiTextureType_METALNESS, 0);
+			textures[(size_t)MeshMaterialTexture::Roughness] = GetMaterialTextureFilepath(aiTextureType_REFLECTION, 0);
+			textures[(size_t)MeshMaterialTexture::Emission] = GetMaterialTextureFilepath(aiTextureType_EMISSIVE, 0);
+			textures[(size_t)MeshMaterialTexture::AmbientOcclusion] = GetMaterialTextureFilepath(aiTextureType_AMBIENT_OCCLUSION, 0);
+
+			binding.IsValid = true;
 		}
 
-		m_HasAnimations = ExtractBoneWeightsForVertices(vertices, mesh, scene);
+		outData.HasAnimations = ExtractBoneWeightsForVertices(vertices, mesh, scene, outData);
+
+		MeshSubmeshData<Vertex> submeshData;
+		submeshData.Name = meshName;
+		submeshData.Vertices = std::move(vertices);
+		submeshData.Indices = std::move(indices);
+		submeshData.Material = binding;
+		submeshData.CalculateBoundingBox();
 
-		return { meshName, vertices, indices, material };
+		return submeshData;
+	}
+
+	SharedReference<Material> Mesh::CreateMaterial(const Fs::Path& directory, const MeshMaterialBinding& binding) const
+	{
+		if (!binding.IsValid)
+		{
+			return nullptr;
+		}
+
+		auto GetTextureHandle = [&directory, &binding](MeshMaterialTexture texture) -> AssetHandle
+		{
+			const std::string& textureFilepath = binding.TextureFilepaths[(size_t)texture];
+			if (textureFilepath.empty())
+				return AssetHandle(0);
+
+			const AssetHandle handle = Project::GetAssetManager()->GetAssetHandleFromFilepath(directory / textureFilepath);
+			return AssetManager::IsHandleValid(handle) ? handle : AssetHandle(0);
+		};
+
+		MaterialProperties materialProps;
+		materialProps.Name = binding.Name;
+
+		std::unordered_map<std::string, AssetHandle>& materialTextures = materialProps.Textures;
+		materialTextures["u_AlbedoMap"] = GetTextureHandle(MeshMaterialTexture::Albedo);
+		materialTextures["u_NormalMap"] = GetTextureHandle(MeshMaterialTexture::Normal);
+		materialTextures["u_MetallicMap"] = GetTextureHandle(MeshMaterialTexture::Metallic);
+		materialTextures["u_RoughnessMap"] = GetTextureHandle(MeshMaterialTexture::Roughness);
+		materialTextures["u_EmissionMap"] = GetTextureHandle(MeshMaterialTexture::Emission);
+		materialTextures["u_AmbientOcclusionMap"] = GetTextureHandle(MeshMaterialTexture::AmbientOcclusion);
+
+		return Material::Create(Renderer::GetShaderLibrary().Get("PBR"), materialProps);
 	}
 
 	void Mesh::CreateBoundingBoxFromSubmeshes()
@@ -294,7 +391,7 @@ namespace Vortex {
 		m_BoundingBox = m_Submesh.GetBoundingBox();
 	}
 
-	void Mesh::SetVertexBoneDataToDefault(Vertex& vertex) const
+	void Mesh::SetVertexBoneDataToDefault(Vertex& vertex)
 	{
 		for (uint32_t i = 0; i < MAX_BONE_INFLUENCE; i++)
 		{
@@ -303,7 +400,7 @@ namespace Vortex {
 		}
 	}
 
-	void Mesh::SetVertexBoneData(Vertex& vertex, int boneID, float weight) const
+	void Mesh::SetVertexBoneData(Vertex& vertex, int boneID, float weight)
 	{
 		for (int i = 0; i < MAX_BONE_INFLUENCE; i++)
 		{
@@ -316,13 +413,13 @@ namespace Vortex {
 		}
 	}
 
-	bool Mesh::ExtractBoneWeightsForVertices(std::vector<Vertex>& vertices, aiMesh* mesh, const aiScene* scene)
+	bool Mesh::ExtractBoneWeightsForVertices(std::vector<Vertex>& vertices, aiMesh* mesh, const aiScene* scene, MeshData& outData)
 	{
 		if (!scene->HasAnimations())
 			return false;
 
-		auto& boneInfoMap = m_BoneInfoMap;
-		uint32_t& boneCount = m_BoneCounter;
+		auto& boneInfoMap = outData.BoneInfoMap;
+		uint32_t& boneCount = outData.BoneCount;
 
 		for (uint32_t boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex)
 		{
@@ -358,36 +455,14 @@ namespace Vortex {
 		return true;
 	}
 
-	void Mesh::OnUpdate(int entityID)
+	SharedReference<Mesh> Mesh::Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions)
 	{
-		bool dirty = false;
-
-		std::vector<Vertex>& vertices = m_Submesh.GetVertices();
-
-		size_t dataSize = vertices.size();
-		for (uint32_t i = 0; i < dataSize; i++)
-		{
-			Vertex& vertex = vertices[i];
-			SharedReference<Material> material = m_Submesh.GetMaterial();
-
-			dirty = vertex.TexScale != material->GetUV() || vertex.EntityID != entityID;
-			if (!dirty)
-				continue;
-
-			vertex.TexScale = material->GetUV();
-			vertex.EntityID = entityID;
-		}
-
-		if (!dirty)
-			return;
-
-		SharedReference<VertexBuffer> vertexBuffer = m_Submesh.GetVertexBuffer();
-		vertexBuffer->SetData(vertices.data(), vertices.size() * sizeof(Vertex));
+		return SharedReference<Mesh>::Create(filepath, transform, importOptions);
 	}
 
-	SharedReference<Mesh> Mesh::Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID)
+	SharedReference<Mesh> Mesh::Create(const std::string& filepath, const MeshImportOptions& importOptions, const MeshData& meshData)
 	{
-		return SharedReference<Mesh>::Create(filepath, transform, importOptions, (int)(entt::entity)entityID);
+		return SharedReference<Mesh>::Create(filepath, importOptions, meshData);
 	}
 
 }
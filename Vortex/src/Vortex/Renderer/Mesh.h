@@ -16,6 +16,8 @@
 
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
+#include "Vortex/Utils/FileSystem.h"
+
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -29,6 +31,11 @@ namespace Vortex {
 
 #define MAX_BONE_INFLUENCE 4
 
+	template <typename TVertex>
+	struct MeshSubmeshData;
+	struct MeshMaterialBinding;
+	struct MeshData;
+
 	struct VORTEX_API BoneInfo
 	{
 		uint32_t ID;
@@ -40,6 +47,7 @@ namespace Vortex {
 	public:
 		Submesh() = default;
 		Submesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, SharedReference<Material>& material);
+		Submesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, SharedReference<Material>& material, const Math::AABB& boundingBox);
 		~Submesh() = default;
 
 		VX_FORCE_INLINE const std::string& GetName() const { return m_MeshName; }
@@ -54,7 +62,6 @@ namespace Vortex {
 		void SetMaterial(SharedReference<Material>& material);
 		
 		const std::vector<Vertex>& GetVertices() const { return m_Vertices; }
-		std::vector<Vertex>& GetVertices() { return m_Vertices; }
 
 		const std::vector<uint32_t> GetIndices() const { return m_Indices; }
 
@@ -83,11 +90,11 @@ namespace Vortex {
 	{
 	public:
 		Mesh() = default;
-		Mesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID);
+		Mesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions);
+		// Creates the GPU buffers and material for data that was already imported with LoadMeshData
+		Mesh(const std::string& filepath, const MeshImportOptions& importOptions, const MeshData& meshData);
 		~Mesh() override = default;
 
-		void OnUpdate(int entityID = -1);
-
 		const Submesh& GetSubmesh() const { return m_Submesh; }
 		Submesh& GetSubmesh() { return m_Submesh; }
 
@@ -101,15 +108,24 @@ namespace Vortex {
 
 		ASSET_CLASS_TYPE(MeshAsset)
 
-		static SharedReference<Mesh> Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions = MeshImportOptions(), int entityID = -1);
+		static SharedReference<Mesh> Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions = MeshImportOptions());
+		static SharedReference<Mesh> Create(const std::string& filepath, const MeshImportOptions& importOptions, const MeshData& meshData);
+
+		// Reads the mesh cache or runs the import, only touches the CPU so it can run on any thread
+		static bool LoadMeshData(const std::string& filepath, const MeshImportOptions& importOptions, MeshData& outData);
 
 	private:
-		void ProcessNode(const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID);
-		Submesh ProcessMesh(const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID);
+		void CreateFromMeshData(const std::string& filepath, const MeshData& meshData);
+
+		static bool Import(const std::string& filepath, const MeshImportOptions& importOptions, MeshData& outData);
+		static void ProcessNode(const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, MeshData& outData);
+		static MeshSubmeshData<Vertex> ProcessMesh(const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, MeshData& outData);
+
+		SharedReference<Material> CreateMaterial(const Fs::Path& directory, const MeshMaterialBinding& binding) const;
 
-		void SetVertexBoneDataToDefault(Vertex& vertex) const;
-		void SetVertexBoneData(Vertex& vertex, int boneID, float weight) const;
-		bool ExtractBoneWeightsForVertices(std::vector<Vertex>& vertices, aiMesh* mesh, const aiScene* scene);
+		static void SetVertexBoneDataToDefault(Vertex& vertex);
+		static void SetVertexBoneData(Vertex& vertex, int boneID, float weight);
+		static bool ExtractBoneWeightsForVertices(std::vector<Vertex>& vertices, aiMesh* mesh, const aiScene* scene, MeshData& outData);
 
 		void CreateBoundingBoxFromSubmeshes();
 
@@ -117,7 +133,6 @@ namespace Vortex {
 		//Entity m_Entity;
 		Submesh m_Submesh;
 		MeshImportOptions m_ImportOptions;
-		const aiScene* m_Scene;
 
 		std::unordered_map<std::string, BoneInfo> m_BoneInfoMap;
 		uint32_t m_BoneCounter = 0;
@@ -0,0 +1,346 @@
+#include "vxpch.h"
+#include "MeshCache.h"
+
+#include "Vortex/Project/Project.h"
+
+#include "Vortex/Serialization/StreamWriter.h"
+#include "Vortex/Serialization/StreamReader.h"
+
+#include "Vortex/Utils/Hash.h"
+
+#include <atomic>
+
+namespace Vortex {
+
+	struct MeshCacheHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint64_t Key = 0;
+		MeshCacheType Type = MeshCacheType::None;
+		uint32_t SubmeshCount = 0;
+	};
+
+	namespace Utils {
+
+		static constexpr uint32_t s_MeshCacheMagic = 0x434D5856; // VXMC
+
+		// Bump whenever the import flags, the vertex layouts or the file layout change
+		static constexpr uint32_t s_MeshCacheVersion = 2;
+
+		static std::atomic<uint32_t> s_CacheHits = 0;
+		static std::atomic<uint32_t> s_CacheMisses = 0;
+
+		static Fs::Path GetMeshCacheFilepath(uint64_t key)
+		{
+			const Fs::Path directory = Project::GetActive() ? Project::GetCacheDirectory() / "Meshes" : "Resources/Cache/Meshes";
+			return directory / fmt::format("{:016x}.vxmc", key);
+		}
+
+		static void WriteMaterialBinding(StreamWriter& writer, const MeshMaterialBinding& binding)
+		{
+			writer.WriteRaw(binding.IsValid);
+			writer.WriteString(binding.Name);
+
+			for (const std::string& textureFilepath : binding.TextureFilepaths)
+			{
+				writer.WriteString(textureFilepath);
+			}
+		}
+
+		static bool ReadMaterialBinding(StreamReader& reader, MeshMaterialBinding& binding)
+		{
+			reader.ReadRaw(binding.IsValid);
+			reader.ReadString(binding.Name);
+
+			for (std::string& textureFilepath : binding.TextureFilepaths)
+			{
+				reader.ReadString(textureFilepath);
+			}
+
+			return reader;
+		}
+
+		template <typename TVertex>
+		static void WriteSubmesh(StreamWriter& writer, const MeshSubmeshData<TVertex>& submesh)
+		{
+			writer.WriteRaw(submesh.Index);
+			writer.WriteString(submesh.Name);
+			writer.WriteArray(submesh.Vertices);
+			writer.WriteArray(submesh.Indices);
+			writer.WriteRaw(submesh.BoundingBox);
+			WriteMaterialBinding(writer, submesh.Material);
+		}
+
+		template <typename TVertex>
+		static bool ReadSubmesh(StreamReader& reader, MeshSubmeshData<TVertex>& submesh)
+		{
+			reader.ReadRaw(submesh.Index);
+			reader.ReadString(submesh.Name);
+			reader.ReadArray(submesh.Vertices);
+			reader.ReadArray(submesh.Indices);
+			reader.ReadRaw(submesh.BoundingBox);
+			ReadMaterialBinding(reader, submesh.Material);
+
+			return reader && !submesh.Vertices.empty();
+		}
+
+		static bool ValidateHeader(const Buffer& buffer, MeshCacheType type, MeshCacheHeader& outHeader)
+		{
+			if (!buffer || buffer.Size < sizeof(MeshCacheHeader))
+				return false;
+
+			outHeader = *(const MeshCacheHeader*)buffer.Data;
+
+			return outHeader.Magic == s_MeshCacheMagic
+				&& outHeader.Version == s_MeshCacheVersion
+				&& outHeader.Type == type;
+		}
+
+		// The header is validated before anything else is parsed
+		static bool ReadStaticMeshData(const Buffer& buffer, StaticMeshData& outData)
+		{
+			MeshCacheHeader header;
+			if (!ValidateHeader(buffer, MeshCacheType::StaticMesh, header))
+				return false;
+
+			StreamReader reader(buffer);
+			reader.ReadRaw(header);
+
+			outData.Submeshes.resize(header.SubmeshCount);
+
+			for (MeshSubmeshData<StaticVertex>& submesh : outData.Submeshes)
+			{
+				if (!ReadSubmesh(reader, submesh))
+				{
+					outData.Submeshes.clear();
+					return false;
+				}
+			}
+
+			return !outData.Submeshes.empty();
+		}
+
+		static bool ReadMeshData(const Buffer& buffer, MeshData& outData)
+		{
+			MeshCacheHeader header;
+			if (!ValidateHeader(buffer, MeshCacheType::Mesh, header))
+				return false;
+
+			StreamReader reader(buffer);
+			reader.ReadRaw(header);
+
+			const bool loaded = ReadSubmesh(reader, outData.Submesh);
+
+			uint32_t boneInfoCount = 0;
+			reader.ReadRaw(boneInfoCount);
+			reader.ReadRaw(outData.BoneCount);
+			reader.ReadRaw(outData.HasAnimations);
+
+			for (uint32_t i = 0; i < boneInfoCount && reader; i++)
+			{
+				std::string boneName;
+				BoneInfo boneInfo;
+				reader.ReadString(boneName);
+				reader.ReadRaw(boneInfo);
+
+				outData.BoneInfoMap[boneName] = boneInfo;
+			}
+
+			return loaded && reader;
+		}
+
+		static void WriteStaticMeshData(StreamWriter& writer, uint64_t key, const StaticMeshData& data)
+		{
+			MeshCacheHeader header;
+			header.Magic = s_MeshCacheMagic;
+			header.Version = s_MeshCacheVersion;
+			header.Key = key;
+			header.Type = MeshCacheType::StaticMesh;
+			header.SubmeshCount = (uint32_t)data.Submeshes.size();
+
+			writer.WriteRaw(header);
+
+			for (const MeshSubmeshData<StaticVertex>& submesh : data.Submeshes)
+			{
+				WriteSubmesh(writer, submesh);
+			}
+		}
+
+		static void WriteMeshData(StreamWriter& writer, uint64_t key, const MeshData& data)
+		{
+			MeshCacheHeader header;
+			header.Magic = s_MeshCacheMagic;
+			header.Version = s_MeshCacheVersion;
+			header.Key = key;
+			header.Type = MeshCacheType::Mesh;
+			header.SubmeshCount = 1;
+
+			writer.WriteRaw(header);
+
+			WriteSubmesh(writer, data.Submesh);
+
+			writer.WriteRaw<uint32_t>((uint32_t)data.BoneInfoMap.size());
+			writer.WriteRaw(data.BoneCount);
+			writer.WriteRaw(data.HasAnimations);
+
+			for (const auto& [boneName, boneInfo] : data.BoneInfoMap)
+			{
+				writer.WriteString(boneName);
+				writer.WriteRaw(boneInfo);
+			}
+		}
+
+		// The whole file is read with a single call, entries written for a different key are rejected
+		static Buffer ReadCacheFile(uint64_t key)
+		{
+			const Fs::Path filepath = GetMeshCacheFilepath(key);
+			if (!FileSystem::Exists(filepath))
+				return Buffer();
+
+			Buffer buffer = FileSystem::ReadBinary(filepath);
+
+			if (buffer && (buffer.Size < sizeof(MeshCacheHeader) || buffer.As<MeshCacheHeader>()->Key != key))
+			{
+				buffer.Release();
+			}
+
+			return buffer;
+		}
+
+		static void WriteCacheFile(uint64_t key, const StreamWriter& writer)
+		{
+			const Fs::Path filepath = GetMeshCacheFilepath(key);
+
+			if (!writer.WriteToFile(filepath))
+			{
+				VX_CORE_ERROR_TAG("Mesh", "Failed to cache mesh to {}", filepath.string());
+			}
+		}
+
+		static Buffer CopyToBuffer(const StreamWriter& writer)
+		{
+			Buffer buffer(writer.GetSize());
+			memcpy(buffer.Data, writer.GetData(), writer.GetSize());
+			return buffer;
+		}
+
+		static void LogCacheLookup(const Fs::Path& sourceFilepath, bool hit)
+		{
+			const uint32_t hits = hit ? ++s_CacheHits : s_CacheHits.load();
+			const uint32_t misses = hit ? s_CacheMisses.load() : ++s_CacheMisses;
+
+			VX_CORE_INFO_TAG("Mesh", "Mesh cache {} for {} ({} hits, {} misses)", hit ? "hit" : "miss", sourceFilepath.string(), hits, misses);
+		}
+
+	}
+
+	uint64_t MeshCache::GetCacheKey(const Fs::Path& sourceFilepath, const MeshImportOptions& importOptions, MeshCacheType type)
+	{
+		VX_PROFILE_FUNCTION();
+
+		Buffer source = FileSystem::ReadBinary(sourceFilepath);
+		if (!source)
+		{
+			return 0;
+		}
+
+		Fnv1a hasher;
+
+		const uint32_t header[] = { Utils::s_MeshCacheVersion, (uint32_t)type };
+		hasher.AddBytes(header, sizeof(header));
+		hasher.AddBytes(source.Data, source.Size);
+
+		const TransformComponent& transform = importOptions.MeshTransformation;
+		hasher.Add(transform.Translation);
+		hasher.Add(transform.GetRotationEuler());
+		hasher.Add(transform.Scale);
+
+		source.Release();
+
+		return hasher.GetKey();
+	}
+
+	bool MeshCache::TryLoad(const Fs::Path& sourceFilepath, uint64_t key, StaticMeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		Buffer buffer = key != 0 ? Utils::ReadCacheFile(key) : Buffer();
+		const bool loaded = Utils::ReadStaticMeshData(buffer, outData);
+		buffer.Release();
+
+		Utils::LogCacheLookup(sourceFilepath, loaded);
+
+		return loaded;
+	}
+
+	bool MeshCache::TryLoad(const Fs::Path& sourceFilepath, uint64_t key, MeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		Buffer buffer = key != 0 ? Utils::ReadCacheFile(key) : Buffer();
+		const bool loaded = Utils::ReadMeshData(buffer, outData);
+		buffer.Release();
+
+		Utils::LogCacheLookup(sourceFilepath, loaded);
+
+		return loaded;
+	}
+
+	void MeshCache::Write(uint64_t key, const StaticMeshData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (key == 0 || data.Submeshes.empty())
+			return;
+
+		StreamWriter writer;
+		Utils::WriteStaticMeshData(writer, key, data);
+		Utils::WriteCacheFile(key, writer);
+	}
+
+	void MeshCache::Write(uint64_t key, const MeshData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (key == 0 || data.Submesh.Vertices.empty())
+			return;
+
+		StreamWriter writer;
+		Utils::WriteMeshData(writer, key, data);
+		Utils::WriteCacheFile(key, writer);
+	}
+
+	Buffer MeshCache::Serialize(const StaticMeshData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		StreamWriter writer;
+		Utils::WriteStaticMeshData(writer, 0, data);
+		return Utils::CopyToBuffer(writer);
+	}
+
+	Buffer MeshCache::Serialize(const MeshData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		StreamWriter writer;
+		Utils::WriteMeshData(writer, 0, data);
+		return Utils::CopyToBuffer(writer);
+	}
+
+	bool MeshCache::Deserialize(const Buffer& payload, StaticMeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		return Utils::ReadStaticMeshData(payload, outData);
+	}
+
+	bool MeshCache::Deserialize(const Buffer& payload, MeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		return Utils::ReadMeshData(payload, outData);
+	}
+
+}
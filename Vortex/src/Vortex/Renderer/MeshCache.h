@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
+
+#include "Vortex/Asset/Asset.h"
+
+#include "Vortex/Math/AABB.h"
+
+#include "Vortex/Renderer/Mesh.h"
+#include "Vortex/Renderer/MeshImportOptions.h"
+#include "Vortex/Renderer/VertexTypes.h"
+
+#include "Vortex/Utils/FileSystem.h"
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <array>
+
+namespace Vortex {
+
+	enum class MeshMaterialTexture : uint32_t
+	{
+		Albedo = 0, Normal, Metallic, Roughness, Emission, AmbientOcclusion, Count,
+	};
+
+	// What the importer found for a submesh's material, the material and texture assets are looked up when the mesh is created
+	struct VORTEX_API MeshMaterialBinding
+	{
+		std::string Name = "";
+		// Paths as written in the source file, empty if the material doesn't use the texture
+		std::array<std::string, (size_t)MeshMaterialTexture::Count> TextureFilepaths = {};
+		bool IsValid = false;
+	};
+
+	template <typename TVertex>
+	struct MeshSubmeshData
+	{
+		uint32_t Index = 0;
+		std::string Name = "";
+		std::vector<TVertex> Vertices;
+		std::vector<uint32_t> Indices;
+		Math::AABB BoundingBox;
+		MeshMaterialBinding Material;
+
+		void CalculateBoundingBox()
+		{
+			if (Vertices.empty())
+				return;
+
+			BoundingBox.Min = Vertices.at(0).Position;
+			BoundingBox.Max = Vertices.at(0).Position;
+
+			for (const TVertex& vertex : Vertices)
+			{
+				BoundingBox.Min = Math::Min(BoundingBox.Min, vertex.Position);
+				BoundingBox.Max = Math::Max(BoundingBox.Max, vertex.Position);
+			}
+		}
+	};
+
+	// Processed output of an import, enough to rebuild a mesh without running Assimp
+	struct VORTEX_API StaticMeshData
+	{
+		std::vector<MeshSubmeshData<StaticVertex>> Submeshes;
+	};
+
+	struct VORTEX_API MeshData
+	{
+		MeshSubmeshData<Vertex> Submesh;
+		std::unordered_map<std::string, BoneInfo> BoneInfoMap;
+		uint32_t BoneCount = 0;
+		bool HasAnimations = false;
+	};
+
+	enum class MeshCacheType : uint32_t
+	{
+		None = 0, StaticMesh, Mesh,
+	};
+
+	// Binary cache of imported geometry in Project::GetCacheDirectory(), entries are
+	// keyed by the source file's contents and the import options so stale entries are never read
+	class VORTEX_API MeshCache
+	{
+	public:
+		// Returns zero if the source file can't be read
+		static uint64_t GetCacheKey(const Fs::Path& sourceFilepath, const MeshImportOptions& importOptions, MeshCacheType type);
+
+		// Every lookup is logged along with the hit and miss counts since startup
+		static bool TryLoad(const Fs::Path& sourceFilepath, uint64_t key, StaticMeshData& outData);
+		static bool TryLoad(const Fs::Path& sourceFilepath, uint64_t key, MeshData& outData);
+
+		static void Write(uint64_t key, const StaticMeshData& data);
+		static void Write(uint64_t key, const MeshData& data);
+
+		// Same encoding as a cache entry without the key, used to store imported geometry inline in an asset pack
+		static Buffer Serialize(const StaticMeshData& data);
+		static Buffer Serialize(const MeshData& data);
+		static bool Deserialize(const Buffer& payload, StaticMeshData& outData);
+		static bool Deserialize(const Buffer& payload, MeshData& outData);
+	};
+
+}
@@ -2,7 +2,7 @@
 
 #include "Vortex/Asset/Asset.h"
 
-#include "Vortex/Renderer/ParticleSystem/Particle.h"
+#include "Vortex/Renderer/ParticleSystem/ParticlePool.h"
 #include "Vortex/Renderer/ParticleSystem/ParticleEmitterProperties.h"
 
 #include "Vortex/Core/TimeStep.h"
@@ -28,7 +28,7 @@ namespace Vortex {
 		ParticleEmitterProperties& GetProperties() { return m_Properties; }
 		void SetProperties(const ParticleEmitterProperties& props);
 
-		const std::vector<Particle>& GetParticles() const { return m_ParticlePool; }
+		const ParticlePool& GetParticles() const { return m_ParticlePool; }
 
 		void OnUpdate(TimeStep delta);
 
@@ -38,15 +38,11 @@ namespace Vortex {
 
 		static SharedReference<ParticleEmitter> Create(const ParticleEmitterProperties& props);
 
-	private:
-		inline static constexpr uint32_t s_MaxParticles = 1'000;
-
 	private:
 		ParticleEmitterProperties m_Properties;
 		std::string m_Name;
 		
-		std::vector<Particle> m_ParticlePool;
-		uint32_t m_PoolIndex = s_MaxParticles - 1;
+		ParticlePool m_ParticlePool;
 	};
 
 }
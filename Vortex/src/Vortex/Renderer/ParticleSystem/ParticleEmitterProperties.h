@@ -21,6 +21,9 @@ namespace Vortex {
 		float Rotation = 0.1f;
 		float LifeTime = 1.0f;
 
+		// Emitting while the pool is full drops the new particle
+		uint32_t MaxParticles = 1'000;
+
 		bool GenerateRandomColors = false;
 	};
 
@@ -0,0 +1,102 @@
+#include "vxpch.h"
+#include "ParticlePool.h"
+
+namespace Vortex {
+
+	void ParticlePool::SetCapacity(uint32_t capacity)
+	{
+		if (capacity == m_Capacity)
+			return;
+
+		m_Capacity = capacity;
+		m_LiveCount = Math::Min(m_LiveCount, capacity);
+
+		PositionX.resize(capacity);
+		PositionY.resize(capacity);
+		PositionZ.resize(capacity);
+		VelocityX.resize(capacity);
+		VelocityY.resize(capacity);
+		VelocityZ.resize(capacity);
+		Rotation.resize(capacity);
+		LifeTime.resize(capacity);
+		LifeRemaining.resize(capacity);
+		SizeBegin.resize(capacity);
+		RandomColor.resize(capacity);
+	}
+
+	void ParticlePool::Clear()
+	{
+		m_LiveCount = 0;
+	}
+
+	uint32_t ParticlePool::Emit()
+	{
+		if (m_LiveCount == m_Capacity)
+			return InvalidIndex;
+
+		return m_LiveCount++;
+	}
+
+	void ParticlePool::Update(float delta, float rotationSpeed)
+	{
+		VX_PROFILE_FUNCTION();
+
+		const uint32_t count = m_LiveCount;
+
+		float* positionX = PositionX.data();
+		float* positionY = PositionY.data();
+		float* positionZ = PositionZ.data();
+		const float* velocityX = VelocityX.data();
+		const float* velocityY = VelocityY.data();
+		const float* velocityZ = VelocityZ.data();
+		float* rotation = Rotation.data();
+		float* lifeRemaining = LifeRemaining.data();
+
+		// Branch free loops over contiguous floats, the compiler turns these into SIMD
+		for (uint32_t i = 0; i < count; i++)
+		{
+			positionX[i] += velocityX[i] * delta;
+			positionY[i] += velocityY[i] * delta;
+			positionZ[i] += velocityZ[i] * delta;
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			rotation[i] += rotationSpeed * delta;
+			lifeRemaining[i] -= delta;
+		}
+
+		// Survivors slide down over the dead ones, emission order is kept so blending stays stable
+		uint32_t liveCount = 0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (lifeRemaining[i] <= 0.0f)
+				continue;
+
+			if (i != liveCount)
+			{
+				Move(i, liveCount);
+			}
+
+			liveCount++;
+		}
+
+		m_LiveCount = liveCount;
+	}
+
+	void ParticlePool::Move(uint32_t from, uint32_t to)
+	{
+		PositionX[to] = PositionX[from];
+		PositionY[to] = PositionY[from];
+		PositionZ[to] = PositionZ[from];
+		VelocityX[to] = VelocityX[from];
+		VelocityY[to] = VelocityY[from];
+		VelocityZ[to] = VelocityZ[from];
+		Rotation[to] = Rotation[from];
+		LifeTime[to] = LifeTime[from];
+		LifeRemaining[to] = LifeRemaining[from];
+		SizeBegin[to] = SizeBegin[from];
+		RandomColor[to] = RandomColor[from];
+	}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Math/Math.h"
+
+#include <vector>
+
+namespace Vortex {
+
+	// Structure of arrays particle storage, live particles are always packed at the front
+	// oldest first so updates and draws never have to skip dead entries
+	class VORTEX_API ParticlePool
+	{
+	public:
+		ParticlePool() = default;
+		~ParticlePool() = default;
+
+		// Live particles past the new capacity are dropped
+		void SetCapacity(uint32_t capacity);
+		void Clear();
+
+		// Returns the index of the new particle, or InvalidIndex if the pool is full
+		uint32_t Emit();
+
+		// Integrates every live particle then compacts the ones that died
+		void Update(float delta, float rotationSpeed);
+
+		VX_FORCE_INLINE uint32_t GetCapacity() const { return m_Capacity; }
+		VX_FORCE_INLINE uint32_t GetLiveCount() const { return m_LiveCount; }
+
+	public:
+		static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+		// Positions and velocities are split per component so integration vectorizes
+		std::vector<float> PositionX, PositionY, PositionZ;
+		std::vector<float> VelocityX, VelocityY, VelocityZ;
+		std::vector<float> Rotation;
+		std::vector<float> LifeTime;
+		std::vector<float> LifeRemaining;
+		std::vector<Math::vec2> SizeBegin;
+		std::vector<Math::vec4> RandomColor;
+
+	private:
+		void Move(uint32_t from, uint32_t to);
+
+	private:
+		uint32_t m_Capacity = 0;
+		uint32_t m_LiveCount = 0;
+	};
+
+}
@@ -2,6 +2,7 @@
 #include "ParticleSystem.h"
 
 #include "Vortex/Core/Application.h"
+#include "Vortex/Core/JobSystem.h"
 
 #include "Vortex/Module/Module.h"
 
@@ -110,6 +111,22 @@ namespace Vortex {
 
 		VX_CORE_ASSERT(context, "Invalid scene!");
 
+		struct EmitterUpdate
+		{
+			SharedReference<ParticleEmitter> Emitter = nullptr;
+			uint32_t UpdateCount = 0;
+		};
+
+		struct EmitterSpawn
+		{
+			ParticleEmitter* Emitter = nullptr;
+			Math::vec3 Position;
+		};
+
+		std::vector<EmitterUpdate> emitterUpdates;
+		std::unordered_map<ParticleEmitter*, size_t> emitterIndices;
+		std::vector<EmitterSpawn> emitterSpawns;
+
 		auto view = context->GetAllActorsWith<ParticleEmitterComponent>();
 
 		for (const auto e : view)
@@ -126,16 +143,38 @@ namespace Vortex {
 			if (!particleEmitter)
 				continue;
 
-			// Set the particle position to the actor's translation
-			const Math::vec3 actorTranslation = context->GetWorldSpaceTransform(actor).Translation;
-			particleEmitter->GetProperties().Position = actorTranslation;
+			// Actors can share an emitter asset, so each emitter is only ever touched by one job
+			auto [it, inserted] = emitterIndices.try_emplace(particleEmitter.Raw(), emitterUpdates.size());
+			if (inserted)
+			{
+				emitterUpdates.push_back({ particleEmitter, 0 });
+			}
 
-			particleEmitter->OnUpdate(delta);
+			emitterUpdates[it->second].UpdateCount++;
 
 			if (!pmc.IsActive)
 				continue;
 
-			particleEmitter->EmitParticle();
+			// Set the particle position to the actor's translation
+			const Math::vec3 actorTranslation = context->GetWorldSpaceTransform(actor).Translation;
+			emitterSpawns.push_back({ particleEmitter.Raw(), actorTranslation });
+		}
+
+		JobSystem::ParallelFor((uint32_t)emitterUpdates.size(), [&emitterUpdates, delta](uint32_t index)
+		{
+			EmitterUpdate& update = emitterUpdates[index];
+
+			for (uint32_t i = 0; i < update.UpdateCount; i++)
+			{
+				update.Emitter->OnUpdate(delta);
+			}
+		});
+
+		// Emitting uses the global random generator so it stays on the main thread
+		for (const EmitterSpawn& spawn : emitterSpawns)
+		{
+			spawn.Emitter->GetProperties().Position = spawn.Position;
+			spawn.Emitter->EmitParticle();
 		}
 	}
 
@@ -44,6 +44,11 @@ namespace Vortex {
 			s_RendererAPI->DrawIndexed(vertexArray, indexCount);
 		}
 
+		inline static void DrawIndexedInstanced(const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance = 0)
+		{
+			s_RendererAPI->DrawIndexedInstanced(vertexArray, instanceCount, baseInstance);
+		}
+
 		inline static void DrawLines(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount)
 		{
 			s_RendererAPI->DrawLines(vertexArray, vertexCount);
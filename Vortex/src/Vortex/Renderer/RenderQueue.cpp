@@ -0,0 +1,138 @@
+#include "vxpch.h"
+#include "RenderQueue.h"
+
+namespace Vortex {
+
+	namespace Utils {
+
+		static constexpr uint64_t BitMask(uint32_t bits)
+		{
+			return (1ull << bits) - 1ull;
+		}
+
+		// Positive IEEE floats compare the same as their bit patterns, so the
+		// top bits (after the sign) give a monotonic quantized depth for free
+		static uint64_t QuantizeDepth(float depth, uint32_t bits)
+		{
+			depth = Math::Max(depth, 0.0f);
+
+			uint32_t depthBits;
+			std::memcpy(&depthBits, &depth, sizeof(float));
+
+			return (uint64_t)(depthBits >> (31 - bits)) & BitMask(bits);
+		}
+
+	}
+
+	void RenderQueue::Clear()
+	{
+		m_Commands.clear();
+		m_SortEntries.clear();
+
+		m_ShaderIndices.clear();
+		m_MaterialIndices.clear();
+		m_MeshIndices.clear();
+	}
+
+	void RenderQueue::Submit(uint64_t drawKey, const DrawCommand& command)
+	{
+		const uint32_t commandIndex = (uint32_t)m_Commands.size();
+
+		m_Commands.push_back(command);
+		m_SortEntries.push_back({ drawKey, commandIndex });
+	}
+
+	void RenderQueue::Submit(DrawPass pass, bool transparent, float depth, const DrawCommand& command)
+	{
+		const void* mesh = command.Type == DrawCommandType::Mesh ? (const void*)command.MeshSubmesh : (const void*)command.StaticMeshSubmesh;
+
+		const uint32_t shaderIndex = GetStateIndex(m_ShaderIndices, command.SubmeshShader);
+		const uint32_t materialIndex = GetStateIndex(m_MaterialIndices, command.SubmeshMaterial);
+		const uint32_t meshIndex = GetStateIndex(m_MeshIndices, mesh);
+
+		const uint64_t drawKey = CreateDrawKey(pass, transparent, shaderIndex, materialIndex, meshIndex, depth);
+		Submit(drawKey, command);
+	}
+
+	void RenderQueue::Sort()
+	{
+		VX_PROFILE_FUNCTION();
+
+		const size_t count = m_SortEntries.size();
+		if (count < 2)
+			return;
+
+		m_ScratchEntries.resize(count);
+
+		SortEntry* source = m_SortEntries.data();
+		SortEntry* destination = m_ScratchEntries.data();
+
+		// LSD radix sort, one byte per pass, stable so equal keys keep submission order
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			uint32_t histogram[256] = {};
+
+			for (size_t i = 0; i < count; i++)
+			{
+				histogram[(source[i].Key >> shift) & 0xFF]++;
+			}
+
+			// Every key shares this byte, nothing to reorder
+			if (histogram[(source[0].Key >> shift) & 0xFF] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < 256; bucket++)
+			{
+				const uint32_t bucketSize = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketSize;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				const uint32_t bucket = (source[i].Key >> shift) & 0xFF;
+				destination[histogram[bucket]++] = source[i];
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_SortEntries.data())
+		{
+			m_SortEntries.swap(m_ScratchEntries);
+		}
+	}
+
+	uint64_t RenderQueue::CreateDrawKey(DrawPass pass, bool transparent, uint32_t shaderIndex, uint32_t materialIndex, uint32_t meshIndex, float depth)
+	{
+		uint64_t key = ((uint64_t)pass & Utils::BitMask(2)) << 62;
+
+		if (!transparent)
+		{
+			key |= ((uint64_t)shaderIndex & Utils::BitMask(12)) << 49;
+			key |= ((uint64_t)materialIndex & Utils::BitMask(14)) << 35;
+			key |= ((uint64_t)meshIndex & Utils::BitMask(14)) << 21;
+			key |= Utils::QuantizeDepth(depth, 16) << 5;
+
+			return key;
+		}
+
+		const uint64_t invertedDepth = Utils::BitMask(24) - Utils::QuantizeDepth(depth, 24);
+
+		key |= 1ull << 61;
+		key |= invertedDepth << 37;
+		key |= ((uint64_t)shaderIndex & Utils::BitMask(12)) << 25;
+		key |= ((uint64_t)materialIndex & Utils::BitMask(12)) << 13;
+		key |= ((uint64_t)meshIndex & Utils::BitMask(13));
+
+		return key;
+	}
+
+	uint32_t RenderQueue::GetStateIndex(std::unordered_map<const void*, uint32_t>& indices, const void* state)
+	{
+		auto [it, inserted] = indices.try_emplace(state, (uint32_t)indices.size());
+		return it->second;
+	}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Asset/Asset.h"
+
+#include "Vortex/Math/Math.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Vortex {
+
+	class Shader;
+	class Material;
+	class Submesh;
+	class StaticSubmesh;
+
+	enum class VORTEX_API DrawPass : uint8_t
+	{
+		Geometry = 0,
+	};
+
+	enum class VORTEX_API DrawCommandType : uint8_t
+	{
+		Mesh = 0,
+		StaticMesh,
+	};
+
+	// Everything needed to issue a draw without going back to the registry,
+	// pointers are only valid for the frame the command was submitted in
+	struct VORTEX_API DrawCommand
+	{
+		union
+		{
+			const Submesh* MeshSubmesh = nullptr;
+			const StaticSubmesh* StaticMeshSubmesh;
+		};
+
+		Shader* SubmeshShader = nullptr;
+		Material* SubmeshMaterial = nullptr;
+		AssetHandle MaterialHandle = 0;
+		const Math::mat4* Transform = nullptr;
+		uint32_t EntityID = 0;
+		DrawCommandType Type = DrawCommandType::StaticMesh;
+		bool Animated = false;
+	};
+
+	// Draw keys are packed most significant field first:
+	//
+	// Opaque:      | pass 2 | 0 | shader 12 | material 14 | mesh 14 | depth 16 | unused 5 |
+	// Transparent: | pass 2 | 1 | inverted depth 24 | shader 12 | material 12 | mesh 13 |
+	//
+	// Opaque draws are grouped by state then sorted front to back,
+	// transparent draws are sorted back to front so they blend correctly
+	class VORTEX_API RenderQueue
+	{
+	public:
+		RenderQueue() = default;
+		~RenderQueue() = default;
+
+		void Clear();
+
+		void Submit(uint64_t drawKey, const DrawCommand& command);
+		void Submit(DrawPass pass, bool transparent, float depth, const DrawCommand& command);
+
+		void Sort();
+
+		VX_FORCE_INLINE uint32_t GetDrawCount() const { return (uint32_t)m_SortEntries.size(); }
+		VX_FORCE_INLINE bool IsEmpty() const { return m_SortEntries.empty(); }
+
+		// Only valid after the queue is sorted
+		VX_FORCE_INLINE uint64_t GetDrawKey(uint32_t index) const { return m_SortEntries[index].Key; }
+		VX_FORCE_INLINE const DrawCommand& GetDrawCommand(uint32_t index) const { return m_Commands[m_SortEntries[index].CommandIndex]; }
+
+		static uint64_t CreateDrawKey(DrawPass pass, bool transparent, uint32_t shaderIndex, uint32_t materialIndex, uint32_t meshIndex, float depth);
+
+	private:
+		uint32_t GetStateIndex(std::unordered_map<const void*, uint32_t>& indices, const void* state);
+
+	private:
+		struct SortEntry
+		{
+			uint64_t Key;
+			uint32_t CommandIndex;
+		};
+
+		std::vector<DrawCommand> m_Commands;
+		std::vector<SortEntry> m_SortEntries;
+		std::vector<SortEntry> m_ScratchEntries;
+
+		// Dense per frame indices for render state so they fit in the draw key
+		std::unordered_map<const void*, uint32_t> m_ShaderIndices;
+		std::unordered_map<const void*, uint32_t> m_MaterialIndices;
+		std::unordered_map<const void*, uint32_t> m_MeshIndices;
+	};
+
+}
@@ -30,12 +30,71 @@ namespace Vortex {
 
 		SharedReference<Material> WhiteMaterial = nullptr;
 
+		static constexpr inline uint32_t InitialInstanceCapacity = 1024;
+		SharedReference<VertexBuffer> InstanceBuffer = nullptr;
+		uint32_t InstanceCapacity = 0;
+
 		static constexpr inline uint32_t MaxPointLights = 50;
 		static constexpr inline uint32_t MaxSpotLights = 50;
 		static constexpr inline uint32_t MaxEmissiveMeshes = 50;
 		
 		SceneLightDescription SceneLightDesc{};
 
+		// Storage block binding points, must match the PBR and shadow shaders
+		static constexpr inline uint32_t BonePaletteBinding = 0;
+		static constexpr inline uint32_t SceneLightsBinding = 1;
+
+		// Mirrors the std430 layout of the light structs in the PBR shaders
+		struct PointLightData
+		{
+			Math::vec3 Radiance;
+			float Intensity;
+			Math::vec3 Position;
+			float ShadowBias;
+			float FarPlane;
+			float Padding[3];
+		};
+
+		struct SpotLightData
+		{
+			Math::vec3 Radiance;
+			float Intensity;
+			Math::vec3 Position;
+			float CutOff;
+			Math::vec3 Direction;
+			float OuterCutOff;
+			float ShadowBias;
+			float Padding[3];
+		};
+
+		struct EmissiveMeshData
+		{
+			Math::vec3 Radiance;
+			float Intensity;
+			Math::vec3 Position;
+			float Padding;
+		};
+
+		static_assert(sizeof(PointLightData) == 48, "PointLightData must match the std430 layout!");
+		static_assert(sizeof(SpotLightData) == 64, "SpotLightData must match the std430 layout!");
+		static_assert(sizeof(EmissiveMeshData) == 32, "EmissiveMeshData must match the std430 layout!");
+
+		struct SceneLightsData
+		{
+			PointLightData PointLights[MaxPointLights];
+			SpotLightData SpotLights[MaxSpotLights];
+			EmissiveMeshData EmissiveMeshes[MaxEmissiveMeshes];
+		};
+
+		SceneLightsData SceneLights{};
+		SharedReference<StorageBuffer> SceneLightsBuffer = nullptr;
+
+		static constexpr inline uint32_t InitialBonePaletteCapacity = 1024;
+		SharedReference<StorageBuffer> BonePaletteBuffer = nullptr;
+		uint32_t BonePaletteCapacity = 0;
+		std::vector<Math::mat4> ShadowBonePalette;
+		std::vector<uint32_t> ShadowBoneOffsets;
+
 		SharedReference<Framebuffer> TargetFramebuffer = nullptr;
 
 		SharedReference<HDRFramebuffer> HDRFramebuffer = nullptr;
@@ -78,6 +137,8 @@ namespace Vortex {
 
 	static RendererInternalData s_Data;
 
+	static constexpr uint32_t s_InvalidBoneOffset = std::numeric_limits<uint32_t>::max();
+
 	void Renderer::Init()
 	{
 		VX_PROFILE_FUNCTION();
@@ -121,6 +182,8 @@ namespace Vortex {
 
 		s_Data.SkyboxMesh = StaticMesh::Create(MeshType::Cube);
 
+		s_Data.SceneLightsBuffer = StorageBuffer::Create(sizeof(RendererInternalData::SceneLightsData), RendererInternalData::SceneLightsBinding);
+
 #if VX_ENABLE_RENDER_STATISTICS
 		ResetStats();
 #endif // VX_RENDERER_STATISTICS
@@ -142,6 +205,9 @@ namespace Vortex {
 
 		s_Data.SkyboxMesh.Reset();
 		s_Data.WhiteMaterial.Reset();
+		s_Data.InstanceBuffer.Reset();
+		s_Data.SceneLightsBuffer.Reset();
+		s_Data.BonePaletteBuffer.Reset();
 
 		s_Data.BRDF_LUT.Reset();
 
@@ -207,6 +273,75 @@ namespace Vortex {
 		s_Data.RendererStatistics.DrawCalls++;
 	}
 
+	void Renderer::DrawIndexedInstanced(const SharedReference<Shader>& shader, const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		VX_PROFILE_FUNCTION();
+
+		VX_CORE_ASSERT(s_Data.InstanceBuffer, "Instance data must be set before drawing instanced!");
+		VX_CORE_ASSERT(baseInstance + instanceCount <= s_Data.InstanceCapacity, "Instance range out of bounds!");
+
+		shader->Enable();
+		vertexArray->SetInstanceBuffer(s_Data.InstanceBuffer);
+		vertexArray->Bind();
+		RenderCommand::DrawIndexedInstanced(vertexArray, instanceCount, baseInstance);
+		s_Data.RendererStatistics.DrawCalls++;
+		s_Data.RendererStatistics.InstancedDrawCalls++;
+		s_Data.RendererStatistics.InstanceCount += instanceCount;
+	}
+
+	void Renderer::SetInstanceData(const InstanceData* instances, uint32_t instanceCount)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (instanceCount == 0)
+			return;
+
+		// Grow by powers of two so the buffer (and every vertex array pointing at it) is rarely recreated
+		if (instanceCount > s_Data.InstanceCapacity)
+		{
+			uint32_t capacity = Math::Max(s_Data.InstanceCapacity, RendererInternalData::InitialInstanceCapacity);
+			while (capacity < instanceCount)
+				capacity *= 2;
+
+			s_Data.InstanceBuffer = VertexBuffer::Create(capacity * (uint32_t)sizeof(InstanceData));
+			s_Data.InstanceBuffer->SetLayout({
+				{ ShaderDataType::Mat4, "a_Model",            false, true },
+				{ ShaderDataType::Int,  "a_InstanceEntityID", false, true },
+			});
+
+			s_Data.InstanceCapacity = capacity;
+		}
+
+		s_Data.InstanceBuffer->SetData(instances, instanceCount * (uint32_t)sizeof(InstanceData));
+	}
+
+	void Renderer::SetBonePalette(const Math::mat4* boneMatrices, uint32_t boneCount)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (boneCount == 0)
+			return;
+
+		if (boneCount > s_Data.BonePaletteCapacity)
+		{
+			uint32_t capacity = Math::Max(s_Data.BonePaletteCapacity, RendererInternalData::InitialBonePaletteCapacity);
+			while (capacity < boneCount)
+				capacity *= 2;
+
+			s_Data.BonePaletteBuffer = StorageBuffer::Create(capacity * (uint32_t)sizeof(Math::mat4), RendererInternalData::BonePaletteBinding);
+			s_Data.BonePaletteCapacity = capacity;
+		}
+
+		s_Data.BonePaletteBuffer->SetData(boneMatrices, boneCount * (uint32_t)sizeof(Math::mat4));
+	}
+
+	void Renderer::UploadSceneLights()
+	{
+		VX_PROFILE_FUNCTION();
+
+		s_Data.SceneLightsBuffer->SetData(&s_Data.SceneLights, sizeof(RendererInternalData::SceneLightsData));
+	}
+
 	void Renderer::DrawIndexed(const SharedReference<Shader>& shader, const SharedReference<VertexArray>& vertexArray)
 	{
 		VX_PROFILE_FUNCTION();
@@ -260,21 +395,11 @@ namespace Vortex {
 				if (pointLightIndex > RendererInternalData::MaxPointLights - 1)
 					break;
 
-				for (uint32_t i = 0; i < shaderCount; i++)
-				{
-					SharedReference<Shader> shader = shaders[i];
-
-					if (shader == nullptr)
-					{
-						VX_CORE_ASSERT(false, "invalid shader!");
-						continue;
-					}
-
-					shader->Enable();
-					shader->SetFloat3("u_PointLights[" + std::to_string(pointLightIndex) + "].Radiance", lightSourceComponent.Radiance);
-					shader->SetFloat3("u_PointLights[" + std::to_string(pointLightIndex) + "].Position", transform.Translation);
-					shader->SetFloat("u_PointLights[" + std::to_string(pointLightIndex) + "].Intensity", lightSourceComponent.Intensity);
-				}
+				// Uploaded with the rest of the scene lights before the geometry pass
+				RendererInternalData::PointLightData& pointLight = s_Data.SceneLights.PointLights[pointLightIndex];
+				pointLight.Radiance = lightSourceComponent.Radiance;
+				pointLight.Position = transform.Translation;
+				pointLight.Intensity = lightSourceComponent.Intensity;
 
 				pointLightIndex++;
 
@@ -287,24 +412,13 @@ namespace Vortex {
 				if (spotLightIndex > RendererInternalData::MaxSpotLights - 1)
 					break;
 
-				for (uint32_t i = 0; i < shaderCount; i++)
-				{
-					SharedReference<Shader> shader = shaders[i];
-
-					if (shader == nullptr)
-					{
-						VX_CORE_ASSERT(false, "invalid shader!");
-						continue;
-					}
-
-					shader->Enable();
-					shader->SetFloat3("u_SpotLights[" + std::to_string(spotLightIndex) + "].Radiance", lightSourceComponent.Radiance);
-					shader->SetFloat3("u_SpotLights[" + std::to_string(spotLightIndex) + "].Position", transform.Translation);
-					shader->SetFloat3("u_SpotLights[" + std::to_string(spotLightIndex) + "].Direction", transform.GetRotationEuler());
-					shader->SetFloat("u_SpotLights[" + std::to_string(spotLightIndex) + "].Intensity", lightSourceComponent.Intensity);
-					shader->SetFloat("u_SpotLights[" + std::to_string(spotLightIndex) + "].CutOff", Math::Cos(Math::Deg2Rad(lightSourceComponent.Cutoff)));
-					shader->SetFloat("u_SpotLights[" + std::to_string(spotLightIndex) + "].OuterCutOff", Math::Cos(Math::Deg2Rad(lightSourceComponent.OuterCutoff)));
-				}
+				RendererInternalData::SpotLightData& spotLight = s_Data.SceneLights.SpotLights[spotLightIndex];
+				spotLight.Radiance = lightSourceComponent.Radiance;
+				spotLight.Position = transform.Translation;
+				spotLight.Direction = transform.GetRotationEuler();
+				spotLight.Intensity = lightSourceComponent.Intensity;
+				spotLight.CutOff = Math::Cos(Math::Deg2Rad(lightSourceComponent.Cutoff));
+				spotLight.OuterCutOff = Math::Cos(Math::Deg2Rad(lightSourceComponent.OuterCutoff));
 
 				spotLightIndex++;
 
@@ -315,29 +429,15 @@ namespace Vortex {
 
 	void Renderer::RenderEmissiveMaterial(const Math::vec3& translation, const Math::vec3& radiance, float intensity)
 	{
-		SharedReference<Shader> shaders[] = { s_Data.ShaderLibrary.Get("PBR"), s_Data.ShaderLibrary.Get("PBR_Static") };
-		const uint32_t shaderCount = VX_ARRAYSIZE(shaders);
-
 		uint32_t& emissiveMeshIndex = s_Data.SceneLightDesc.EmissiveMeshIndex;
 
 		if (emissiveMeshIndex > RendererInternalData::MaxEmissiveMeshes - 1)
 			return;
 
-		for (uint32_t i = 0; i < shaderCount; i++)
-		{
-			SharedReference<Shader> shader = shaders[i];
-
-			if (shader == nullptr)
-			{
-				VX_CORE_ASSERT(false, "invalid shader!");
-				continue;
-			}
-
-			shader->Enable();
-			shader->SetFloat3("u_EmissiveMeshes[" + std::to_string(emissiveMeshIndex) + "].Radiance", radiance);
-			shader->SetFloat3("u_EmissiveMeshes[" + std::to_string(emissiveMeshIndex) + "].Position", translation);
-			shader->SetFloat("u_EmissiveMeshes[" + std::to_string(emissiveMeshIndex) + "].Intensity", intensity);
-		}
+		RendererInternalData::EmissiveMeshData& emissiveMesh = s_Data.SceneLights.EmissiveMeshes[emissiveMeshIndex];
+		emissiveMesh.Radiance = radiance;
+		emissiveMesh.Position = translation;
+		emissiveMesh.Intensity = intensity;
 
 		emissiveMeshIndex++;
 	}
@@ -628,7 +728,8 @@ namespace Vortex {
 
 	void Renderer::RenderToDepthMap(SharedReference<Scene>& contextScene)
 	{
-		auto& sceneMeshes = contextScene->GetSceneMeshes();
+		// Shadows are rendered before the scene updates so make sure the cached world transforms are current
+		contextScene->UpdateWorldSpaceTransforms();
 
 		auto lightSourceView = contextScene->GetAllActorsWith<LightSourceComponent>();
 
@@ -652,7 +753,7 @@ namespace Vortex {
 						continue;
 					}
 
-					RenderDirectionalLightShadow(lightSourceComponent, lightSourceEntity, sceneMeshes);
+					RenderDirectionalLightShadow(lightSourceComponent, lightSourceEntity);
 
 					break;
 				}
@@ -663,7 +764,7 @@ namespace Vortex {
 						continue;
 					}
 
-					RenderPointLightShadow(lightSourceComponent, lightSourceEntity, sceneMeshes);
+					RenderPointLightShadow(lightSourceComponent, lightSourceEntity, contextScene->GetSceneMeshes());
 
 					break;
 				}
@@ -674,7 +775,7 @@ namespace Vortex {
 						continue;
 					}
 
-					RenderSpotLightShadow(lightSourceComponent, lightSourceEntity, sceneMeshes);
+					RenderSpotLightShadow(lightSourceComponent, lightSourceEntity, contextScene->GetSceneMeshes());
 
 					break;
 				}
@@ -803,17 +904,20 @@ namespace Vortex {
 		s_Data.SceneLightDesc.EmissiveMeshIndex = 0;
 	}
 
-	void Renderer::RenderDirectionalLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity, SharedReference<SceneGeometry>& sceneMeshes)
+	void Renderer::RenderDirectionalLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity)
 	{
 		SharedReference<Shader> shadowMapShader = s_Data.ShaderLibrary.Get("SkyLightShadowMap");
 
+		Scene* contextScene = lightSourceEntity.GetContextScene();
+		Math::Frustum lightFrustum;
+
 		// Configure shader
 		{
 			const Math::mat4 orthogonalProjection = Math::OrthographicProjection(-75.0f, 75.0f, -75.0f, 75.0f, 0.01f, 500.0f);
-			Scene* contextScene = lightSourceEntity.GetContextScene();
 			const TransformComponent transform = contextScene->GetWorldSpaceTransform(lightSourceEntity);
 			const Math::mat4 lightView = Math::LookAt(transform.Translation, Math::Normalize(transform.GetRotationEuler()), Math::vec3(0.0f, 1.0f, 0.0f));
 			const Math::mat4 lightProjection = orthogonalProjection * lightView;
+			lightFrustum = Math::Frustum(lightProjection);
 
 			RenderCommand::SetCullMode(RendererAPI::TriangleCullMode::Front);
 
@@ -836,29 +940,51 @@ namespace Vortex {
 			s_Data.SkylightDepthMapFramebuffer->ClearDepthAttachment();
 		}
 
+		// Only casters inside the light's view volume are drawn
+		SharedReference<SceneGeometry>& sceneMeshes = contextScene->GetSceneMeshes(lightFrustum);
+
+		const ShaderUniformHandle modelHandle = shadowMapShader->GetUniformHandle("u_Model");
+		const ShaderUniformHandle hasAnimationsHandle = shadowMapShader->GetUniformHandle("u_HasAnimations");
+		const ShaderUniformHandle boneOffsetHandle = shadowMapShader->GetUniformHandle("u_BoneOffset");
+
+		// Gather every caster's bones so the palette is uploaded with one write
+		std::vector<Math::mat4>& bonePalette = s_Data.ShadowBonePalette;
+		std::vector<uint32_t>& boneOffsets = s_Data.ShadowBoneOffsets;
+		bonePalette.clear();
+		boneOffsets.assign(sceneMeshes->Meshes.size(), s_InvalidBoneOffset);
+
 		uint32_t i = 0;
 
-		// Render Meshes
 		for (const auto& mesh : sceneMeshes->Meshes)
 		{
-			Math::mat4 worldSpaceTransform = sceneMeshes->WorldSpaceMeshTransforms[i];
-			shadowMapShader->SetMat4("u_Model", worldSpaceTransform);
-
 			if (mesh->HasAnimations() && sceneMeshes->MeshEntities[i].HasComponent<AnimatorComponent>())
 			{
-				shadowMapShader->SetBool("u_HasAnimations", true);
-
 				const AnimatorComponent& animatorComponent = sceneMeshes->MeshEntities[i].GetComponent<AnimatorComponent>();
 				const std::vector<Math::mat4>& transforms = animatorComponent.Animator->GetFinalBoneMatrices();
 
-				for (uint32_t c = 0; c < transforms.size(); c++)
-				{
-					shadowMapShader->SetMat4("u_FinalBoneMatrices[" + std::to_string(c) + "]", transforms[c]);
-				}
+				boneOffsets[i] = (uint32_t)bonePalette.size();
+				bonePalette.insert(bonePalette.end(), transforms.begin(), transforms.end());
 			}
-			else
+
+			i++;
+		}
+
+		SetBonePalette(bonePalette.data(), (uint32_t)bonePalette.size());
+
+		i = 0;
+
+		// Render Meshes
+		for (const auto& mesh : sceneMeshes->Meshes)
+		{
+			Math::mat4 worldSpaceTransform = sceneMeshes->WorldSpaceMeshTransforms[i];
+			shadowMapShader->SetMat4(modelHandle, worldSpaceTransform);
+
+			const bool animated = boneOffsets[i] != s_InvalidBoneOffset;
+			shadowMapShader->SetBool(hasAnimationsHandle, animated);
+
+			if (animated)
 			{
-				shadowMapShader->SetBool("u_HasAnimations", false);
+				shadowMapShader->SetInt(boneOffsetHandle, (int)boneOffsets[i]);
 			}
 
 			const Submesh& submesh = mesh->GetSubmesh();
@@ -874,7 +1000,7 @@ namespace Vortex {
 		for (const auto& staticMesh : sceneMeshes->StaticMeshes)
 		{
 			Math::mat4 worldSpaceTransform = sceneMeshes->WorldSpaceStaticMeshTransforms[i++];
-			shadowMapShader->SetMat4("u_Model", worldSpaceTransform);
+			shadowMapShader->SetMat4(modelHandle, worldSpaceTransform);
 
 			const auto& submeshes = staticMesh->GetSubmeshes();
 
@@ -1157,6 +1283,18 @@ namespace Vortex {
 		s_Data.RendererStatistics.DrawCalls += drawCalls;
 	}
 
+	void Renderer::AddToCullingStats(uint32_t visibleMeshes, uint32_t culledMeshes)
+	{
+		s_Data.RendererStatistics.VisibleMeshes += visibleMeshes;
+		s_Data.RendererStatistics.CulledMeshes += culledMeshes;
+	}
+
+	void Renderer::AddToShadowCullingStats(uint32_t visibleShadowCasters, uint32_t culledShadowCasters)
+	{
+		s_Data.RendererStatistics.VisibleShadowCasters += visibleShadowCasters;
+		s_Data.RendererStatistics.CulledShadowCasters += culledShadowCasters;
+	}
+
 	void Renderer::SetProperties(const ProjectProperties::RendererProperties& props)
 	{
 		Renderer2D::SetLineWidth(props.LineWidth);
@@ -10,6 +10,7 @@
 #include "Vortex/Renderer/Camera.h"
 #include "Vortex/Renderer/RendererAPI.h"
 #include "Vortex/Renderer/RenderCommand.h"
+#include "Vortex/Renderer/VertexTypes.h"
 
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
@@ -82,6 +83,16 @@ namespace Vortex {
 
 		static void Submit(const SharedReference<Shader>& shader, const SharedReference<VertexArray>& vertexArray);
 		static void DrawIndexed(const SharedReference<Shader>& shader, const SharedReference<VertexArray>& vertexArray);
+		static void DrawIndexedInstanced(const SharedReference<Shader>& shader, const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance);
+
+		// Uploads the instances for this frame, draws index into them with a base instance
+		static void SetInstanceData(const InstanceData* instances, uint32_t instanceCount);
+
+		// Skinned draws index the palette with u_BoneOffset
+		static void SetBonePalette(const Math::mat4* boneMatrices, uint32_t boneCount);
+
+		// Point, spot and emissive lights are gathered on the CPU and uploaded with a single write
+		static void UploadSceneLights();
 
 		static void RenderLightSource(const TransformComponent& transform, const LightSourceComponent& lightSourceComponent);
 		static void RenderEmissiveMaterial(const Math::vec3& translation, const Math::vec3& radiance, float intensity);
@@ -118,6 +129,8 @@ namespace Vortex {
 		static void ResetRenderTime();
 		static void AddToQuadCountStats(uint32_t quadCount);
 		static void AddToDrawCallCountStats(uint32_t drawCalls);
+		static void AddToCullingStats(uint32_t visibleMeshes, uint32_t culledMeshes);
+		static void AddToShadowCullingStats(uint32_t visibleShadowCasters, uint32_t culledShadowCasters);
 
 		static void SetProperties(const ProjectProperties::RendererProperties& props);
 
@@ -177,7 +190,7 @@ namespace Vortex {
 		static void BindRenderTarget(SharedReference<Framebuffer> renderTarget);
 		static void BindShaders(const Math::mat4& view, const Math::mat4& projection, const Math::vec3& cameraTranslation);
 
-		static void RenderDirectionalLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity, SharedReference<SceneGeometry>& sceneMeshes);
+		static void RenderDirectionalLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity);
 		static void RenderPointLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity, SharedReference<SceneGeometry>& sceneMeshes);
 		static void RenderSpotLightShadow(const LightSourceComponent& lightSourceComponent, Actor lightSourceEntity, SharedReference<SceneGeometry>& sceneMeshes);
 
@@ -23,6 +23,16 @@ namespace Vortex {
 		uint32_t QuadCount;
 		uint32_t LineCount;
 
+		// Instancing
+		uint32_t InstancedDrawCalls;
+		uint32_t InstanceCount;
+
+		// Frustum culling
+		uint32_t VisibleMeshes;
+		uint32_t CulledMeshes;
+		uint32_t VisibleShadowCasters;
+		uint32_t CulledShadowCasters;
+
 		uint32_t GetTriangleCount() const { return QuadCount * 2; }
 		uint32_t GetVertexCount() const { return (QuadCount * VERTICES_PER_QUAD) + (LineCount * 2); }
 		uint32_t GetIndexCount() const { return QuadCount * INDICES_PER_QUAD + (LineCount * 2); }
@@ -99,6 +109,7 @@ namespace Vortex {
 
 		virtual void DrawTriangles(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount) const = 0;
 		virtual void DrawIndexed(const SharedReference<VertexArray>& vertexArray, uint32_t indexCount = 0) const = 0;
+		virtual void DrawIndexedInstanced(const SharedReference<VertexArray>& vertexArray, uint32_t instanceCount, uint32_t baseInstance = 0) const = 0;
 		virtual void DrawLines(const SharedReference<VertexArray>& vertexArray, uint32_t vertexCount) const = 0;
 		virtual void DrawTriangleStrip(const SharedReference<VertexArray>& vertexArray, uint32_t indexCount) const = 0;
 
@@ -14,6 +14,15 @@
 
 namespace Vortex {
 
+	// Pre-resolved uniform location so hot paths don't build and hash names on every set,
+	// only valid for the shader it was resolved from and until that shader is reloaded
+	struct VORTEX_API ShaderUniformHandle
+	{
+		int32_t Location = -1;
+
+		VX_FORCE_INLINE bool IsValid() const { return Location != -1; }
+	};
+
 	class VORTEX_API Shader : public RefCounted
 	{
 	public:
@@ -36,6 +45,14 @@ namespace Vortex {
 		virtual void SetFloat3(const std::string& name, const Math::vec3& vector) const = 0;
 		virtual void SetFloat4(const std::string& name, const Math::vec4& vector) const = 0;
 
+		virtual ShaderUniformHandle GetUniformHandle(const std::string& name) const = 0;
+
+		virtual void SetBool(ShaderUniformHandle handle, bool value) const = 0;
+		virtual void SetInt(ShaderUniformHandle handle, int value) const = 0;
+		virtual void SetFloat(ShaderUniformHandle handle, float value) const = 0;
+		virtual void SetFloat3(ShaderUniformHandle handle, const Math::vec3& vector) const = 0;
+		virtual void SetMat4(ShaderUniformHandle handle, const Math::mat4& matrix) const = 0;
+
 		virtual void Reload() = 0;
 
 		virtual const std::string& GetName() const = 0;
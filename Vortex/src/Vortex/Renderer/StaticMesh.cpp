@@ -7,6 +7,7 @@
 
 #include "Vortex/Renderer/Texture.h"
 #include "Vortex/Renderer/Renderer.h"
+#include "Vortex/Renderer/MeshCache.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -31,6 +32,10 @@ namespace Vortex {
 	{
 		static void Initialize()
 		{
+			// Imports run on job workers, only the first one may create the logger
+			static std::mutex s_InitializeMutex;
+			std::scoped_lock<std::mutex> lock(s_InitializeMutex);
+
 			if (Assimp::DefaultLogger::isNullLogger())
 			{
 				Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE);
@@ -46,6 +51,13 @@ namespace Vortex {
 
 	StaticSubmesh::StaticSubmesh(const std::string& name, const std::vector<StaticVertex>& vertices, const std::vector<uint32_t>& indices)
 		: m_MeshName(name), m_Vertices(vertices), m_Indices(indices)
+	{
+		CreateAndUploadMesh();
+		CreateBoundingBoxFromVertices();
+	}
+
+	StaticSubmesh::StaticSubmesh(const std::string& name, const std::vector<StaticVertex>& vertices, const std::vector<uint32_t>& indices, const Math::AABB& boundingBox)
+		: m_MeshName(name), m_Vertices(vertices), m_Indices(indices), m_BoundingBox(boundingBox)
 	{
 		CreateAndUploadMesh();
 	}
@@ -121,16 +133,12 @@ namespace Vortex {
 			{ ShaderDataType::Float3, "a_Tangent"     },
 			{ ShaderDataType::Float3, "a_BiTangent"   },
 			{ ShaderDataType::Float2, "a_TexCoord"    },
-			{ ShaderDataType::Float2, "a_TexScale"    },
-			{ ShaderDataType::Int,    "a_EntityID"    },
 		});
 
 		m_VertexArray->AddVertexBuffer(m_VertexBuffer);
 
 		m_IndexBuffer = IndexBuffer::Create(m_Indices.data(), m_Indices.size());
 		m_VertexArray->SetIndexBuffer(m_IndexBuffer);
-
-		CreateBoundingBoxFromVertices();
 	}
 
 	void StaticSubmesh::CreateBoundingBoxFromVertices()
@@ -156,24 +164,17 @@ namespace Vortex {
 		}
 	}
 
-	void StaticSubmesh::Render(AssetHandle materialHandle) const
+	void StaticSubmesh::RenderInstanced(Material* material, uint32_t instanceCount, uint32_t baseInstance) const
 	{
-		VX_CORE_ASSERT(AssetManager::IsHandleValid(materialHandle), "Invalid Material!");
-
-		SharedReference<Material> material = AssetManager::GetAsset<Material>(materialHandle);
-		if (material == nullptr)
-		{
-			VX_CORE_ASSERT(false, "Invalid Material!");
-			return;
-		}
+		VX_CORE_ASSERT(material, "Invalid Material!");
 
 		SharedReference<Shader> shader = material->GetShader();
 		material->Bind();
 
-		Renderer::DrawIndexed(shader, m_VertexArray);
+		Renderer::DrawIndexedInstanced(shader, m_VertexArray, instanceCount, baseInstance);
 
 		uint32_t triangleCount = m_IndexBuffer->GetCount() / 3;
-		Renderer::AddToQuadCountStats(triangleCount / 2);
+		Renderer::AddToQuadCountStats((triangleCount / 2) * instanceCount);
 	}
 
 	void StaticSubmesh::RenderToSkylightShadowMap() const
@@ -183,55 +184,111 @@ namespace Vortex {
 		Renderer::DrawIndexed(shader, m_VertexArray);
 	}
 
-	StaticMesh::StaticMesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID)
+	StaticMesh::StaticMesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions)
 		: m_ImportOptions(importOptions)
 	{
-		LogStream::Initialize();
+		StaticMeshData meshData;
+		if (!LoadMeshData(filepath, importOptions, meshData))
+		{
+			return;
+		}
+
+		CreateFromMeshData(filepath, meshData);
+	}
+
+	StaticMesh::StaticMesh(const std::string& filepath, const MeshImportOptions& importOptions, const StaticMeshData& meshData)
+		: m_ImportOptions(importOptions)
+	{
+		CreateFromMeshData(filepath, meshData);
+	}
+
+	StaticMesh::StaticMesh(MeshType meshType)
+	{
+		// Create cube from vertices
+		m_Submeshes[0] = StaticSubmesh(true);
+	}
+
+	bool StaticMesh::LoadMeshData(const std::string& filepath, const MeshImportOptions& importOptions, StaticMeshData& outData)
+	{
+		VX_PROFILE_FUNCTION();
 
 		VX_CORE_INFO_TAG("Mesh", "Loading Mesh: {}", filepath.c_str());
 
-		Assimp::Importer importer;
-		const aiScene* scene = importer.ReadFile(filepath, s_MeshImportFlags);
+		const uint64_t cacheKey = MeshCache::GetCacheKey(filepath, importOptions, MeshCacheType::StaticMesh);
 
-		if (!scene || !scene->HasMeshes())
+		if (MeshCache::TryLoad(filepath, cacheKey, outData))
+		{
+			return true;
+		}
+
+		if (!Import(filepath, importOptions, outData))
+		{
+			return false;
+		}
+
+		MeshCache::Write(cacheKey, outData);
+
+		return true;
+	}
+
+	void StaticMesh::CreateFromMeshData(const std::string& filepath, const StaticMeshData& meshData)
+	{
+		if (meshData.Submeshes.empty())
 		{
-			VX_CORE_ERROR_TAG("Mesh", "Failed to load Mesh from: {}", filepath.c_str());
 			return;
 		}
 
-		m_Scene = scene;
+		const Fs::Path directory = FileSystem::GetParentDirectory(filepath);
+
+		for (const MeshSubmeshData<StaticVertex>& submeshData : meshData.Submeshes)
+		{
+			ResolveMaterial(submeshData.Index, directory, submeshData.Material);
+			m_Submeshes[submeshData.Index] = StaticSubmesh(submeshData.Name, submeshData.Vertices, submeshData.Indices, submeshData.BoundingBox);
+		}
 
-		uint32_t submeshIndex = 0;
-		ProcessNode(submeshIndex, filepath, m_Scene->mRootNode, m_Scene, importOptions, entityID);
 		CreateBoundingBoxFromSubmeshes();
 
 		m_IsLoaded = true;
 	}
 
-	StaticMesh::StaticMesh(MeshType meshType)
+	bool StaticMesh::Import(const std::string& filepath, const MeshImportOptions& importOptions, StaticMeshData& outData)
 	{
-		// Create cube from vertices
-		m_Submeshes[0] = StaticSubmesh(true);
+		VX_PROFILE_FUNCTION();
+
+		LogStream::Initialize();
+
+		Assimp::Importer importer;
+		const aiScene* scene = importer.ReadFile(filepath, s_MeshImportFlags);
+
+		if (!scene || !scene->HasMeshes())
+		{
+			VX_CORE_ERROR_TAG("Mesh", "Failed to load Mesh from: {}", filepath.c_str());
+			return false;
+		}
+
+		uint32_t submeshIndex = 0;
+		ProcessNode(submeshIndex, filepath, scene->mRootNode, scene, importOptions, outData);
+
+		return true;
 	}
 
-	void StaticMesh::ProcessNode(uint32_t& submeshIndex, const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID)
+	void StaticMesh::ProcessNode(uint32_t& submeshIndex, const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, StaticMeshData& outData)
 	{
 		// process all node meshes
 		for (uint32_t i = 0; i < node->mNumMeshes; i++)
 		{
 			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			uint32_t currentSubmesh = submeshIndex;
-			m_Submeshes[currentSubmesh] = ProcessMesh(submeshIndex, filepath, mesh, scene, importOptions, entityID);
+			outData.Submeshes.push_back(ProcessMesh(submeshIndex, filepath, mesh, scene, importOptions));
 		}
 
 		// do the same for children nodes
 		for (uint32_t i = 0; i < node->mNumChildren; i++)
 		{
-			ProcessNode(submeshIndex, filepath, node->mChildren[i], scene, importOptions, entityID);
+			ProcessNode(submeshIndex, filepath, node->mChildren[i], scene, importOptions, outData);
 		}
 	}
 
-	StaticSubmesh StaticMesh::ProcessMesh(uint32_t& submeshIndex, const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID)
+	MeshSubmeshData<StaticVertex> StaticMesh::ProcessMesh(uint32_t& submeshIndex, const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions)
 	{
 		std::vector<StaticVertex> vertices;
 		std::vector<uint32_t> indices;
@@ -254,8 +311,6 @@ namespace Vortex {
 
 			ProcessVertex(mesh, vertex, transform, i);
 
-			vertex.EntityID = entityID;
-			
 			vertices.push_back(vertex);
 		}
 
@@ -270,72 +325,94 @@ namespace Vortex {
 			}
 		}
 
-		std::vector<AssetHandle> materialTextures =
-		{
-			0, 0, 0, 0, 0, 0,
-		};
+		MeshSubmeshData<StaticVertex> submeshData;
+		submeshData.Index = submeshIndex;
+		submeshData.Name = submeshName;
 
 		// process materials
 		if (mesh->mMaterialIndex >= 0)
 		{
 			aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
 
-#ifndef VX_DIST
-
-			m_MaterialNames[submeshIndex] = std::string(material->GetName().C_Str());
-			if (m_MaterialNames[submeshIndex].empty())
-				m_MaterialNames[submeshIndex] = submeshName;
-			if (m_MaterialNames[submeshIndex].size() > 25)
-				m_MaterialNames[submeshIndex].erase(25, m_MaterialNames[submeshIndex].size() - 25);
+			MeshMaterialBinding& binding = submeshData.Material;
+			binding.Name = std::string(material->GetName().C_Str());
+			if (binding.Name.empty())
+				binding.Name = submeshName;
+			if (binding.Name.size() > 25)
+				binding.Name.erase(25, binding.Name.size() - 25);
 
-#endif
-
-			const std::string directory = FileSystem::GetParentDirectory(filepath).string();
-
-			materialTextures = 
+			binding.TextureFilepaths =
 			{
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_DIFFUSE, 0),
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_NORMALS, 0),
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_METALNESS, 0),
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_REFLECTION, 0),
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_EMISSIVE, 0),
-				GetMaterialTexture(material, directory, (uint32_t)aiTextureType_AMBIENT_OCCLUSION, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_DIFFUSE, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_NORMALS, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_METALNESS, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_REFLECTION, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_EMISSIVE, 0),
+				GetMaterialTextureFilepath(material, (uint32_t)aiTextureType_AMBIENT_OCCLUSION, 0),
 			};
+			binding.IsValid = true;
 		}
 
+		submeshData.Vertices = std::move(vertices);
+		submeshData.Indices = std::move(indices);
+		submeshData.CalculateBoundingBox();
+
+		submeshIndex++;
+
+		return submeshData;
+	}
+
+	void StaticMesh::ResolveMaterial(uint32_t submeshIndex, const Fs::Path& directory, const MeshMaterialBinding& binding)
+	{
+		const std::string& materialName = binding.Name;
+
+#ifndef VX_DIST
+
+		m_MaterialNames[submeshIndex] = materialName;
+
+#endif
+
 		// Get or Create Material
-		AssetHandle materialHandle = 0;
-		const std::string materialName = m_MaterialNames[submeshIndex];
-		const std::string filename = materialName + ".vmaterial";;
-		const AssetMetadata& metadata = Project::GetEditorAssetManager()->GetMetadata("Materials/" + filename);
+		const std::string filename = materialName + ".vmaterial";
+		const AssetHandle existingMaterialHandle = Project::GetAssetManager()->GetAssetHandleFromFilepath("Materials/" + filename);
 
-		if (AssetManager::IsHandleValid(metadata.Handle))
+		if (AssetManager::IsHandleValid(existingMaterialHandle))
 		{
-			materialHandle = metadata.Handle;
-			m_MaterialHandles[submeshIndex] = metadata.Handle;
+			m_MaterialHandles[submeshIndex] = existingMaterialHandle;
+			return;
 		}
-		else
+
+		auto GetTextureHandle = [&directory, &binding](MeshMaterialTexture texture) -> AssetHandle
 		{
-			// Create new asset
-			MaterialProperties materialProps;
-			materialProps.Textures["u_AlbedoMap"] = materialTextures[0];
-			materialProps.Textures["u_NormalMap"] = materialTextures[1];
-			materialProps.Textures["u_MetallicMap"] = materialTextures[2];
-			materialProps.Textures["u_RoughnessMap"] = materialTextures[3];
-			materialProps.Textures["u_EmissionMap"] = materialTextures[4];
-			materialProps.Textures["u_AmbientOcclusionMap"] = materialTextures[5];
-
-			SharedReference<Shader> shader = Renderer::GetShaderLibrary().Get("PBR_Static");
-			SharedReference<Material> material = Project::GetEditorAssetManager()->CreateNewAsset<Material>("Materials", filename, shader, materialProps);
-			VX_CORE_ASSERT(AssetManager::IsHandleValid(material->Handle), "Invalid asset handle!");
-			
+			return GetMaterialTexture(directory, binding.TextureFilepaths[(size_t)texture]);
+		};
+
+		// Create new asset
+		MaterialProperties materialProps;
+		materialProps.Textures["u_AlbedoMap"] = GetTextureHandle(MeshMaterialTexture::Albedo);
+		materialProps.Textures["u_NormalMap"] = GetTextureHandle(MeshMaterialTexture::Normal);
+		materialProps.Textures["u_MetallicMap"] = GetTextureHandle(MeshMaterialTexture::Metallic);
+		materialProps.Textures["u_RoughnessMap"] = GetTextureHandle(MeshMaterialTexture::Roughness);
+		materialProps.Textures["u_EmissionMap"] = GetTextureHandle(MeshMaterialTexture::Emission);
+		materialProps.Textures["u_AmbientOcclusionMap"] = GetTextureHandle(MeshMaterialTexture::AmbientOcclusion);
+
+		SharedReference<Shader> shader = Renderer::GetShaderLibrary().Get("PBR_Static");
+
+		// Packed runtime builds can't write new assets, the material only lives as long as the session there
+		EditorAssetManager* editorAssetManager = dynamic_cast<EditorAssetManager*>(Project::GetAssetManager().Raw());
+		if (!editorAssetManager)
+		{
+			SharedReference<Material> material = Material::Create(shader, materialProps);
 			material->SetName(materialName);
-			m_InitialMaterialHandles[submeshIndex] = material->Handle;
+			m_InitialMaterialHandles[submeshIndex] = AssetManager::AddMemoryOnlyAsset(material);
+			return;
 		}
 
-		submeshIndex++;
+		SharedReference<Material> material = editorAssetManager->CreateNewAsset<Material>("Materials", filename, shader, materialProps);
+		VX_CORE_ASSERT(AssetManager::IsHandleValid(material->Handle), "Invalid asset handle!");
 
-		return { submeshName, vertices, indices };
+		material->SetName(materialName);
+		m_InitialMaterialHandles[submeshIndex] = material->Handle;
 	}
 
 	void StaticMesh::ProcessVertex(aiMesh* mesh, StaticVertex& vertex, const Math::mat4& transform, uint32_t index)
@@ -370,8 +447,6 @@ namespace Vortex {
 			vertex.BiTangent = Math::vec3(transform * Math::vec4(Math::vec3{ mesh->mBitangents[index].x, mesh->mBitangents[index].y, mesh->mBitangents[index].z }, 1.0f));
 		}
 
-		vertex.TexScale = Math::vec2(1.0f);
-
 		vertex.TexCoord = Math::vec2(0.0f);
 		// does it contain texture coords?
 		if (mesh->mTextureCoords[0])
@@ -380,24 +455,34 @@ namespace Vortex {
 		}
 	}
 
-	AssetHandle StaticMesh::GetMaterialTexture(aiMaterial* material, const Fs::Path& directory, uint32_t textureType, uint32_t index)
+	std::string StaticMesh::GetMaterialTextureFilepath(aiMaterial* material, uint32_t textureType, uint32_t index)
 	{
-		AssetHandle result = 0;
 		aiString textureFilepath;
 
 		if (material->GetTexture((aiTextureType)textureType, index, &textureFilepath) != AI_SUCCESS)
+		{
+			return "";
+		}
+
+		return std::string(textureFilepath.C_Str());
+	}
+
+	AssetHandle StaticMesh::GetMaterialTexture(const Fs::Path& directory, const std::string& textureFilepath)
+	{
+		AssetHandle result = 0;
+
+		if (textureFilepath.empty())
 		{
 			return result;
 		}
 
-		const char* pathCStr = textureFilepath.C_Str();
-		const Fs::Path filepath = Fs::Path(pathCStr).filename();
+		const Fs::Path filepath = Fs::Path(textureFilepath).filename();
 		const Fs::Path relativePath = directory / filepath;
 		const Fs::Path directoryName = directory.filename();
 
 		if (FileSystem::Exists(relativePath))
 		{
-			result = Project::GetEditorAssetManager()->GetAssetHandleFromFilepath(relativePath);
+			result = Project::GetAssetManager()->GetAssetHandleFromFilepath(relativePath);
 		}
 
 		if (!AssetManager::IsHandleValid(result))
@@ -405,7 +490,7 @@ namespace Vortex {
 			const Fs::Path texturesPath = "Assets/Textures" / filepath;
 			if (FileSystem::Exists(texturesPath))
 			{
-				result = Project::GetEditorAssetManager()->GetAssetHandleFromFilepath(texturesPath);
+				result = Project::GetAssetManager()->GetAssetHandleFromFilepath(texturesPath);
 			}
 
 			if (!AssetManager::IsHandleValid(result))
@@ -413,7 +498,7 @@ namespace Vortex {
 				const Fs::Path texturesPathWithDirectory = "Assets/Textures" / directoryName / filepath;
 				if (FileSystem::Exists(texturesPathWithDirectory))
 				{
-					result = Project::GetEditorAssetManager()->GetAssetHandleFromFilepath(texturesPathWithDirectory);
+					result = Project::GetAssetManager()->GetAssetHandleFromFilepath(texturesPathWithDirectory);
 				}
 			}
 		}
@@ -445,47 +530,6 @@ namespace Vortex {
 		}
 	}
 
-	void StaticMesh::OnUpdate(const SharedReference<MaterialTable>& materialTable, int entityID)
-	{
-		bool dirty = false;
-
-		for (auto& [submeshIndex, submesh] : m_Submeshes)
-		{
-			VX_CORE_ASSERT(materialTable->HasMaterial(submeshIndex), "Material Table not synchronized with component!");
-
-			AssetHandle materialHandle = materialTable->GetMaterial(submeshIndex);
-			if (!AssetManager::IsHandleValid(materialHandle))
-				continue;
-
-			SharedReference<Material> material = AssetManager::GetAsset<Material>(materialHandle);
-			if (material == nullptr)
-				continue;
-
-			std::vector<StaticVertex>& vertices = submesh.GetVertices();
-
-			const size_t dataSize = vertices.size();
-			for (uint32_t i = 0; i < dataSize; i++)
-			{
-				StaticVertex& vertex = vertices[i];
-
-				const bool uvChanged = vertex.TexScale != material->GetUV();
-				const bool entityIDChanged = vertex.EntityID != entityID;
-				dirty = (uvChanged || entityIDChanged);
-				if (!dirty)
-					continue;
-
-				vertex.TexScale = material->GetUV();
-				vertex.EntityID = entityID;
-			}
-
-			if (!dirty)
-				continue;
-
-			SharedReference<VertexBuffer> vertexBuffer = submesh.GetVertexBuffer();
-			vertexBuffer->SetData(vertices.data(), vertices.size() * sizeof(StaticVertex));
-		}
-	}
-
 	void StaticMesh::LoadMaterialTable(SharedReference<MaterialTable>& materialTable)
 	{
 		uint32_t currentSubmeshIndex = 0;
@@ -553,9 +597,14 @@ namespace Vortex {
 		return m_Submeshes[index];
 	}
 
-	SharedReference<StaticMesh> StaticMesh::Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID)
+	SharedReference<StaticMesh> StaticMesh::Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions)
+	{
+		return SharedReference<StaticMesh>::Create(filepath, transform, importOptions);
+	}
+
+	SharedReference<StaticMesh> StaticMesh::Create(const std::string& filepath, const MeshImportOptions& importOptions, const StaticMeshData& meshData)
 	{
-		return SharedReference<StaticMesh>::Create(filepath, transform, importOptions, (int)(entt::entity)entityID);
+		return SharedReference<StaticMesh>::Create(filepath, importOptions, meshData);
 	}
 
 	// TODO put this in meshFactory
@@ -14,6 +14,7 @@
 #include "Vortex/Renderer/Shader.h"
 #include "Vortex/Renderer/Buffer.h"
 #include "Vortex/Renderer/MeshImportOptions.h"
+#include "Vortex/Renderer/MeshCache.h"
 #include "Vortex/Renderer/VertexTypes.h"
 
 #include "Vortex/Utils/FileSystem.h"
@@ -33,19 +34,20 @@ namespace Vortex {
 	public:
 		StaticSubmesh() = default;
 		StaticSubmesh(const std::string& name, const std::vector<StaticVertex>& vertices, const std::vector<uint32_t>& indices);
+		// The bounding box was computed when the mesh was first imported
+		StaticSubmesh(const std::string& name, const std::vector<StaticVertex>& vertices, const std::vector<uint32_t>& indices, const Math::AABB& boundingBox);
 		StaticSubmesh(bool skybox);
 		~StaticSubmesh() = default;
 
 		VX_FORCE_INLINE const std::string& GetName() const { return m_MeshName; }
 
-		void Render(AssetHandle materialHandle) const;
+		void RenderInstanced(Material* material, uint32_t instanceCount, uint32_t baseInstance) const;
 		void RenderToSkylightShadowMap() const;
 
 		VX_FORCE_INLINE const SharedReference<VertexArray>& GetVertexArray() const { return m_VertexArray; }
 		VX_FORCE_INLINE const SharedReference<VertexBuffer>& GetVertexBuffer() const { return m_VertexBuffer; }
 		
 		const std::vector<StaticVertex>& GetVertices() const { return m_Vertices; }
-		std::vector<StaticVertex>& GetVertices() { return m_Vertices; }
 
 		const std::vector<uint32_t> GetIndices() const { return m_Indices; }
 
@@ -71,12 +73,12 @@ namespace Vortex {
 	{
 	public:
 		StaticMesh() = default;
-		StaticMesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions, int entityID);
+		StaticMesh(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions);
+		// Creates the GPU buffers and materials for data that was already imported with LoadMeshData
+		StaticMesh(const std::string& filepath, const MeshImportOptions& importOptions, const StaticMeshData& meshData);
 		StaticMesh(MeshType meshType);
 		~StaticMesh() override = default;
 
-		void OnUpdate(const SharedReference<MaterialTable>& materialTable, int entityID = -1);
-
 		void LoadMaterialTable(SharedReference<MaterialTable>& materialTable);
 
 		bool HasSubmesh(uint32_t index) const;
@@ -91,14 +93,23 @@ namespace Vortex {
 
 		ASSET_CLASS_TYPE(StaticMeshAsset)
 
-		static SharedReference<StaticMesh> Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions = MeshImportOptions(), int entityID = -1);
+		static SharedReference<StaticMesh> Create(const std::string& filepath, const TransformComponent& transform, const MeshImportOptions& importOptions = MeshImportOptions());
+		static SharedReference<StaticMesh> Create(const std::string& filepath, const MeshImportOptions& importOptions, const StaticMeshData& meshData);
 		static SharedReference<StaticMesh> Create(MeshType meshType);
 
+		// Reads the mesh cache or runs the import, only touches the CPU so it can run on any thread
+		static bool LoadMeshData(const std::string& filepath, const MeshImportOptions& importOptions, StaticMeshData& outData);
+
 	private:
-		void ProcessNode(uint32_t& submeshIndex, const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID);
-		StaticSubmesh ProcessMesh(uint32_t& submeshIndex, const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions, const int entityID);
-		void ProcessVertex(aiMesh* mesh, StaticVertex& vertex, const Math::mat4& transform, uint32_t index);
-		AssetHandle GetMaterialTexture(aiMaterial* material, const Fs::Path& directory, uint32_t textureType, uint32_t index);
+		void CreateFromMeshData(const std::string& filepath, const StaticMeshData& meshData);
+
+		static bool Import(const std::string& filepath, const MeshImportOptions& importOptions, StaticMeshData& outData);
+		static void ProcessNode(uint32_t& submeshIndex, const std::string& filepath, aiNode* node, const aiScene* scene, const MeshImportOptions& importOptions, StaticMeshData& outData);
+		static MeshSubmeshData<StaticVertex> ProcessMesh(uint32_t& submeshIndex, const std::string& filepath, aiMesh* mesh, const aiScene* scene, const MeshImportOptions& importOptions);
+		static void ProcessVertex(aiMesh* mesh, StaticVertex& vertex, const Math::mat4& transform, uint32_t index);
+		static std::string GetMaterialTextureFilepath(aiMaterial* material, uint32_t textureType, uint32_t index);
+		static AssetHandle GetMaterialTexture(const Fs::Path& directory, const std::string& textureFilepath);
+		void ResolveMaterial(uint32_t submeshIndex, const Fs::Path& directory, const MeshMaterialBinding& binding);
 
 		void CreateBoundingBoxFromSubmeshes();
 
@@ -114,7 +125,6 @@ namespace Vortex {
 #endif
 
 		MeshImportOptions m_ImportOptions;
-		const aiScene* m_Scene;
 
 		Math::AABB m_BoundingBox;
 
@@ -1,9 +1,21 @@
 #include "vxpch.h"
 #include "Texture.h"
 
+#include "Vortex/Core/JobSystem.h"
+
+#include "Vortex/Math/Math.h"
+
 #include "Vortex/Renderer/Renderer.h"
+#include "Vortex/Renderer/TextureCache.h"
+#include "Vortex/Renderer/TextureCompressor.h"
 #include "Vortex/Platform/OpenGL/OpenGLTexture.h"
 
+#include "Vortex/Utils/FileSystem.h"
+
+#include <stb_image.h>
+
+#include <type_traits>
+
 /*
 *** #ifdef VX_PLATFORM_WINDOWS
 ***		#include "Platform/Direct3D/Direct3DTexture.h"
@@ -12,6 +24,136 @@
 
 namespace Vortex {
 
+	namespace Utils {
+
+		static void FlipRows(void* pixels, uint32_t height, uint64_t rowSize)
+		{
+			VX_PROFILE_FUNCTION();
+
+			uint8_t* data = (uint8_t*)pixels;
+			std::vector<uint8_t> row(rowSize);
+
+			for (uint32_t top = 0, bottom = height - 1; top < bottom; top++, bottom--)
+			{
+				uint8_t* topRow = data + top * rowSize;
+				uint8_t* bottomRow = data + bottom * rowSize;
+
+				memcpy(row.data(), topRow, rowSize);
+				memcpy(topRow, bottomRow, rowSize);
+				memcpy(bottomRow, row.data(), rowSize);
+			}
+		}
+
+		// Box filters each level from the one above it, rows are split across job workers
+		template <typename T>
+		static void BuildMipChain(TextureData& data)
+		{
+			VX_PROFILE_FUNCTION();
+
+			const uint32_t channels = data.Channels;
+
+			uint64_t storageSize = 0;
+			uint32_t width = data.Width;
+			uint32_t height = data.Height;
+
+			while (width > 1 || height > 1)
+			{
+				width = Math::Max(width / 2, 1u);
+				height = Math::Max(height / 2, 1u);
+				storageSize += data.GetLevelSize(width, height);
+			}
+
+			if (storageSize == 0)
+				return;
+
+			data.Storage.Allocate(storageSize);
+
+			const T* source = (const T*)data.Pixels;
+			uint32_t sourceWidth = data.Width;
+			uint32_t sourceHeight = data.Height;
+			uint64_t offset = 0;
+
+			while (sourceWidth > 1 || sourceHeight > 1)
+			{
+				const uint32_t mipWidth = Math::Max(sourceWidth / 2, 1u);
+				const uint32_t mipHeight = Math::Max(sourceHeight / 2, 1u);
+				T* destination = (T*)(data.Storage.Data + offset);
+
+				JobSystem::ParallelFor(mipHeight, [=](uint32_t y)
+				{
+					const uint32_t y0 = Math::Min(y * 2, sourceHeight - 1);
+					const uint32_t y1 = Math::Min(y * 2 + 1, sourceHeight - 1);
+
+					for (uint32_t x = 0; x < mipWidth; x++)
+					{
+						const uint32_t x0 = Math::Min(x * 2, sourceWidth - 1);
+						const uint32_t x1 = Math::Min(x * 2 + 1, sourceWidth - 1);
+
+						for (uint32_t c = 0; c < channels; c++)
+						{
+							const float sum = (float)source[(y0 * sourceWidth + x0) * channels + c]
+								+ (float)source[(y0 * sourceWidth + x1) * channels + c]
+								+ (float)source[(y1 * sourceWidth + x0) * channels + c]
+								+ (float)source[(y1 * sourceWidth + x1) * channels + c];
+
+							if constexpr (std::is_floating_point_v<T>)
+								destination[(y * mipWidth + x) * channels + c] = sum * 0.25f;
+							else
+								destination[(y * mipWidth + x) * channels + c] = (T)(sum * 0.25f + 0.5f);
+						}
+					}
+				});
+
+				data.Mips.push_back({ destination, mipWidth, mipHeight });
+
+				offset += data.GetLevelSize(mipWidth, mipHeight);
+				source = destination;
+				sourceWidth = mipWidth;
+				sourceHeight = mipHeight;
+			}
+		}
+
+		// Replaces every level with its block compressed version, the uncompressed levels are freed
+		static void CompressTextureData(TextureData& data)
+		{
+			VX_PROFILE_FUNCTION();
+
+			TextureData compressed;
+			compressed.Width = data.Width;
+			compressed.Height = data.Height;
+			compressed.Channels = data.Channels;
+			compressed.Compression = TextureCompressor::GetCompression(data);
+
+			if (compressed.Compression == TextureCompression::None)
+				return;
+
+			uint64_t storageSize = compressed.GetLevelSize(data.Width, data.Height);
+			for (const TextureMip& mip : data.Mips)
+			{
+				storageSize += compressed.GetLevelSize(mip.Width, mip.Height);
+			}
+
+			compressed.Storage.Allocate(storageSize);
+			compressed.StorageOwnsPixels = true;
+
+			uint8_t* destination = compressed.Storage.Data;
+			TextureCompressor::CompressLevel(compressed.Compression, (const uint8_t*)data.Pixels, data.Width, data.Height, data.Channels, destination);
+			compressed.Pixels = destination;
+			destination += compressed.GetLevelSize(data.Width, data.Height);
+
+			for (const TextureMip& mip : data.Mips)
+			{
+				TextureCompressor::CompressLevel(compressed.Compression, (const uint8_t*)mip.Pixels, mip.Width, mip.Height, data.Channels, destination);
+				compressed.Mips.push_back({ destination, mip.Width, mip.Height });
+				destination += compressed.GetLevelSize(mip.Width, mip.Height);
+			}
+
+			data.Release();
+			data = std::move(compressed);
+		}
+
+	}
+
     SharedReference<Texture2D> Texture2D::Create(const TextureProperties& imageProps)
     {
 		switch (Renderer::GetGraphicsAPI())
@@ -27,5 +169,108 @@ namespace Vortex {
 		VX_CORE_ASSERT(false, "Unknown Renderer API!");
 		return nullptr;
     }
+
+	SharedReference<Texture2D> Texture2D::Create(const TextureProperties& imageProps, const TextureData& data)
+	{
+		switch (Renderer::GetGraphicsAPI())
+		{
+			case RendererAPI::API::None:     VX_CORE_ASSERT(false, "Renderer API was set to RendererAPI::None!"); return nullptr;
+			case RendererAPI::API::OpenGL:   return SharedReference<OpenGLTexture2D>::Create(imageProps, data);
+#ifdef VX_PLATFORM_WINDOWS
+			case RendererAPI::API::Direct3D: return nullptr;
+#endif // VX_PLATFORM_WINDOWS
+			case RendererAPI::API::Vulkan:   return nullptr;
+		}
+
+		VX_CORE_ASSERT(false, "Unknown Renderer API!");
+		return nullptr;
+	}
+
+	bool Texture2D::Decode(const TextureProperties& imageProps, TextureData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		// The file is read once, it's both hashed for the cache key and decoded from memory
+		Buffer source = FileSystem::ReadBinary(imageProps.Filepath);
+		if (!source)
+		{
+			VX_CORE_ERROR("Failed to load image '{}': file could not be read", imageProps.Filepath);
+			return false;
+		}
+
+		const uint64_t cacheKey = TextureCache::GetCacheKey(imageProps, source);
+
+		if (TextureCache::TryLoad(cacheKey, outData))
+		{
+			source.Release();
+			return true;
+		}
+
+		// stb_image's flip flag is global, so images are always decoded upright and flipped here
+		// instead, that keeps concurrent decodes from having to share a lock
+		const stbi_uc* sourceData = (const stbi_uc*)source.Data;
+		const int sourceSize = (int)source.Size;
+		int width, height, channels;
+
+		outData.IsHDR = imageProps.TextureFormat == ImageFormat::RGBA16F || stbi_is_hdr_from_memory(sourceData, sourceSize);
+
+		if (outData.IsHDR)
+		{
+			VX_PROFILE_SCOPE("stbi_loadf - Texture2D::Decode");
+			outData.Pixels = stbi_loadf_from_memory(sourceData, sourceSize, &width, &height, &channels, 0);
+		}
+		else
+		{
+			VX_PROFILE_SCOPE("stbi_load - Texture2D::Decode");
+			outData.Pixels = stbi_load_from_memory(sourceData, sourceSize, &width, &height, &channels, 0);
+		}
+
+		source.Release();
+
+		if (!outData.Pixels)
+		{
+			VX_CORE_ERROR("Failed to load image '{}': {}", imageProps.Filepath, stbi_failure_reason());
+			return false;
+		}
+
+		outData.Width = width;
+		outData.Height = height;
+		outData.Channels = channels;
+
+		if (imageProps.FlipVertical)
+		{
+			Utils::FlipRows(outData.Pixels, outData.Height, outData.GetLevelSize(outData.Width, 1));
+		}
+
+		if (imageProps.GenerateMipmaps)
+		{
+			if (outData.IsHDR)
+				Utils::BuildMipChain<float>(outData);
+			else
+				Utils::BuildMipChain<uint8_t>(outData);
+		}
+
+		if (imageProps.BlockCompress)
+		{
+			Utils::CompressTextureData(outData);
+		}
+
+		TextureCache::Write(cacheKey, outData);
+
+		return true;
+	}
+
+	void TextureData::Release()
+	{
+		if (!StorageOwnsPixels)
+		{
+			stbi_image_free(Pixels);
+		}
+
+		Storage.Release();
+		Mips.clear();
+		Pixels = nullptr;
+		StorageOwnsPixels = false;
+	}
 	
 }
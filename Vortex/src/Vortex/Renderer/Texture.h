@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Vortex/Core/Buffer.h"
+
 #include "Vortex/Asset/Asset.h"
 
 #include "Vortex/Renderer/Image.h"
@@ -7,6 +9,7 @@
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
 #include <string>
+#include <vector>
 
 namespace Vortex {
 
@@ -21,6 +24,8 @@ namespace Vortex {
 
 		bool GenerateMipmaps = true;
 		bool FlipVertical = true;
+		// 8 bit RGB and RGBA images are stored as BC1 and BC3, normal maps and two channel images as BC5, other images are left uncompressed
+		bool BlockCompress = false;
 		bool IsLoaded = false;
 
 		// Only used for writing to file
@@ -29,6 +34,51 @@ namespace Vortex {
 		uint32_t Stride = 0;
 	};
 
+	enum class VORTEX_API TextureCompression : uint32_t
+	{
+		None = 0, BC1, BC3, BC5,
+	};
+
+	struct VORTEX_API TextureMip
+	{
+		const void* Pixels = nullptr;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+	};
+
+	// Pixels decoded on the CPU, produced by Texture2D::Decode on any thread and uploaded later
+	struct VORTEX_API TextureData
+	{
+		void* Pixels = nullptr;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Channels = 0;
+		bool IsHDR = false;
+		TextureCompression Compression = TextureCompression::None;
+
+		// Every level below the base image down to 1x1, empty if mipmaps weren't requested
+		std::vector<TextureMip> Mips;
+		// Backs the mips, and the base image as well when StorageOwnsPixels is set
+		Buffer Storage;
+		// Set for cached and compressed data, otherwise the base image came from stb_image
+		bool StorageOwnsPixels = false;
+
+		void Release();
+
+		inline uint64_t GetLevelSize(uint32_t width, uint32_t height) const
+		{
+			if (Compression != TextureCompression::None)
+			{
+				const uint64_t blockCount = (uint64_t)((width + 3) / 4) * ((height + 3) / 4);
+				return blockCount * (Compression == TextureCompression::BC1 ? 8 : 16);
+			}
+
+			return (uint64_t)width * height * Channels * (IsHDR ? sizeof(float) : sizeof(uint8_t));
+		}
+
+		inline operator bool() const { return Pixels != nullptr; }
+	};
+
 	class VORTEX_API Texture : public Asset
 	{
 	public:
@@ -66,6 +116,12 @@ namespace Vortex {
 		virtual ~Texture2D() override = default;
 
 		static SharedReference<Texture2D> Create(const TextureProperties& imageProps);
+		// Uploads pixels that were decoded ahead of time, the filepath is only kept for reference
+		static SharedReference<Texture2D> Create(const TextureProperties& imageProps, const TextureData& data);
+
+		// Reads and decodes imageProps.Filepath without touching the GPU, safe to call from job workers.
+		// Decoded images and their mip chains are kept in the texture cache, later calls skip decoding entirely
+		static bool Decode(const TextureProperties& imageProps, TextureData& outData);
 	};
 
 }
@@ -0,0 +1,313 @@
+#include "vxpch.h"
+#include "TextureCache.h"
+
+#include "Vortex/Project/Project.h"
+
+#include "Vortex/Math/Math.h"
+
+#include "Vortex/Serialization/StreamWriter.h"
+
+#include "Vortex/Utils/Hash.h"
+
+#include <mutex>
+
+namespace Vortex {
+
+	struct TextureCacheHeader
+	{
+		uint32_t Magic = 0;
+		uint32_t Version = 0;
+		uint64_t Key = 0;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Channels = 0;
+		uint32_t IsHDR = 0;
+		uint32_t MipCount = 0;
+		TextureCompression Compression = TextureCompression::None;
+	};
+
+	namespace Utils {
+
+		static constexpr uint32_t s_TextureCacheMagic = 0x58545856; // VXTX
+
+		// Bump whenever the mip filter, the block encoder or the file layout change
+		static constexpr uint32_t s_TextureCacheVersion = 3;
+
+		// Least recently used entries are removed once the directory grows past this
+		static constexpr uint64_t s_MaxTextureCacheSize = 1024ull * 1024 * 1024;
+
+		static std::mutex s_TextureCacheSizeMutex;
+		static Fs::Path s_SizedCacheDirectory;
+		static uint64_t s_TextureCacheSize = 0;
+
+		static Fs::Path GetTextureCacheDirectory()
+		{
+			return Project::GetActive() ? Project::GetCacheDirectory() / "Textures" : "Resources/Cache/Textures";
+		}
+
+		static Fs::Path GetTextureCacheFilepath(uint64_t key)
+		{
+			return GetTextureCacheDirectory() / fmt::format("{:016x}.vxtex", key);
+		}
+
+		struct TextureCacheEntry
+		{
+			uint64_t LastWriteTime = 0;
+			uint64_t Size = 0;
+			Fs::Path Filepath;
+		};
+
+		static std::vector<TextureCacheEntry> GetTextureCacheEntries(const Fs::Path& directory)
+		{
+			std::vector<TextureCacheEntry> entries;
+
+			std::error_code error;
+			for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+			{
+				if (entry.is_regular_file() && entry.path().extension() == ".vxtex")
+				{
+					entries.push_back({ FileSystem::GetLastWriteTime(entry.path()), FileSystem::GetFileSize(entry.path()), entry.path() });
+				}
+			}
+
+			return entries;
+		}
+
+		// The directory is only scanned once per project, after that written entries are added to a running total
+		static void OnTextureCacheEntryWritten(const Fs::Path& filepath)
+		{
+			std::scoped_lock<std::mutex> lock(s_TextureCacheSizeMutex);
+
+			const Fs::Path directory = filepath.parent_path();
+
+			if (directory != s_SizedCacheDirectory)
+			{
+				s_SizedCacheDirectory = directory;
+				s_TextureCacheSize = 0;
+
+				for (const TextureCacheEntry& entry : GetTextureCacheEntries(directory))
+				{
+					s_TextureCacheSize += entry.Size;
+				}
+			}
+			else
+			{
+				s_TextureCacheSize += FileSystem::GetFileSize(filepath);
+			}
+
+			if (s_TextureCacheSize <= s_MaxTextureCacheSize)
+				return;
+
+			std::vector<TextureCacheEntry> entries = GetTextureCacheEntries(directory);
+			std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.LastWriteTime < rhs.LastWriteTime; });
+
+			s_TextureCacheSize = 0;
+			for (const TextureCacheEntry& entry : entries)
+			{
+				s_TextureCacheSize += entry.Size;
+			}
+
+			// Prune down to three quarters of the limit so the next few writes don't scan the directory again
+			const uint64_t targetSize = s_MaxTextureCacheSize / 4 * 3;
+
+			for (const TextureCacheEntry& entry : entries)
+			{
+				if (s_TextureCacheSize <= targetSize)
+					break;
+
+				std::error_code error;
+				if (std::filesystem::remove(entry.Filepath, error))
+				{
+					s_TextureCacheSize -= entry.Size;
+				}
+			}
+
+			VX_CORE_INFO_TAG("Texture", "Pruned texture cache to {} MB", s_TextureCacheSize / (1024 * 1024));
+		}
+
+	}
+
+	namespace Utils {
+
+		// Points the levels into the buffer without copying, marks the pixels as not owned by stb_image
+		static bool ReadTextureData(const Buffer& buffer, TextureData& outData)
+		{
+			if (!buffer || buffer.Size < sizeof(TextureCacheHeader))
+				return false;
+
+			const TextureCacheHeader header = *(const TextureCacheHeader*)buffer.Data;
+
+			const bool valid = header.Magic == s_TextureCacheMagic
+				&& header.Version == s_TextureCacheVersion
+				&& header.Width > 0 && header.Height > 0
+				&& header.Channels > 0 && header.Channels <= 4
+				&& header.Compression <= TextureCompression::BC5;
+
+			if (!valid)
+				return false;
+
+			outData.Width = header.Width;
+			outData.Height = header.Height;
+			outData.Channels = header.Channels;
+			outData.IsHDR = header.IsHDR != 0;
+			outData.Compression = header.Compression;
+
+			uint64_t offset = sizeof(TextureCacheHeader);
+			uint64_t levelSize = outData.GetLevelSize(outData.Width, outData.Height);
+
+			if (offset + levelSize > buffer.Size)
+				return false;
+
+			outData.Pixels = buffer.Data + offset;
+			offset += levelSize;
+
+			uint32_t width = outData.Width;
+			uint32_t height = outData.Height;
+
+			for (uint32_t i = 0; i < header.MipCount; i++)
+			{
+				width = Math::Max(width / 2, 1u);
+				height = Math::Max(height / 2, 1u);
+				levelSize = outData.GetLevelSize(width, height);
+
+				if (offset + levelSize > buffer.Size)
+					return false;
+
+				outData.Mips.push_back({ buffer.Data + offset, width, height });
+				offset += levelSize;
+			}
+
+			outData.StorageOwnsPixels = true;
+
+			return true;
+		}
+
+		static void WriteTextureData(StreamWriter& writer, uint64_t key, const TextureData& data)
+		{
+			TextureCacheHeader header;
+			header.Magic = s_TextureCacheMagic;
+			header.Version = s_TextureCacheVersion;
+			header.Key = key;
+			header.Width = data.Width;
+			header.Height = data.Height;
+			header.Channels = data.Channels;
+			header.IsHDR = (uint32_t)data.IsHDR;
+			header.MipCount = (uint32_t)data.Mips.size();
+			header.Compression = data.Compression;
+
+			writer.WriteRaw(header);
+			writer.WriteData(data.Pixels, data.GetLevelSize(data.Width, data.Height));
+
+			for (const TextureMip& mip : data.Mips)
+			{
+				writer.WriteData(mip.Pixels, data.GetLevelSize(mip.Width, mip.Height));
+			}
+		}
+
+	}
+
+	uint64_t TextureCache::GetCacheKey(const TextureProperties& imageProps, const Buffer& source)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (!source)
+		{
+			return 0;
+		}
+
+		Fnv1a hasher;
+
+		const uint32_t header[] =
+		{
+			Utils::s_TextureCacheVersion,
+			(uint32_t)imageProps.FlipVertical,
+			(uint32_t)imageProps.GenerateMipmaps,
+			(uint32_t)(imageProps.TextureFormat == ImageFormat::RGBA16F),
+			(uint32_t)imageProps.BlockCompress,
+		};
+		hasher.AddBytes(header, sizeof(header));
+		hasher.AddBytes(source.Data, source.Size);
+
+		return hasher.GetKey();
+	}
+
+	bool TextureCache::TryLoad(uint64_t key, TextureData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (key == 0)
+			return false;
+
+		const Fs::Path filepath = Utils::GetTextureCacheFilepath(key);
+		if (!FileSystem::Exists(filepath))
+			return false;
+
+		// The whole file is read with a single call and the levels are used in place
+		Buffer buffer = FileSystem::ReadBinary(filepath);
+
+		TextureData data;
+		if (!Utils::ReadTextureData(buffer, data) || buffer.As<TextureCacheHeader>()->Key != key)
+		{
+			buffer.Release();
+			return false;
+		}
+
+		data.Storage = buffer;
+		outData = std::move(data);
+
+		// Hits count as recently used so pruning keeps them
+		std::error_code error;
+		std::filesystem::last_write_time(filepath, std::filesystem::file_time_type::clock::now(), error);
+
+		return true;
+	}
+
+	void TextureCache::Write(uint64_t key, const TextureData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (key == 0 || !data)
+			return;
+
+		StreamWriter writer;
+		Utils::WriteTextureData(writer, key, data);
+
+		const Fs::Path filepath = Utils::GetTextureCacheFilepath(key);
+
+		if (!writer.WriteToFile(filepath))
+		{
+			VX_CORE_ERROR_TAG("Texture", "Failed to cache texture to {}", filepath.string());
+			return;
+		}
+
+		Utils::OnTextureCacheEntryWritten(filepath);
+	}
+
+	Buffer TextureCache::Serialize(const TextureData& data)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (!data)
+			return Buffer();
+
+		StreamWriter writer;
+		Utils::WriteTextureData(writer, 0, data);
+
+		Buffer buffer(writer.GetSize());
+		memcpy(buffer.Data, writer.GetData(), writer.GetSize());
+		return buffer;
+	}
+
+	bool TextureCache::Deserialize(const Buffer& payload, TextureData& outData)
+	{
+		VX_PROFILE_FUNCTION();
+
+		TextureData data;
+		if (!Utils::ReadTextureData(payload, data))
+			return false;
+
+		outData = std::move(data);
+		return true;
+	}
+
+}
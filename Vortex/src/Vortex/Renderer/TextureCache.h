@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
+
+#include "Vortex/Renderer/Texture.h"
+
+#include "Vortex/Utils/FileSystem.h"
+
+namespace Vortex {
+
+	// Binary cache of decoded or block compressed textures and their mip chains in Project::GetCacheDirectory(),
+	// entries are keyed by the source file's contents and the load options so stale entries are never read.
+	// The directory is kept under a size limit by removing the least recently used entries
+	class VORTEX_API TextureCache
+	{
+	public:
+		static uint64_t GetCacheKey(const TextureProperties& imageProps, const Buffer& source);
+
+		// On success outData owns the file's memory, the base image and mips point into it
+		static bool TryLoad(uint64_t key, TextureData& outData);
+		static void Write(uint64_t key, const TextureData& data);
+
+		// Same encoding as a cache entry without the key, used to store textures inline in an asset pack.
+		// Deserialized levels point into the payload, which has to outlive the data
+		static Buffer Serialize(const TextureData& data);
+		static bool Deserialize(const Buffer& payload, TextureData& outData);
+	};
+
+}
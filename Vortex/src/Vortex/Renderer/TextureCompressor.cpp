@@ -0,0 +1,294 @@
+#include "vxpch.h"
+#include "TextureCompressor.h"
+
+#include "Vortex/Core/JobSystem.h"
+
+#include "Vortex/Math/Math.h"
+
+#include <climits>
+
+namespace Vortex {
+
+	namespace Utils {
+
+		struct PixelBlock
+		{
+			uint8_t Pixels[16][4];
+		};
+
+		static void LoadPixelBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, uint32_t blockX, uint32_t blockY, PixelBlock& outBlock)
+		{
+			// Blocks hanging over the edge of the image repeat its last row and column
+			for (uint32_t y = 0; y < 4; y++)
+			{
+				const uint32_t sourceY = Math::Min(blockY * 4 + y, height - 1);
+
+				for (uint32_t x = 0; x < 4; x++)
+				{
+					const uint32_t sourceX = Math::Min(blockX * 4 + x, width - 1);
+					const uint8_t* source = pixels + ((uint64_t)sourceY * width + sourceX) * channels;
+					uint8_t* destination = outBlock.Pixels[y * 4 + x];
+
+					destination[0] = source[0];
+					destination[1] = source[1];
+					destination[2] = channels >= 3 ? source[2] : 0;
+					destination[3] = channels == 4 ? source[3] : 255;
+				}
+			}
+		}
+
+		static uint16_t PackRGB565(const int color[3])
+		{
+			const uint16_t r = (uint16_t)((color[0] * 31 + 127) / 255);
+			const uint16_t g = (uint16_t)((color[1] * 63 + 127) / 255);
+			const uint16_t b = (uint16_t)((color[2] * 31 + 127) / 255);
+
+			return (uint16_t)((r << 11) | (g << 5) | b);
+		}
+
+		static void UnpackRGB565(uint16_t packed, int outColor[3])
+		{
+			const int r = (packed >> 11) & 31;
+			const int g = (packed >> 5) & 63;
+			const int b = packed & 31;
+
+			outColor[0] = (r << 3) | (r >> 2);
+			outColor[1] = (g << 2) | (g >> 4);
+			outColor[2] = (b << 3) | (b >> 2);
+		}
+
+		// Endpoints come from the block's bounding box pulled in slightly, every pixel picks the closest of the four palette colors
+		static void EncodeColorBlock(const PixelBlock& block, uint8_t* outBlock)
+		{
+			int minColor[3] = { 255, 255, 255 };
+			int maxColor[3] = { 0, 0, 0 };
+
+			for (const auto& pixel : block.Pixels)
+			{
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					minColor[c] = Math::Min(minColor[c], (int)pixel[c]);
+					maxColor[c] = Math::Max(maxColor[c], (int)pixel[c]);
+				}
+			}
+
+			for (uint32_t c = 0; c < 3; c++)
+			{
+				const int inset = (maxColor[c] - minColor[c]) / 16;
+				minColor[c] += inset;
+				maxColor[c] -= inset;
+			}
+
+			uint16_t color0 = PackRGB565(maxColor);
+			uint16_t color1 = PackRGB565(minColor);
+			uint32_t indices = 0;
+
+			// Equal endpoints leave every index at zero, which is the first endpoint in either mode
+			if (color0 != color1)
+			{
+				// The four color mode requires the first endpoint to be the larger one
+				if (color0 < color1)
+				{
+					std::swap(color0, color1);
+				}
+
+				int palette[4][3];
+				UnpackRGB565(color0, palette[0]);
+				UnpackRGB565(color1, palette[1]);
+
+				for (uint32_t c = 0; c < 3; c++)
+				{
+					palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+					palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+				}
+
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					const uint8_t* pixel = block.Pixels[i];
+					uint32_t bestIndex = 0;
+					int bestDistance = INT_MAX;
+
+					for (uint32_t j = 0; j < 4; j++)
+					{
+						const int dr = pixel[0] - palette[j][0];
+						const int dg = pixel[1] - palette[j][1];
+						const int db = pixel[2] - palette[j][2];
+						const int distance = dr * dr + dg * dg + db * db;
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							bestIndex = j;
+						}
+					}
+
+					indices |= bestIndex << (i * 2);
+				}
+			}
+
+			outBlock[0] = (uint8_t)(color0 & 0xFF);
+			outBlock[1] = (uint8_t)(color0 >> 8);
+			outBlock[2] = (uint8_t)(color1 & 0xFF);
+			outBlock[3] = (uint8_t)(color1 >> 8);
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				outBlock[4 + i] = (uint8_t)((indices >> (i * 8)) & 0xFF);
+			}
+		}
+
+		// Encodes one channel of the block, always in the eight value mode with the channel's range as the endpoints
+		static void EncodeChannelBlock(const PixelBlock& block, uint32_t channel, uint8_t* outBlock)
+		{
+			int minValue = 255;
+			int maxValue = 0;
+
+			for (const auto& pixel : block.Pixels)
+			{
+				minValue = Math::Min(minValue, (int)pixel[channel]);
+				maxValue = Math::Max(maxValue, (int)pixel[channel]);
+			}
+
+			uint64_t indices = 0;
+
+			if (minValue != maxValue)
+			{
+				int palette[8];
+				palette[0] = maxValue;
+				palette[1] = minValue;
+
+				for (int i = 1; i < 7; i++)
+				{
+					palette[i + 1] = ((7 - i) * maxValue + i * minValue) / 7;
+				}
+
+				for (uint32_t i = 0; i < 16; i++)
+				{
+					const int value = block.Pixels[i][channel];
+					uint64_t bestIndex = 0;
+					int bestDistance = INT_MAX;
+
+					for (uint32_t j = 0; j < 8; j++)
+					{
+						const int distance = Math::Abs(value - palette[j]);
+
+						if (distance < bestDistance)
+						{
+							bestDistance = distance;
+							bestIndex = j;
+						}
+					}
+
+					indices |= bestIndex << (i * 3);
+				}
+			}
+
+			outBlock[0] = (uint8_t)maxValue;
+			outBlock[1] = (uint8_t)minValue;
+
+			for (uint32_t i = 0; i < 6; i++)
+			{
+				outBlock[2 + i] = (uint8_t)((indices >> (i * 8)) & 0xFF);
+			}
+		}
+
+		// Tangent space normal maps decode to unit vectors facing out of the surface, a few stray pixels are tolerated
+		static bool IsNormalMap(const TextureData& data)
+		{
+			if (data.Channels < 3)
+				return false;
+
+			// Looking at every pixel isn't needed to tell, a few thousand spread across the image are enough
+			const uint64_t pixelCount = (uint64_t)data.Width * data.Height;
+			const uint64_t step = Math::Max(pixelCount / 4096, (uint64_t)1);
+			const uint8_t* pixels = (const uint8_t*)data.Pixels;
+
+			uint64_t sampled = 0;
+			uint64_t rejected = 0;
+
+			for (uint64_t i = 0; i < pixelCount; i += step)
+			{
+				const uint8_t* pixel = pixels + i * data.Channels;
+				const float x = pixel[0] / 127.5f - 1.0f;
+				const float y = pixel[1] / 127.5f - 1.0f;
+				const float z = pixel[2] / 127.5f - 1.0f;
+				const float lengthSquared = x * x + y * y + z * z;
+
+				// Alpha would be lost, so only opaque images count
+				const bool opaque = data.Channels == 3 || pixel[3] == 255;
+
+				if (!opaque || z < -0.01f || Math::Abs(lengthSquared - 1.0f) > 0.15f)
+					rejected++;
+
+				sampled++;
+			}
+
+			return rejected * 100 <= sampled;
+		}
+
+	}
+
+	TextureCompression TextureCompressor::GetCompression(const TextureData& data)
+	{
+		if (!data || data.IsHDR || data.Compression != TextureCompression::None)
+			return TextureCompression::None;
+
+		// Mips smaller than a block are fine, the base level has to be made of whole blocks
+		if (data.Width % 4 != 0 || data.Height % 4 != 0)
+			return TextureCompression::None;
+
+		if (Utils::IsNormalMap(data))
+			return TextureCompression::BC5;
+
+		switch (data.Channels)
+		{
+			case 2: return TextureCompression::BC5;
+			case 3: return TextureCompression::BC1;
+			case 4: return TextureCompression::BC3;
+		}
+
+		return TextureCompression::None;
+	}
+
+	void TextureCompressor::CompressLevel(TextureCompression compression, const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, uint8_t* outBlocks)
+	{
+		VX_PROFILE_FUNCTION();
+
+		VX_CORE_ASSERT(compression != TextureCompression::None, "Invalid texture compression!");
+
+		const uint32_t blocksWide = (width + 3) / 4;
+		const uint32_t blocksHigh = (height + 3) / 4;
+		const uint32_t blockSize = compression == TextureCompression::BC1 ? 8 : 16;
+
+		JobSystem::ParallelFor(blocksHigh, [=](uint32_t blockY)
+		{
+			Utils::PixelBlock block;
+			uint8_t* destination = outBlocks + (uint64_t)blockY * blocksWide * blockSize;
+
+			for (uint32_t blockX = 0; blockX < blocksWide; blockX++)
+			{
+				Utils::LoadPixelBlock(pixels, width, height, channels, blockX, blockY, block);
+
+				switch (compression)
+				{
+					case TextureCompression::BC1:
+						Utils::EncodeColorBlock(block, destination);
+						break;
+					case TextureCompression::BC3:
+						// BC3 is an alpha block followed by a BC1 color block
+						Utils::EncodeChannelBlock(block, 3, destination);
+						Utils::EncodeColorBlock(block, destination + 8);
+						break;
+					case TextureCompression::BC5:
+						// BC5 is two alpha style blocks, the red channel followed by the green channel
+						Utils::EncodeChannelBlock(block, 0, destination);
+						Utils::EncodeChannelBlock(block, 1, destination + 8);
+						break;
+				}
+
+				destination += blockSize;
+			}
+		});
+	}
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include "Vortex/Renderer/Texture.h"
+
+namespace Vortex {
+
+	// CPU block compression of 8 bit textures, each 4x4 block is encoded independently
+	class VORTEX_API TextureCompressor
+	{
+	public:
+		// BC5 for normal maps and two channel images, BC1 for RGB and BC3 for RGBA images, None if the image can't be compressed
+		static TextureCompression GetCompression(const TextureData& data);
+
+		// Encodes one level into outBlocks, rows of blocks are split across job workers
+		static void CompressLevel(TextureCompression compression, const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, uint8_t* outBlocks);
+	};
+
+}
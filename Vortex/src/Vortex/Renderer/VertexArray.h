@@ -18,6 +18,9 @@ namespace Vortex {
 		virtual void AddVertexBuffer(SharedReference<VertexBuffer>& vertexBuffer) = 0;
 		virtual void SetIndexBuffer(SharedReference<IndexBuffer>& indexBuffer) = 0;
 
+		// Points the per-instance attributes at the buffer, they always come after the vertex attributes
+		virtual void SetInstanceBuffer(const SharedReference<VertexBuffer>& instanceBuffer) = 0;
+
 		virtual const std::vector<SharedReference<VertexBuffer>>& GetVertexBuffers() const = 0;
 		virtual const SharedReference<IndexBuffer>& GetIndexBuffer() const = 0;
 
@@ -16,12 +16,8 @@ namespace Vortex {
 		Math::vec3 Tangent;
 		Math::vec3 BiTangent;
 		Math::vec2 TexCoord;
-		Math::vec2 TexScale;
 		Math::ivec4 BoneIDs;
 		Math::vec4 BoneWeights;
-
-		// Editor-only
-		int EntityID;
 	};
 
 	struct VORTEX_API StaticVertex
@@ -32,7 +28,12 @@ namespace Vortex {
 		Math::vec3 Tangent;
 		Math::vec3 BiTangent;
 		Math::vec2 TexCoord;
-		Math::vec2 TexScale;
+	};
+
+	// Per instance attributes, streamed once per frame for instanced draws
+	struct VORTEX_API InstanceData
+	{
+		Math::mat4 Transform;
 
 		// Editor-only
 		int EntityID;
@@ -42,6 +42,9 @@ namespace Vortex {
     void Actor::SetParentUUID(UUID parentUUID) const
 	{
 		GetComponent<HierarchyComponent>().ParentUUID = parentUUID;
+
+		m_Scene->InvalidateTransformHierarchy();
+		m_Scene->MarkWorldSpaceTransformDirty(*this);
 	}
 
 	std::vector<UUID>& Actor::Children()
@@ -52,6 +55,8 @@ namespace Vortex {
 	void Actor::AddChild(UUID childUUID) const
 	{
 		GetComponent<HierarchyComponent>().Children.push_back(childUUID);
+
+		m_Scene->InvalidateTransformHierarchy();
 	}
 
 	bool Actor::HasChild(UUID childUUID) const
@@ -69,6 +74,7 @@ namespace Vortex {
 			return false;
 		}
 		children.erase(it);
+		m_Scene->InvalidateTransformHierarchy();
 		return true;
 	}
 
@@ -4,6 +4,8 @@
 
 #include "Vortex/Asset/Asset.h"
 
+#include "Vortex/Math/AABB.h"
+
 #include "Vortex/Scene/SceneCamera.h"
 
 #include "Vortex/Renderer/Material.h"
@@ -101,6 +103,7 @@ namespace Vortex {
 			Math::vec4 perspective;
 			Math::Decompose(transform, Scale, Rotation, Translation, skew, perspective);
 			RotationEuler = Math::EulerAngles(Rotation);
+			Dirty = true;
 		}
 
 		VX_FORCE_INLINE Math::quaternion GetRotation() const { return Rotation; }
@@ -110,6 +113,7 @@ namespace Vortex {
 			const Math::vec3 originalEuler = RotationEuler;
 			Rotation = rotation;
 			RotationEuler = Math::EulerAngles(Rotation);
+			Dirty = true;
 
 			// Attempt to avoid 180deg flips in the Euler angles when we SetRotation(quat)
 			if (
@@ -129,8 +133,14 @@ namespace Vortex {
 		{
 			RotationEuler = euler;
 			Rotation = Math::quaternion(RotationEuler);
+			Dirty = true;
 		}
 
+		// Translation and Scale are public so writes to them can't flag the transform,
+		// the scene compares them against the last cached values instead
+		VX_FORCE_INLINE bool IsDirty() const { return Dirty; }
+		VX_FORCE_INLINE void SetDirty(bool dirty) { Dirty = dirty; }
+
 		VX_FORCE_INLINE Math::vec3 CalculateForward() const { return CalculateDirection({ 0.0f, 0.0f, -1.0f }); }
 		VX_FORCE_INLINE Math::vec3 CalculateBackward() const { return CalculateDirection({ 0.0f, 0.0f, 1.0f }); }
 		VX_FORCE_INLINE Math::vec3 CalculateUp() const { return CalculateDirection({ 0.0f, 1.0f, 0.0f }); }
@@ -147,6 +157,44 @@ namespace Vortex {
 	private:
 		Math::vec3 RotationEuler = Math::vec3(0.0f, 0.0f, 0.0f);
 		Math::quaternion Rotation = Math::quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+		bool Dirty = true;
+	};
+
+	// Runtime cache of an actor's world space transform, recomputed by the
+	// scene once per frame in parent-before-child order for dirty subtrees only
+	struct VORTEX_API WorldTransformComponent
+	{
+		Math::mat4 Transform = Math::mat4(1.0f);
+
+		// Local values used to build the cached matrix
+		Math::vec3 LocalTranslation = Math::vec3(0.0f);
+		Math::vec3 LocalScale = Math::vec3(1.0f);
+
+		uint32_t HierarchyIndex = std::numeric_limits<uint32_t>::max();
+		bool Dirty = true;
+
+		WorldTransformComponent() = default;
+		WorldTransformComponent(const WorldTransformComponent&) = default;
+
+		VX_FORCE_INLINE Math::vec3 GetTranslation() const { return Math::vec3(Transform[3]); }
+
+		VX_FORCE_INLINE bool IsLocalTransformDirty(const TransformComponent& transform) const
+		{
+			return Dirty || transform.IsDirty() || transform.Translation != LocalTranslation || transform.Scale != LocalScale;
+		}
+	};
+
+	// Runtime only, tracks the actor's mesh in the scene's bounding volume hierarchy
+	struct VORTEX_API MeshBoundsComponent
+	{
+		Math::AABB LocalBounds;
+		Math::AABB WorldBounds;
+
+		AssetHandle Mesh = 0;
+		int32_t ProxyID = -1;
+
+		MeshBoundsComponent() = default;
+		MeshBoundsComponent(const MeshBoundsComponent&) = default;
 	};
 
 	struct VORTEX_API PrefabComponent
@@ -3,6 +3,7 @@
 
 #include "Vortex/Core/Application.h"
 #include "Vortex/Core/String.h"
+#include "Vortex/Core/JobSystem.h"
 
 #include "Vortex/Math/Math.h"
 
@@ -49,13 +50,58 @@ namespace Vortex {
 	static SceneRenderer s_SceneRenderer;
 	static Timer s_NullTimer = Timer("", 0.0f, nullptr);
 
+	namespace Utils {
+
+		struct AnimationLODLevel
+		{
+			// Fraction of the viewport height covered by the mesh bounds
+			float MinScreenSize;
+			AnimationLOD LOD;
+		};
+
+		// Ordered from closest to furthest, the last level catches everything else
+		static constexpr AnimationLODLevel s_AnimationLODLevels[] =
+		{
+			{ 0.25f, { 1, AnimationLOD::AllNodes } },
+			{ 0.10f, { 2, AnimationLOD::AllNodes } },
+			{ 0.04f, { 4, 10 } },
+			{ 0.00f, { 8, 6 } },
+		};
+
+		static AnimationLOD SelectAnimationLOD(const Math::AABB& bounds, const Math::vec3& cameraPosition, const Math::mat4& projection)
+		{
+			const float radius = Math::Length(bounds.GetExtents());
+
+			// Perspective projections have a zero in the bottom right, orthographic ones don't scale with distance
+			const bool perspective = projection[3][3] == 0.0f;
+			const float distance = perspective ? Math::Max(Math::Distance(bounds.GetCenter(), cameraPosition), 0.001f) : 1.0f;
+			const float screenSize = radius * projection[1][1] / distance;
+
+			for (const AnimationLODLevel& level : s_AnimationLODLevels)
+			{
+				if (screenSize >= level.MinScreenSize)
+					return level.LOD;
+			}
+
+			return s_AnimationLODLevels[std::size(s_AnimationLODLevels) - 1].LOD;
+		}
+
+	}
+
 	Scene::Scene(SharedReference<Framebuffer>& targetFramebuffer)
 		: m_TargetFramebuffer(targetFramebuffer)
 	{
 		SystemManager::OnContextSceneCreated(this);
 
+		m_Registry.on_construct<HierarchyComponent>().connect<&Scene::OnHierarchyChanged>(this);
+		m_Registry.on_update<HierarchyComponent>().connect<&Scene::OnHierarchyChanged>(this);
+		m_Registry.on_destroy<HierarchyComponent>().connect<&Scene::OnHierarchyChanged>(this);
+
 		m_Registry.on_construct<CameraComponent>().connect<&Scene::OnCameraConstruct>(this);
 		m_Registry.on_construct<StaticMeshRendererComponent>().connect<&Scene::OnStaticMeshConstruct>(this);
+		m_Registry.on_destroy<StaticMeshRendererComponent>().connect<&Scene::OnMeshRendererDestruct>(this);
+		m_Registry.on_destroy<MeshRendererComponent>().connect<&Scene::OnMeshRendererDestruct>(this);
+		m_Registry.on_destroy<MeshBoundsComponent>().connect<&Scene::OnMeshBoundsDestruct>(this);
 
 		m_Registry.on_construct<ParticleEmitterComponent>().connect<&Scene::OnParticleEmitterConstruct>(this);
 		m_Registry.on_destroy<ParticleEmitterComponent>().connect<&Scene::OnParticleEmitterDestruct>(this);
@@ -70,14 +116,23 @@ namespace Vortex {
 		
 		m_Registry.on_construct<AudioListenerComponent>().connect<&Scene::OnAudioListenerConstruct>(this);
 		m_Registry.on_destroy<AudioListenerComponent>().connect<&Scene::OnAudioListenerDestruct>(this);
+
+		m_Registry.on_construct<RigidBody2DComponent>().connect<&Scene::OnRigidBody2DConstruct>(this);
 	}
 
 	Scene::~Scene()
 	{
 		SystemManager::OnContextSceneDestroyed(this);
 
+		m_Registry.on_construct<HierarchyComponent>().disconnect();
+		m_Registry.on_update<HierarchyComponent>().disconnect();
+		m_Registry.on_destroy<HierarchyComponent>().disconnect();
+
 		m_Registry.on_construct<CameraComponent>().disconnect();
 		m_Registry.on_construct<StaticMeshRendererComponent>().disconnect();
+		m_Registry.on_destroy<StaticMeshRendererComponent>().disconnect();
+		m_Registry.on_destroy<MeshRendererComponent>().disconnect();
+		m_Registry.on_destroy<MeshBoundsComponent>().disconnect();
 
 		m_Registry.on_construct<ParticleEmitterComponent>().disconnect();
 		m_Registry.on_destroy<ParticleEmitterComponent>().disconnect();
@@ -92,6 +147,8 @@ namespace Vortex {
 		
 		m_Registry.on_construct<AudioListenerComponent>().disconnect();
 		m_Registry.on_destroy<AudioListenerComponent>().disconnect();
+
+		m_Registry.on_construct<RigidBody2DComponent>().disconnect();
 	}
 
 	Actor Scene::CreateActor(const std::string& name, const std::string& marker)
@@ -121,6 +178,7 @@ namespace Vortex {
 		Actor actor = { m_Registry.create(), this };
 		actor.AddComponent<IDComponent>(uuid);
 		actor.AddComponent<TransformComponent>();
+		actor.AddComponent<WorldTransformComponent>();
 
 		TagComponent& tagComponent = actor.AddComponent<TagComponent>();
 		tagComponent.Tag = name.empty() ? "Actor" : name;
@@ -165,6 +223,7 @@ namespace Vortex {
 		ComponentUtils::CopyComponentIfExists(AllComponents{}, duplicate, actor);
 
 		duplicate.Children().clear();
+		InvalidateTransformHierarchy();
 
 		// Copy children actors
 		// We must use an index based loop because the vector is modified below
@@ -293,6 +352,8 @@ namespace Vortex {
 	void Scene::ClearActors()
 	{
 		m_Registry.clear();
+		m_TransformHierarchy.clear();
+		InvalidateTransformHierarchy();
 	}
 
 	void Scene::OnRuntimeStart(bool muteAudio)
@@ -422,6 +483,9 @@ namespace Vortex {
 
 		m_IsSimulating = true;
 
+		// Physics reads the cached world transforms while building its bodies
+		UpdateWorldSpaceTransforms();
+
 		Physics::OnSimulationStart(this);
 		Physics2D::OnSimulationStart(this);
 	}
@@ -434,6 +498,13 @@ namespace Vortex {
 		Physics2D::OnSimulationUpdate(delta, this);
 	}
 
+	void Scene::OnPhysicsSimulationFetchResults()
+	{
+		VX_PROFILE_FUNCTION();
+
+		Physics::OnSimulationFetchResults();
+	}
+
 	void Scene::OnPhysicsSimulationStop()
 	{
 		VX_PROFILE_FUNCTION();
@@ -496,8 +567,19 @@ namespace Vortex {
 			frameTime.PhysicsUpdateTime += timer.ElapsedMS();
 #endif
 
-			// Update Animators
-			OnAnimatorUpdateRuntime(delta);
+			// Update Animators, culling and LOD use the camera from the end of last frame
+			Math::mat4 cameraView = Math::Identity();
+			Math::mat4 cameraProjection = Math::Identity();
+
+			Actor primaryCameraActor = GetPrimaryCameraActor();
+
+			if (primaryCameraActor)
+			{
+				cameraView = Math::Inverse(GetWorldSpaceTransform(primaryCameraActor).GetTransform());
+				cameraProjection = primaryCameraActor.GetComponent<CameraComponent>().Camera.GetProjectionMatrix();
+			}
+
+			OnAnimatorUpdateRuntime(delta, cameraView, cameraProjection, (bool)primaryCameraActor);
 
 			if (m_StepFrames)
 			{
@@ -505,6 +587,8 @@ namespace Vortex {
 			}
 		}
 
+		UpdateWorldSpaceTransforms();
+
 		// Locate the scene's primary camera
 		SceneCamera* primarySceneCamera = nullptr;
 		TransformComponent primarySceneCameraTransform;
@@ -542,8 +626,21 @@ namespace Vortex {
 			Renderer2D::SetLineWidth(properties.RendererProps.LineWidth);
 		}
 
-		// Update Components/Systems
-		OnComponentUpdate(delta);
+		// Physics ran while the frame was submitted, pick up the results before anything else touches the physics scene
+		if (updateCurrentFrame)
+		{
+#ifndef VX_DIST
+			InstrumentationTimer timer("Scene::OnUpdateRuntime - Physics Fetch Results");
+#endif
+
+			OnPhysicsSimulationFetchResults();
+
+#ifndef VX_DIST
+			Application::Get().GetFrameTime().PhysicsUpdateTime += timer.ElapsedMS();
+#endif
+		}
+
+		// Update Systems
 		OnSystemUpdate(delta);
 
 		if (updateCurrentFrame)
@@ -579,7 +676,7 @@ namespace Vortex {
 			OnPhysicsSimulationUpdate(delta);
 
 			// Update Animators
-			OnAnimatorUpdateRuntime(delta);
+			OnAnimatorUpdateRuntime(delta, camera->GetViewMatrix(), camera->GetProjectionMatrix());
 
 			if (m_StepFrames)
 			{
@@ -587,6 +684,8 @@ namespace Vortex {
 			}
 		}
 
+		UpdateWorldSpaceTransforms();
+
 		if (Actor primaryCameraActor = GetPrimaryCameraActor())
 		{
 			const CameraComponent& cameraComponent = primaryCameraActor.GetComponent<CameraComponent>();
@@ -614,8 +713,12 @@ namespace Vortex {
 			s_SceneRenderer.RenderScene(renderPacket);
 		}
 
-		// Update Components/Systems
-		OnComponentUpdate(delta);
+		if (updateCurrentFrame)
+		{
+			OnPhysicsSimulationFetchResults();
+		}
+
+		// Update Systems
 		OnSystemUpdate(delta);
 
 		FlushPostUpdateQueue();
@@ -628,7 +731,9 @@ namespace Vortex {
 		FlushPreUpdateQueue();
 
 		// Update Animators
-		OnAnimatorUpdateRuntime(delta);
+		OnAnimatorUpdateRuntime(delta, camera->GetViewMatrix(), camera->GetProjectionMatrix());
+
+		UpdateWorldSpaceTransforms();
 
 		if (Actor primaryCameraActor = GetPrimaryCameraActor())
 		{
@@ -657,8 +762,7 @@ namespace Vortex {
 			s_SceneRenderer.RenderScene(renderPacket);
 		}
 
-		// Update Components/Systems
-		OnComponentUpdate(delta);
+		// Update Systems
 		OnSystemUpdate(delta);
 
 		FlushPostUpdateQueue();
@@ -823,6 +927,7 @@ namespace Vortex {
 		}
 
 		ConvertToLocalSpace(actor);
+		MarkWorldSpaceTransformDirty(actor);
 	}
 
 	void Scene::UnparentActor(Actor actor, bool convertToWorldSpace)
@@ -847,6 +952,7 @@ namespace Vortex {
 		}
 
 		actor.SetParentUUID(0);
+		MarkWorldSpaceTransformDirty(actor);
 	}
 
 	void Scene::ActiveateChildren(Actor actor)
@@ -1058,17 +1164,14 @@ namespace Vortex {
 	{
 		VX_PROFILE_FUNCTION();
 
-		Math::mat4 transform(1.0f);
-
-		UUID parentUUID = actor.GetParentUUID();
-		Actor parent = TryGetActorWithUUID(parentUUID);
-
-		if (parent)
+		// The cached matrix is only stale if something in the parent chain
+		// was modified since the last call to UpdateWorldSpaceTransforms
+		if (IsWorldSpaceTransformCached(actor))
 		{
-			transform = GetWorldSpaceTransformMatrix(parent);
+			return actor.GetComponent<WorldTransformComponent>().Transform;
 		}
 
-		return transform * actor.GetTransform().GetTransform();
+		return CalculateWorldSpaceTransformMatrix(actor);
 	}
 
 	TransformComponent Scene::GetWorldSpaceTransform(Actor actor)
@@ -1081,81 +1184,341 @@ namespace Vortex {
 		return transformComponent;
 	}
 
-	// This is clearly a design flaw with the renderer, it should already have all of this data but yet we
-	// still need to go and gather it ourselves which is inefficient
-    SharedReference<SceneGeometry>& Scene::GetSceneMeshes()
+	const Math::mat4& Scene::GetCachedWorldSpaceTransformMatrix(Actor actor) const
 	{
-		if (m_SceneMeshes == nullptr)
+		return m_Registry.get<WorldTransformComponent>(actor).Transform;
+	}
+
+	TransformComponent Scene::GetCachedWorldSpaceTransform(Actor actor) const
+	{
+		TransformComponent transformComponent;
+		transformComponent.SetTransform(GetCachedWorldSpaceTransformMatrix(actor));
+		return transformComponent;
+	}
+
+	void Scene::UpdateWorldSpaceTransforms()
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (m_TransformHierarchyDirty)
 		{
-			m_SceneMeshes = SharedReference<SceneGeometry>::Create();
+			RebuildTransformHierarchy();
 		}
 
-		ClearSceneMeshes();
-
-		auto meshView = GetAllActorsWith<MeshRendererComponent>();
+		// Parents are always visited before their children so a changed parent
+		// has already been recomputed by the time its subtree is reached
+		const size_t nodeCount = m_TransformHierarchy.size();
 
-		for (const auto meshRenderer : meshView)
+		for (size_t i = 0; i < nodeCount; i++)
 		{
-			Actor actor{ meshRenderer, this };
-			const MeshRendererComponent& meshRendererComponent = actor.GetComponent<MeshRendererComponent>();
+			TransformHierarchyNode& node = m_TransformHierarchy[i];
+			auto [transformComponent, worldTransformComponent] = m_Registry.get<TransformComponent, WorldTransformComponent>(node.Actor);
 
-			// Skip if not active
-			if (!actor.IsActive())
-				continue;
+			const bool hasParent = node.ParentIndex != s_InvalidHierarchyIndex;
+			const bool parentChanged = hasParent && m_TransformHierarchy[node.ParentIndex].Changed;
 
-			if (!meshRendererComponent.Visible)
-				continue;
+			node.Changed = parentChanged || worldTransformComponent.IsLocalTransformDirty(transformComponent);
 
-			if (!meshRendererComponent.CastShadows)
+			if (!node.Changed)
 				continue;
 
-			AssetHandle meshHandle = meshRendererComponent.Mesh;
-			if (!AssetManager::IsHandleValid(meshHandle))
-				continue;
+			const Math::mat4 localTransform = transformComponent.GetTransform();
+
+			if (hasParent)
+			{
+				const TransformHierarchyNode& parentNode = m_TransformHierarchy[node.ParentIndex];
+				const WorldTransformComponent& parentWorldTransform = m_Registry.get<WorldTransformComponent>(parentNode.Actor);
+				worldTransformComponent.Transform = parentWorldTransform.Transform * localTransform;
+			}
+			else
+			{
+				worldTransformComponent.Transform = localTransform;
+			}
+
+			worldTransformComponent.LocalTranslation = transformComponent.Translation;
+			worldTransformComponent.LocalScale = transformComponent.Scale;
+			worldTransformComponent.Dirty = false;
+			transformComponent.SetDirty(false);
+		}
+
+		UpdateMeshBounds();
+	}
+
+	void Scene::UpdateMeshBounds()
+	{
+		VX_PROFILE_FUNCTION();
+
+		auto updateBounds = [this](entt::entity e, const WorldTransformComponent& worldTransform, AssetHandle meshHandle, auto getLocalBounds)
+		{
+			MeshBoundsComponent& meshBounds = m_Registry.get_or_emplace<MeshBoundsComponent>(e);
+
+			const bool meshChanged = meshBounds.Mesh != meshHandle;
+			const bool hasProxy = meshBounds.ProxyID != Math::DynamicAABBTree::NullNode;
+
+			const uint32_t hierarchyIndex = worldTransform.HierarchyIndex;
+			const bool transformChanged = hierarchyIndex == s_InvalidHierarchyIndex || m_TransformHierarchy[hierarchyIndex].Changed;
+
+			if (hasProxy && !meshChanged && !transformChanged)
+				return;
+
+			if (meshChanged || !hasProxy)
+			{
+				// The asset may not be loaded yet, try again next frame
+				if (!getLocalBounds(meshHandle, meshBounds.LocalBounds))
+				{
+					if (hasProxy)
+					{
+						m_MeshBoundsTree.DestroyProxy(meshBounds.ProxyID);
+						meshBounds.ProxyID = Math::DynamicAABBTree::NullNode;
+					}
+
+					meshBounds.Mesh = 0;
+					return;
+				}
+
+				meshBounds.Mesh = meshHandle;
+			}
+
+			meshBounds.WorldBounds = meshBounds.LocalBounds.Transform(worldTransform.Transform);
+
+			if (meshBounds.ProxyID == Math::DynamicAABBTree::NullNode)
+			{
+				meshBounds.ProxyID = m_MeshBoundsTree.CreateProxy(meshBounds.WorldBounds, (uint32_t)e);
+				return;
+			}
+
+			m_MeshBoundsTree.MoveProxy(meshBounds.ProxyID, meshBounds.WorldBounds);
+		};
+
+		auto meshView = m_Registry.view<WorldTransformComponent, MeshRendererComponent>();
+
+		for (const auto e : meshView)
+		{
+			auto [worldTransform, meshRenderer] = meshView.get<WorldTransformComponent, MeshRendererComponent>(e);
+
+			// Bounds come from the bind pose, animated meshes may extend past them slightly
+			updateBounds(e, worldTransform, meshRenderer.Mesh, [](AssetHandle handle, Math::AABB& bounds)
+			{
+				if (!AssetManager::IsHandleValid(handle))
+					return false;
+
+				SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(handle);
+				if (mesh == nullptr)
+					return false;
+
+				bounds = mesh->GetBoundingBox();
+				return true;
+			});
+		}
+
+		auto staticMeshView = m_Registry.view<WorldTransformComponent, StaticMeshRendererComponent>();
+
+		for (const auto e : staticMeshView)
+		{
+			auto [worldTransform, staticMeshRenderer] = staticMeshView.get<WorldTransformComponent, StaticMeshRendererComponent>(e);
+
+			updateBounds(e, worldTransform, staticMeshRenderer.StaticMesh, [](AssetHandle handle, Math::AABB& bounds)
+			{
+				if (!AssetManager::IsHandleValid(handle))
+					return false;
+
+				SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(handle);
+				if (staticMesh == nullptr)
+					return false;
+
+				bounds = staticMesh->GetBoundingBox();
+				return true;
+			});
+		}
+	}
+
+	uint32_t Scene::CullMeshes(const Math::Frustum& frustum, std::vector<entt::entity>& visibleActors) const
+	{
+		VX_PROFILE_FUNCTION();
+
+		const size_t firstVisible = visibleActors.size();
+
+		m_MeshBoundsTree.Query(frustum, [&](uint32_t userData)
+		{
+			const entt::entity e = (entt::entity)userData;
+
+			if (!m_Registry.valid(e))
+				return;
+
+			// Leaves are fattened, test the tight bounds before accepting the actor
+			const MeshBoundsComponent* meshBounds = m_Registry.try_get<MeshBoundsComponent>(e);
+			if (!meshBounds || !frustum.Intersects(meshBounds->WorldBounds))
+				return;
+
+			visibleActors.push_back(e);
+		});
+
+		const uint32_t visibleCount = (uint32_t)(visibleActors.size() - firstVisible);
+		return m_MeshBoundsTree.GetProxyCount() - visibleCount;
+	}
+
+	Math::mat4 Scene::CalculateWorldSpaceTransformMatrix(Actor actor)
+	{
+		VX_PROFILE_FUNCTION();
+
+		Math::mat4 transform(1.0f);
+
+		UUID parentUUID = actor.GetParentUUID();
+		Actor parent = TryGetActorWithUUID(parentUUID);
+
+		if (parent)
+		{
+			transform = CalculateWorldSpaceTransformMatrix(parent);
+		}
+
+		return transform * actor.GetTransform().GetTransform();
+	}
+
+	bool Scene::IsWorldSpaceTransformCached(Actor actor) const
+	{
+		if (m_TransformHierarchyDirty)
+			return false;
+
+		if (!m_Registry.all_of<WorldTransformComponent>(actor))
+			return false;
+
+		uint32_t index = m_Registry.get<WorldTransformComponent>(actor).HierarchyIndex;
+
+		// Walk up the chain using the flattened hierarchy, no uuid lookups required
+		while (index != s_InvalidHierarchyIndex)
+		{
+			if (index >= m_TransformHierarchy.size())
+				return false;
+
+			const TransformHierarchyNode& node = m_TransformHierarchy[index];
+			const auto [transformComponent, worldTransformComponent] = m_Registry.get<TransformComponent, WorldTransformComponent>(node.Actor);
 
-			SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
-			if (!mesh)
+			if (worldTransformComponent.IsLocalTransformDirty(transformComponent))
+				return false;
+
+			index = node.ParentIndex;
+		}
+
+		return true;
+	}
+
+	void Scene::MarkWorldSpaceTransformDirty(Actor actor)
+	{
+		if (!actor.HasComponent<WorldTransformComponent>())
+			return;
+
+		// the subtree is picked up by the next update through the parent's changed flag
+		actor.GetComponent<WorldTransformComponent>().Dirty = true;
+	}
+
+	void Scene::RebuildTransformHierarchy()
+	{
+		VX_PROFILE_FUNCTION();
+
+		m_TransformHierarchy.clear();
+
+		auto view = m_Registry.view<IDComponent, HierarchyComponent, WorldTransformComponent>();
+
+		// Roots first
+		for (const auto e : view)
+		{
+			const auto [hierarchyComponent, worldTransformComponent] = view.get<HierarchyComponent, WorldTransformComponent>(e);
+			worldTransformComponent.HierarchyIndex = s_InvalidHierarchyIndex;
+
+			if (hierarchyComponent.ParentUUID != 0 && m_ActorMap.contains(hierarchyComponent.ParentUUID))
 				continue;
 
-			m_SceneMeshes->MeshEntities.push_back(actor);
+			TransformHierarchyNode& node = m_TransformHierarchy.emplace_back();
+			node.Actor = e;
+		}
+
+		// Breadth first so that every parent precedes its children,
+		// the vector grows while we iterate so no references are held across the push
+		for (size_t i = 0; i < m_TransformHierarchy.size(); i++)
+		{
+			const entt::entity e = m_TransformHierarchy[i].Actor;
+			const uint32_t parentIndex = (uint32_t)i;
+
+			m_Registry.get<WorldTransformComponent>(e).HierarchyIndex = parentIndex;
+
+			const UUID parentUUID = m_Registry.get<IDComponent>(e).ID;
+			const std::vector<UUID>& children = m_Registry.get<HierarchyComponent>(e).Children;
+
+			for (UUID childUUID : children)
+			{
+				Actor child = TryGetActorWithUUID(childUUID);
+				if (!child || !view.contains(child))
+					continue;
+
+				// guard against stale child lists
+				if (view.get<HierarchyComponent>(child).ParentUUID != parentUUID)
+					continue;
+
+				TransformHierarchyNode& node = m_TransformHierarchy.emplace_back();
+				node.Actor = child;
+				node.ParentIndex = parentIndex;
+			}
+		}
+
+		m_TransformHierarchyDirty = false;
+	}
+
+	// This is clearly a design flaw with the renderer, it should already have all of this data but yet we
+	// still need to go and gather it ourselves which is inefficient
+	SharedReference<SceneGeometry>& Scene::GetSceneMeshes()
+	{
+		if (m_SceneMeshes == nullptr)
+		{
+			m_SceneMeshes = SharedReference<SceneGeometry>::Create();
+		}
+
+		ClearSceneMeshes();
 
-			m_SceneMeshes->Meshes.push_back(mesh);
+		auto meshView = GetAllActorsWith<MeshRendererComponent>();
 
-			const Math::mat4 worldSpaceTransform = GetWorldSpaceTransformMatrix(actor);
-			m_SceneMeshes->WorldSpaceMeshTransforms.push_back(worldSpaceTransform);
+		for (const auto meshRenderer : meshView)
+		{
+			AddSceneMesh(Actor{ meshRenderer, this });
 		}
 
 		auto staticMeshView = GetAllActorsWith<StaticMeshRendererComponent>();
 
 		for (const auto staticMeshRenderer : staticMeshView)
 		{
-			Actor actor{ staticMeshRenderer, this };
-			const StaticMeshRendererComponent& staticMeshRendererComponent = actor.GetComponent<StaticMeshRendererComponent>();
-
-			// Skip if not active
-			if (!actor.IsActive())
-				continue;
+			AddSceneStaticMesh(Actor{ staticMeshRenderer, this });
+		}
 
-			if (!staticMeshRendererComponent.Visible)
-				continue;
+		return m_SceneMeshes;
+	}
 
-			if (!staticMeshRendererComponent.CastShadows)
-				continue;
+	SharedReference<SceneGeometry>& Scene::GetSceneMeshes(const Math::Frustum& frustum)
+	{
+		if (m_SceneMeshes == nullptr)
+		{
+			m_SceneMeshes = SharedReference<SceneGeometry>::Create();
+		}
 
-			AssetHandle staticMeshHandle = staticMeshRendererComponent.StaticMesh;
-			if (!AssetManager::IsHandleValid(staticMeshHandle))
-				continue;
+		ClearSceneMeshes();
 
-			SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(staticMeshHandle);
-			if (!staticMesh)
-				continue;
+		std::vector<entt::entity> visibleActors;
+		const uint32_t culledCount = CullMeshes(frustum, visibleActors);
 
-			m_SceneMeshes->StaticMeshes.push_back(staticMesh);
+		for (const auto e : visibleActors)
+		{
+			Actor actor{ e, this };
 
-			const Math::mat4 worldSpaceTransform = GetWorldSpaceTransformMatrix(actor);
-			m_SceneMeshes->WorldSpaceStaticMeshTransforms.push_back(worldSpaceTransform);
+			if (m_Registry.all_of<MeshRendererComponent>(e))
+			{
+				AddSceneMesh(actor);
+			}
+			else if (m_Registry.all_of<StaticMeshRendererComponent>(e))
+			{
+				AddSceneStaticMesh(actor);
+			}
 		}
 
+		Renderer::AddToShadowCullingStats((uint32_t)visibleActors.size(), culledCount);
+
 		return m_SceneMeshes;
 	}
 
@@ -1203,74 +1566,74 @@ namespace Vortex {
 		}
 	}
 
-	void Scene::OnMeshUpdateRuntime()
+	void Scene::OnAnimatorUpdateRuntime(TimeStep delta, const Math::mat4& cameraView, const Math::mat4& cameraProjection, bool hasCamera)
 	{
 		VX_PROFILE_FUNCTION();
 
+		struct AnimatorUpdate
 		{
-			auto view = GetAllActorsWith<MeshRendererComponent>();
+			Animator* Animator = nullptr;
+			AnimationLOD LOD;
+			bool EvaluatePose = false;
+		};
 
-			for (const auto e : view)
-			{
-				Actor actor{ e, this };
-				MeshRendererComponent& meshRendererComponent = actor.GetComponent<MeshRendererComponent>();
+		std::vector<AnimatorUpdate> animatorUpdates;
+		std::unordered_map<Animator*, size_t> animatorIndices;
 
-				AssetHandle meshHandle = meshRendererComponent.Mesh;
-				if (!AssetManager::IsHandleValid(meshHandle))
-					continue;
+		const Math::Frustum cameraFrustum(cameraProjection * cameraView);
+		const Math::vec3 cameraPosition = Math::vec3(Math::Inverse(cameraView)[3]);
 
-				SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
-				if (!mesh)
-					continue;
-
-				mesh->OnUpdate((int)(entt::entity)e);
-			}
-		}
+		auto view = GetAllActorsWith<AnimatorComponent, AnimationComponent, MeshRendererComponent>();
 
+		for (const auto e : view)
 		{
-			auto view = GetAllActorsWith<StaticMeshRendererComponent>();
-
-			for (const auto e : view)
-			{
-				Actor actor{ e, this };
-				StaticMeshRendererComponent& staticMeshRendererComponent = actor.GetComponent<StaticMeshRendererComponent>();
+			SharedRef<Animator> animator = view.get<AnimatorComponent>(e).Animator;
 
-				AssetHandle staticMeshHandle = staticMeshRendererComponent.StaticMesh;
-				if (!AssetManager::IsHandleValid(staticMeshHandle))
-					continue;
+			if (!animator)
+				continue;
 
-				SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(staticMeshHandle);
-				if (!staticMesh)
-					continue;
+			if (!animator->IsPlaying())
+				continue;
 
-				SharedReference<MaterialTable> materialTable = staticMeshRendererComponent.Materials;
-				if (!materialTable)
-					continue;
+			AnimationLOD lod;
+			bool visible = true;
 
-				staticMesh->OnUpdate(materialTable, (int)(entt::entity)e);
+			// Bounds may not exist yet if the mesh hasn't loaded, animate at full rate until they do.
+			// An identity camera would cull everything outside the unit cube, so no camera means no culling
+			const MeshBoundsComponent* meshBounds = m_Registry.try_get<MeshBoundsComponent>(e);
+			if (hasCamera && meshBounds && meshBounds->ProxyID != Math::DynamicAABBTree::NullNode)
+			{
+				visible = cameraFrustum.Intersects(meshBounds->WorldBounds);
+				lod = Utils::SelectAnimationLOD(meshBounds->WorldBounds, cameraPosition, cameraProjection);
 			}
-		}
-	}
 
-	void Scene::OnAnimatorUpdateRuntime(TimeStep delta)
-	{
-		VX_PROFILE_FUNCTION();
+			// Stagger reduced rate animators so they don't all land on the same frame,
+			// off screen animators only advance time so they're in sync when they come back
+			const bool evaluatePose = visible && (m_AnimationFrameIndex + (uint32_t)e) % lod.UpdateInterval == 0;
 
-		auto view = GetAllActorsWith<AnimatorComponent, AnimationComponent, MeshRendererComponent>();
+			// Actors can share an animator, so each animator is only ever touched by one job
+			auto [it, inserted] = animatorIndices.try_emplace(animator.get(), animatorUpdates.size());
+			if (inserted)
+			{
+				animatorUpdates.push_back({ animator.get(), lod, evaluatePose });
+				continue;
+			}
 
-		for (const auto e : view)
-		{
-			Actor actor{ e, this };
-			SharedRef<Animator> animator = actor.GetComponent<AnimatorComponent>().Animator;
+			AnimatorUpdate& update = animatorUpdates[it->second];
+			update.LOD.MaxSampledDepth = Math::Max(update.LOD.MaxSampledDepth, lod.MaxSampledDepth);
+			update.EvaluatePose |= evaluatePose;
+		}
 
-			if (!animator)
-				continue;
+		m_AnimationFrameIndex++;
 
-			if (!animator->IsPlaying())
-				continue;
+		// Each animator only writes to its own pose, the shared animation data is read only
+		JobSystem::ParallelFor((uint32_t)animatorUpdates.size(), [&animatorUpdates, delta](uint32_t index)
+		{
+			const AnimatorUpdate& update = animatorUpdates[index];
 
-			animator->UpdateAnimation(delta);
-		}
+			update.Animator->SetMaxSampledDepth(update.LOD.MaxSampledDepth);
+			update.Animator->UpdateAnimation(delta, update.EvaluatePose);
+		});
 	}
 
 	void Scene::ClearSceneMeshes()
@@ -1282,12 +1645,69 @@ namespace Vortex {
 		m_SceneMeshes->WorldSpaceStaticMeshTransforms.clear();
 	}
 
+	void Scene::AddSceneMesh(Actor actor)
+	{
+		const MeshRendererComponent& meshRendererComponent = actor.GetComponent<MeshRendererComponent>();
+
+		// Skip if not active
+		if (!actor.IsActive())
+			return;
+
+		if (!meshRendererComponent.Visible)
+			return;
+
+		if (!meshRendererComponent.CastShadows)
+			return;
+
+		AssetHandle meshHandle = meshRendererComponent.Mesh;
+		if (!AssetManager::IsHandleValid(meshHandle))
+			return;
+
+		SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
+		if (!mesh)
+			return;
+
+		m_SceneMeshes->MeshEntities.push_back(actor);
+
+		m_SceneMeshes->Meshes.push_back(mesh);
+
+		const Math::mat4& worldSpaceTransform = actor.GetComponent<WorldTransformComponent>().Transform;
+		m_SceneMeshes->WorldSpaceMeshTransforms.push_back(worldSpaceTransform);
+	}
+
+	void Scene::AddSceneStaticMesh(Actor actor)
+	{
+		const StaticMeshRendererComponent& staticMeshRendererComponent = actor.GetComponent<StaticMeshRendererComponent>();
+
+		// Skip if not active
+		if (!actor.IsActive())
+			return;
+
+		if (!staticMeshRendererComponent.Visible)
+			return;
+
+		if (!staticMeshRendererComponent.CastShadows)
+			return;
+
+		AssetHandle staticMeshHandle = staticMeshRendererComponent.StaticMesh;
+		if (!AssetManager::IsHandleValid(staticMeshHandle))
+			return;
+
+		SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(staticMeshHandle);
+		if (!staticMesh)
+			return;
+
+		m_SceneMeshes->StaticMeshes.push_back(staticMesh);
+
+		const Math::mat4& worldSpaceTransform = actor.GetComponent<WorldTransformComponent>().Transform;
+		m_SceneMeshes->WorldSpaceStaticMeshTransforms.push_back(worldSpaceTransform);
+	}
+
 	void Scene::FlushPreUpdateQueue()
 	{
 		VX_PROFILE_FUNCTION();
 
 		m_PreUpdateFunctionQueue.execute();
-		m_PreUpdateFunctionQueue.clear();
 	}
 
 	void Scene::FlushPostUpdateQueue()
@@ -1295,12 +1715,6 @@ namespace Vortex {
 		VX_PROFILE_FUNCTION();
 
 		m_PostUpdateFunctionQueue.execute();
-		m_PostUpdateFunctionQueue.clear();
-	}
-
-	void Scene::OnComponentUpdate(TimeStep delta)
-	{
-		OnMeshUpdateRuntime();
 	}
 
 	void Scene::OnSystemUpdate(TimeStep delta)
@@ -1386,6 +1800,8 @@ namespace Vortex {
 		m_ActorMap.erase(it->first);
 		m_Registry.destroy(actor);
 
+		InvalidateTransformHierarchy();
+
 		SortActors();
 	}
 
@@ -1427,6 +1843,11 @@ namespace Vortex {
 		}
 	}
 
+	void Scene::OnHierarchyChanged(entt::registry& registry, entt::entity e)
+	{
+		InvalidateTransformHierarchy();
+	}
+
 	void Scene::OnCameraConstruct(entt::registry& registry, entt::entity e)
 	{
 		VX_PROFILE_FUNCTION();
@@ -1458,7 +1879,7 @@ namespace Vortex {
 		{
 			DefaultMesh::StaticMeshType staticMeshType = (DefaultMesh::StaticMeshType)staticMeshComponent.Type;
 
-			staticMeshComponent.StaticMesh = Project::GetEditorAssetManager()->GetDefaultStaticMesh(staticMeshType);
+			staticMeshComponent.StaticMesh = DefaultMesh::DefaultStaticMeshes[(size_t)staticMeshType];
 
 			SharedReference<MaterialTable> materialTable = staticMeshComponent.Materials;
 
@@ -1470,6 +1891,21 @@ namespace Vortex {
 		}
 	}
 
+	void Scene::OnMeshRendererDestruct(entt::registry& registry, entt::entity e)
+	{
+		registry.remove<MeshBoundsComponent>(e);
+	}
+
+	void Scene::OnMeshBoundsDestruct(entt::registry& registry, entt::entity e)
+	{
+		const MeshBoundsComponent& meshBounds = registry.get<MeshBoundsComponent>(e);
+
+		if (meshBounds.ProxyID == Math::DynamicAABBTree::NullNode)
+			return;
+
+		m_MeshBoundsTree.DestroyProxy(meshBounds.ProxyID);
+	}
+
 	void Scene::OnParticleEmitterConstruct(entt::registry& registry, entt::entity e)
 	{
 		VX_PROFILE_FUNCTION();
@@ -1584,6 +2020,17 @@ namespace Vortex {
 		// TODO
 	}
 
+	void Scene::OnRigidBody2DConstruct(entt::registry& registry, entt::entity e)
+	{
+		VX_PROFILE_FUNCTION();
+
+		if (!m_IsSimulating)
+			return;
+
+		Actor actor = { e, this };
+		Physics2D::QueueBodyCreation(actor);
+	}
+
 	SharedReference<Scene> Scene::Copy(SharedReference<Scene>& source)
 	{
 		VX_PROFILE_FUNCTION();
@@ -8,6 +8,9 @@
 
 #include "Vortex/Project/ProjectType.h"
 
+#include "Vortex/Math/AABBTree.h"
+#include "Vortex/Math/Frustum.h"
+
 #include "Vortex/Scene/Components.h"
 
 #include "Vortex/Renderer/Framebuffer.h"
@@ -63,6 +66,7 @@ namespace Vortex {
 
 		void OnPhysicsSimulationStart();
 		void OnPhysicsSimulationUpdate(TimeStep delta);
+		void OnPhysicsSimulationFetchResults();
 		void OnPhysicsSimulationStop();
 
 		void OnUpdateRuntime(TimeStep delta);
@@ -123,7 +127,19 @@ namespace Vortex {
 		Math::mat4 GetWorldSpaceTransformMatrix(Actor actor);
 		TransformComponent GetWorldSpaceTransform(Actor actor);
 
+		// Reads the result of the last UpdateWorldSpaceTransforms without walking the parent chain,
+		// batch readers refresh the cache once up front instead of validating every actor
+		const Math::mat4& GetCachedWorldSpaceTransformMatrix(Actor actor) const;
+		TransformComponent GetCachedWorldSpaceTransform(Actor actor) const;
+
+		void UpdateWorldSpaceTransforms();
+
 		SharedReference<SceneGeometry>& GetSceneMeshes();
+		// Only gathers meshes whose world bounds intersect the frustum
+		SharedReference<SceneGeometry>& GetSceneMeshes(const Math::Frustum& frustum);
+
+		// Collects actors with a mesh whose world bounds intersect the frustum, returns the number culled
+		uint32_t CullMeshes(const Math::Frustum& frustum, std::vector<entt::entity>& visibleActors) const;
 
 		template <typename TComponent>
 		VX_FORCE_INLINE void CopyComponentIfExists(entt::entity dst, entt::registry& dstRegistry, entt::entity src) const
@@ -153,15 +169,24 @@ namespace Vortex {
 		void FlushPreUpdateQueue();
 		void FlushPostUpdateQueue();
 
-		void OnComponentUpdate(TimeStep delta);
 		void OnSystemUpdate(TimeStep delta);
 
 		void DestroyActorInternal(Actor actor, bool excludeChildren = false);
 
+		Math::mat4 CalculateWorldSpaceTransformMatrix(Actor actor);
+		bool IsWorldSpaceTransformCached(Actor actor) const;
+		void MarkWorldSpaceTransformDirty(Actor actor);
+		VX_FORCE_INLINE void InvalidateTransformHierarchy() { m_TransformHierarchyDirty = true; }
+		void RebuildTransformHierarchy();
+		void UpdateMeshBounds();
+
 		void OnUpdateActorTimers(TimeStep delta);
 
+		void OnHierarchyChanged(entt::registry& registry, entt::entity e);
 		void OnCameraConstruct(entt::registry& registry, entt::entity e);
 		void OnStaticMeshConstruct(entt::registry& registry, entt::entity e);
+		void OnMeshRendererDestruct(entt::registry& registry, entt::entity e);
+		void OnMeshBoundsDestruct(entt::registry& registry, entt::entity e);
 		void OnParticleEmitterConstruct(entt::registry& registry, entt::entity e);
 		void OnParticleEmitterDestruct(entt::registry& registry, entt::entity e);
 		void OnTextMeshConstruct(entt::registry& registry, entt::entity e);
@@ -171,15 +196,18 @@ namespace Vortex {
 		void OnAudioSourceDestruct(entt::registry& registry, entt::entity e);
 		void OnAudioListenerConstruct(entt::registry& registry, entt::entity e);
 		void OnAudioListenerDestruct(entt::registry& registry, entt::entity e);
+		void OnRigidBody2DConstruct(entt::registry& registry, entt::entity e);
 
 		void ResizePrimaryCamera();
 
 		void StopAnimatorsRuntime();
 
-		void OnMeshUpdateRuntime();
-		void OnAnimatorUpdateRuntime(TimeStep delta);
+		// Without a camera every playing animator is evaluated at full rate
+		void OnAnimatorUpdateRuntime(TimeStep delta, const Math::mat4& cameraView, const Math::mat4& cameraProjection, bool hasCamera = true);
 
 		void ClearSceneMeshes();
+		void AddSceneMesh(Actor actor);
+		void AddSceneStaticMesh(Actor actor);
 
 	private:
 		SharedReference<Framebuffer> m_TargetFramebuffer = nullptr;
@@ -193,6 +221,25 @@ namespace Vortex {
 		using ActorMap = std::unordered_map<UUID, Actor>;
 		ActorMap m_ActorMap;
 
+		static constexpr uint32_t s_InvalidHierarchyIndex = std::numeric_limits<uint32_t>::max();
+
+		// Flattened actor hierarchy in parent-before-child order, rebuilt when parenting changes
+		struct TransformHierarchyNode
+		{
+			entt::entity Actor = entt::null;
+			uint32_t ParentIndex = s_InvalidHierarchyIndex;
+			bool Changed = false;
+		};
+
+		std::vector<TransformHierarchyNode> m_TransformHierarchy;
+		bool m_TransformHierarchyDirty = true;
+
+		// World space mesh bounds, kept in sync with the transform hierarchy
+		Math::DynamicAABBTree m_MeshBoundsTree;
+
+		// Used to stagger animators that update at a reduced rate
+		uint32_t m_AnimationFrameIndex = 0;
+
 		std::unordered_map<UUID, std::vector<Timer>> m_Timers;
 		std::vector<Timer> m_FinishedTimers;
 
@@ -1,7 +1,7 @@
 #include "vxpch.h"
 #include "SceneRenderer.h"
 
-#include "Vortex/Core/Thread.h"
+#include "Vortex/Core/JobSystem.h"
 
 #include "Vortex/Asset/AssetManager.h"
 
@@ -21,6 +21,7 @@
 #include "Vortex/Renderer/Mesh.h"
 #include "Vortex/Renderer/StaticMesh.h"
 #include "Vortex/Renderer/Framebuffer.h"
+#include "Vortex/Renderer/RenderQueue.h"
 #include "Vortex/Renderer/ParticleSystem/ParticleEmitter.h"
 
 #include "Vortex/Editor/EditorCamera.h"
@@ -31,6 +32,8 @@ namespace Vortex {
 	static AssetHandle s_EnvironmentHandle = 0;
 	static SharedReference<Skybox> s_EmptyEnvironment = nullptr;
 
+	static constexpr uint32_t s_InvalidBoneOffset = std::numeric_limits<uint32_t>::max();
+
 	void SceneRenderer::RenderScene(const SceneRenderPacket& renderPacket)
 	{
 		VX_CORE_ASSERT(renderPacket.Scene, "Invalid Scene!");
@@ -75,11 +78,13 @@ namespace Vortex {
 	{
 		VX_PROFILE_FUNCTION();
 
-		std::map<float, Actor> sortedGeometry;
+		// Gathering touches the asset manager so it stays on this thread, the sort overlaps the passes below
+		BuildRenderQueue(renderPacket);
 
-		Thread sortThread([&]() {
-			SortMeshGeometry(renderPacket, sortedGeometry);
-		});
+		JobCounter sortCounter;
+		JobSystem::Submit([&]() {
+			SortRenderQueue();
+		}, &sortCounter);
 
 		const Math::mat4* view = (const Math::mat4*)&renderPacket.PrimaryCameraViewMatrix;
 		const Math::mat4* projection = (const Math::mat4*)&renderPacket.PrimaryCameraProjectionMatrix;
@@ -108,11 +113,9 @@ namespace Vortex {
 
 		EmissiveMeshPass(renderPacket);
 
-		if (sortThread.Joinable()) {
-			sortThread.Join();
-		}
+		JobSystem::Wait(sortCounter);
 
-		GeometryPass(renderPacket, sortedGeometry);
+		GeometryPass(renderPacket);
 
 		EndScene();
 	}
@@ -167,12 +170,12 @@ namespace Vortex {
 
 		// Sprite Pass 2D
 		{
-			auto view = scene->GetAllActorsWith<TransformComponent, SpriteRendererComponent>();
+			auto view = scene->GetAllActorsWith<WorldTransformComponent, SpriteRendererComponent>();
 
 			for (const auto e : view)
 			{
 				Actor actor{ e, scene };
-				const auto [transformComponent, spriteRendererComponent] = view.get<TransformComponent, SpriteRendererComponent>(e);
+				const auto [worldTransformComponent, spriteRendererComponent] = view.get<WorldTransformComponent, SpriteRendererComponent>(e);
 
 				if (!actor.IsActive())
 					continue;
@@ -187,7 +190,7 @@ namespace Vortex {
 					texture = AssetManager::GetAsset<Texture2D>(textureHandle);
 
 				Renderer2D::DrawSprite(
-					scene->GetWorldSpaceTransformMatrix(actor),
+					worldTransformComponent.Transform,
 					spriteRendererComponent,
 					texture,
 					(int)(entt::entity)e
@@ -197,12 +200,12 @@ namespace Vortex {
 
 		// Circle Pass 2D
 		{
-			auto view = scene->GetAllActorsWith<TransformComponent, CircleRendererComponent>();
+			auto view = scene->GetAllActorsWith<WorldTransformComponent, CircleRendererComponent>();
 
 			for (const auto e : view)
 			{
 				Actor actor{ e, scene };
-				const auto [transformComponent, circleRendererComponent] = view.get<TransformComponent, CircleRendererComponent>(e);
+				const auto [worldTransformComponent, circleRendererComponent] = view.get<WorldTransformComponent, CircleRendererComponent>(e);
 
 				if (!actor.IsActive())
 					continue;
@@ -211,7 +214,7 @@ namespace Vortex {
 					continue;
 
 				Renderer2D::DrawCircle(
-					scene->GetWorldSpaceTransformMatrix(actor),
+					worldTransformComponent.Transform,
 					circleRendererComponent.Color,
 					circleRendererComponent.Thickness,
 					circleRendererComponent.Fade,
@@ -244,33 +247,31 @@ namespace Vortex {
 			if (!particleEmitter)
 				continue;
 
-			const std::vector<Particle>& particles = particleEmitter->GetParticles();
-			const bool random = particleEmitter->GetProperties().GenerateRandomColors;
-
-			// Render the particles in reverse to blend correctly
-			for (auto it = particles.crbegin(); it != particles.crend(); it++)
-			{
-				const Particle& particle = *it;
+			const ParticlePool& particles = particleEmitter->GetParticles();
+			const ParticleEmitterProperties& emitterProperties = particleEmitter->GetProperties();
+			const bool random = emitterProperties.GenerateRandomColors;
 
-				if (!particle.Active)
-					continue;
+			// Only live particles are stored at the front of the pool, oldest first so newer particles blend on top
+			const uint32_t liveCount = particles.GetLiveCount();
 
-				const float particleLife = particle.LifeRemaining / particle.LifeTime;
-				const Math::vec2 size = Math::Lerp(particle.SizeEnd, particle.SizeBegin, particleLife);
+			for (uint32_t i = 0; i < liveCount; i++)
+			{
+				const float particleLife = particles.LifeRemaining[i] / particles.LifeTime[i];
+				const Math::vec2 size = Math::Lerp(emitterProperties.SizeEnd, particles.SizeBegin[i], particleLife);
 				Math::vec4 color;
 
 				if (random)
 				{
-					color = particle.RandomColor;
+					color = particles.RandomColor[i];
 				}
 				else
 				{
-					color = Math::Lerp(particle.ColorEnd, particle.ColorBegin, particleLife);
+					color = Math::Lerp(emitterProperties.ColorEnd, emitterProperties.ColorBegin, particleLife);
 				}
 
 				Renderer2D::DrawQuadBillboard(
 					cameraView,
-					particle.Position,
+					Math::vec3(particles.PositionX[i], particles.PositionY[i], particles.PositionZ[i]),
 					size,
 					color,
 					(int)(entt::entity)e
@@ -285,7 +286,7 @@ namespace Vortex {
 
 		Scene* scene = renderPacket.Scene;
 
-		auto view = scene->GetAllActorsWith<TransformComponent, TextMeshComponent>();
+		auto view = scene->GetAllActorsWith<WorldTransformComponent, TextMeshComponent>();
 
 		RendererAPI::TriangleCullMode originalCullMode = Renderer2D::GetCullMode();
 		Renderer2D::SetCullMode(RendererAPI::TriangleCullMode::None);
@@ -293,7 +294,7 @@ namespace Vortex {
 		for (const auto e : view)
 		{
 			Actor actor{ e, scene };
-			const auto [transformComponent, textMeshComponent] = view.get<TransformComponent, TextMeshComponent>(e);
+			const auto [worldTransformComponent, textMeshComponent] = view.get<WorldTransformComponent, TextMeshComponent>(e);
 
 			if (!actor.IsActive())
 				continue;
@@ -313,7 +314,7 @@ namespace Vortex {
 				font = Font::GetDefaultFont();
 			}
 
-			const Math::mat4 worldSpaceTransform = scene->GetWorldSpaceTransformMatrix(actor);
+			const Math::mat4& worldSpaceTransform = worldTransformComponent.Transform;
 
 			Renderer2D::DrawString(
 				textMeshComponent.TextString,
@@ -385,21 +386,21 @@ namespace Vortex {
 
 		// Camera Gizmos
 		{
-			auto view = scene->GetAllActorsWith<TransformComponent, CameraComponent>();
+			auto view = scene->GetAllActorsWith<WorldTransformComponent, CameraComponent>();
 
 			for (const auto e : view)
 			{
 				Actor actor{ e, scene };
-				const auto [transformComponent, cameraComponent] = view.get<TransformComponent, CameraComponent>(e);
+				const auto [worldTransformComponent, cameraComponent] = view.get<WorldTransformComponent, CameraComponent>(e);
 
 				if (!actor.IsActive())
 					continue;
 
-				const TransformComponent& transform = scene->GetWorldSpaceTransform(actor);
+				const Math::vec3 translation = worldTransformComponent.GetTranslation();
 
 				Renderer2D::DrawQuadBillboard(
 					cameraView,
-					transform.Translation,
+					translation,
 					EditorResources::CameraIcon,
 					gizmoSize,
 					gizmoColor,
@@ -410,17 +411,17 @@ namespace Vortex {
 
 		// Light Gizmos
 		{
-			auto view = scene->GetAllActorsWith<TransformComponent, LightSourceComponent>();
+			auto view = scene->GetAllActorsWith<WorldTransformComponent, LightSourceComponent>();
 
 			for (const auto e : view)
 			{
 				Actor actor{ e, scene };
-				const auto [transformComponent, lightSourceComponent] = view.get<TransformComponent, LightSourceComponent>(e);
+				const auto [worldTransformComponent, lightSourceComponent] = view.get<WorldTransformComponent, LightSourceComponent>(e);
 
 				if (!actor.IsActive())
 					continue;
 
-				const TransformComponent& transform = scene->GetWorldSpaceTransform(actor);
+				const Math::vec3 translation = worldTransformComponent.GetTranslation();
 
 				static const SharedReference<Texture2D> icons[3] =
 				{
@@ -431,7 +432,7 @@ namespace Vortex {
 
 				Renderer2D::DrawQuadBillboard(
 					cameraView,
-					transform.Translation,
+					translation,
 					icons[(uint32_t)lightSourceComponent.Type],
 					gizmoSize,
 					gizmoColor,
@@ -442,21 +443,21 @@ namespace Vortex {
 
 		// Audio Gizmos
 		{
-			auto view = scene->GetAllActorsWith<TransformComponent, AudioSourceComponent>();
+			auto view = scene->GetAllActorsWith<WorldTransformComponent, AudioSourceComponent>();
 
 			for (const auto e : view)
 			{
 				Actor actor{ e, scene };
-				const auto [transformComponent, audioSourceComponent] = view.get<TransformComponent, AudioSourceComponent>(e);
+				const auto [worldTransformComponent, audioSourceComponent] = view.get<WorldTransformComponent, AudioSourceComponent>(e);
 
 				if (!actor.IsActive())
 					continue;
 
-				const TransformComponent& transform = scene->GetWorldSpaceTransform(actor);
+				const Math::vec3 translation = worldTransformComponent.GetTranslation();
 
 				Renderer2D::DrawQuadBillboard(
 					cameraView,
-					transform.Translation,
+					translation,
 					EditorResources::AudioSourceIcon,
 					gizmoSize,
 					gizmoColor,
@@ -537,12 +538,12 @@ namespace Vortex {
 
 		Scene* scene = renderPacket.Scene;
 
-		auto lightSourceView = scene->GetAllActorsWith<TransformComponent, LightSourceComponent>();
+		auto lightSourceView = scene->GetAllActorsWith<WorldTransformComponent, LightSourceComponent>();
 
 		for (const auto e : lightSourceView)
 		{
 			Actor actor{ e, scene };
-			const LightSourceComponent& lsc = actor.GetComponent<LightSourceComponent>();
+			const auto [worldTransformComponent, lsc] = lightSourceView.get<WorldTransformComponent, LightSourceComponent>(e);
 
 			if (!actor.IsActive())
 				continue;
@@ -550,7 +551,8 @@ namespace Vortex {
 			if (!lsc.Visible)
 				continue;
 
-			TransformComponent transform = scene->GetWorldSpaceTransform(actor);
+			TransformComponent transform;
+			transform.SetTransform(worldTransformComponent.Transform);
 
 			Renderer::RenderLightSource(transform, lsc);
 		}
@@ -562,7 +564,7 @@ namespace Vortex {
 
 		Scene* scene = renderPacket.Scene;
 
-		auto meshView = scene->GetAllActorsWith<TransformComponent, MeshRendererComponent>();
+		auto meshView = scene->GetAllActorsWith<WorldTransformComponent, MeshRendererComponent>();
 
 		for (const auto e : meshView)
 		{
@@ -579,7 +581,7 @@ namespace Vortex {
 			VX_CORE_ASSERT(materialTable, "invalid material table!");
 			const uint32_t materialCount = materialTable->GetMaterialCount();
 
-			const Math::vec3 translation = scene->GetWorldSpaceTransform(actor).Translation;
+			const Math::vec3 translation = actor.GetComponent<WorldTransformComponent>().GetTranslation();
 
 			for (uint32_t i = 0; i < materialCount; i++)
 			{
@@ -604,7 +606,7 @@ namespace Vortex {
 			}
 		}
 
-		auto staticMeshView = scene->GetAllActorsWith<TransformComponent, StaticMeshRendererComponent>();
+		auto staticMeshView = scene->GetAllActorsWith<WorldTransformComponent, StaticMeshRendererComponent>();
 
 		for (const auto e : staticMeshView)
 		{
@@ -621,7 +623,7 @@ namespace Vortex {
 			VX_CORE_ASSERT(materialTable, "invalid material table!");
 			const uint32_t materialCount = materialTable->GetMaterialCount();
 
-			const Math::vec3 translation = scene->GetWorldSpaceTransform(actor).Translation;
+			const Math::vec3 translation = actor.GetComponent<WorldTransformComponent>().GetTranslation();
 
 			for (uint32_t i = 0; i < materialCount; i++)
 			{
@@ -647,249 +649,310 @@ namespace Vortex {
 		}
 	}
 
-	void SceneRenderer::SortMeshGeometry(const SceneRenderPacket& renderPacket, std::map<float, Actor>& sortedGeometry)
+	void SceneRenderer::BuildRenderQueue(const SceneRenderPacket& renderPacket)
 	{
 		VX_PROFILE_FUNCTION();
 
-		InstrumentationTimer timer("Pre-Geo-Pass Sort");
+		m_RenderQueue.Clear();
+
 		Scene* scene = renderPacket.Scene;
 
-		// Sort All Meshes by distance from camera
+		Math::vec3 cameraPosition = renderPacket.PrimaryCameraWorldSpaceTranslation;
+		if (renderPacket.IsEditorScene)
 		{
-			auto meshRendererView = scene->GetAllActorsWith<TransformComponent, MeshRendererComponent>();
-			uint32_t i = 0;
+			const EditorCamera* editorCamera = (EditorCamera*)renderPacket.PrimaryCamera;
+			cameraPosition = editorCamera->GetPosition();
+		}
+
+		// Only actors inside the camera frustum make it into the queue
+		const Math::Frustum cameraFrustum(renderPacket.PrimaryCameraProjectionMatrix * renderPacket.PrimaryCameraViewMatrix);
 
-			for (const auto e : meshRendererView)
+		m_VisibleActors.clear();
+		const uint32_t culledCount = scene->CullMeshes(cameraFrustum, m_VisibleActors);
+
+		Renderer::AddToCullingStats((uint32_t)m_VisibleActors.size(), culledCount);
+
+		for (const auto e : m_VisibleActors)
+		{
+			Actor actor{ e, scene };
+
+			if (!actor.IsActive())
+				continue;
+
+			if (actor.HasComponent<MeshRendererComponent>())
 			{
-				Actor actor{ e, scene };
-				const MeshRendererComponent& mrc = actor.GetComponent<MeshRendererComponent>();
+				SubmitMesh(actor, cameraPosition);
+			}
+			else if (actor.HasComponent<StaticMeshRendererComponent>())
+			{
+				SubmitStaticMesh(actor, cameraPosition);
+			}
+		}
+	}
 
-				if (!actor.IsActive())
-					continue;
+	void SceneRenderer::SubmitMesh(Actor actor, const Math::vec3& cameraPosition)
+	{
+		const MeshRendererComponent& mrc = actor.GetComponent<MeshRendererComponent>();
 
-				if (!mrc.Visible)
-					continue;
+		if (!mrc.Visible)
+			return;
 
-				const Math::vec3 worldSpaceTranslation = scene->GetWorldSpaceTransform(actor).Translation;
+		AssetHandle meshHandle = mrc.Mesh;
+		if (!AssetManager::IsHandleValid(meshHandle))
+			return;
 
-				if (renderPacket.IsEditorScene)
-				{
-					const EditorCamera* editorCamera = (EditorCamera*)renderPacket.PrimaryCamera;
-					const Math::vec3& cameraPosition = editorCamera->GetPosition();
-					const float distance = Math::Distance(cameraPosition, worldSpaceTranslation);
+		SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
+		if (mesh == nullptr)
+			return;
 
-					SortActorByDistance(sortedGeometry, distance, actor, i);
-				}
-				else
-				{
-					const Math::vec3& cameraPosition = renderPacket.PrimaryCameraWorldSpaceTranslation;
-					const float distance = Math::Distance(cameraPosition, worldSpaceTranslation);
+		const Submesh& submesh = mesh->GetSubmesh();
 
-					SortActorByDistance(sortedGeometry, distance, actor, i);
-				}
+		const SharedReference<Material>& material = submesh.GetMaterial();
+		if (material == nullptr)
+			return;
 
-				i++;
-			}
-		}
+		const WorldTransformComponent& worldTransform = actor.GetComponent<WorldTransformComponent>();
+		const float distance = Math::Distance(cameraPosition, worldTransform.GetTranslation());
+
+		DrawCommand command;
+		command.MeshSubmesh = &submesh;
+		command.SubmeshShader = material->GetShader().Raw();
+		command.SubmeshMaterial = material.Raw();
+		command.MaterialHandle = material->Handle;
+		command.Transform = &worldTransform.Transform;
+		command.EntityID = (uint32_t)(entt::entity)actor;
+		command.Type = DrawCommandType::Mesh;
+		command.Animated = mesh->HasAnimations();
+
+		const bool transparent = material->GetOpacity() < 1.0f;
+		m_RenderQueue.Submit(DrawPass::Geometry, transparent, distance, command);
+	}
 
-		// Sort Static Meshes
-		{
-			auto staticMeshRendererView = scene->GetAllActorsWith<TransformComponent, StaticMeshRendererComponent>();
-			uint32_t i = 0;
+	void SceneRenderer::SubmitStaticMesh(Actor actor, const Math::vec3& cameraPosition)
+	{
+		const StaticMeshRendererComponent& smrc = actor.GetComponent<StaticMeshRendererComponent>();
 
-			for (const auto e : staticMeshRendererView)
-			{
-				Actor actor{ e, scene };
-				const StaticMeshRendererComponent& smrc = actor.GetComponent<StaticMeshRendererComponent>();
+		if (!smrc.Visible)
+			return;
 
-				if (!actor.IsActive())
-					continue;
+		AssetHandle staticMeshHandle = smrc.StaticMesh;
+		if (!AssetManager::IsHandleValid(staticMeshHandle))
+			return;
 
-				if (!smrc.Visible)
-					continue;
+		SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(staticMeshHandle);
+		if (staticMesh == nullptr)
+			return;
 
-				const Math::vec3 worldSpaceTranslation = scene->GetWorldSpaceTransform(actor).Translation;
+		const WorldTransformComponent& worldTransform = actor.GetComponent<WorldTransformComponent>();
+		const SharedReference<MaterialTable>& materialTable = smrc.Materials;
 
-				if (renderPacket.IsEditorScene)
-				{
-					const EditorCamera* editorCamera = (EditorCamera*)renderPacket.PrimaryCamera;
-					const Math::vec3& cameraPosition = editorCamera->GetPosition();
-					const float distance = Math::Distance(cameraPosition, worldSpaceTranslation);
+		for (const auto& [submeshIndex, submesh] : staticMesh->GetSubmeshes())
+		{
+			VX_CORE_ASSERT(materialTable->HasMaterial(submeshIndex), "Material table not synchronized with mesh!");
 
-					SortActorByDistance(sortedGeometry, distance, actor, i);
-				}
-				else
-				{
-					const Math::vec3& cameraPosition = renderPacket.PrimaryCameraWorldSpaceTranslation;
-					const float distance = Math::Distance(cameraPosition, worldSpaceTranslation);
+			AssetHandle materialHandle = materialTable->GetMaterial(submeshIndex);
+			if (!AssetManager::IsHandleValid(materialHandle))
+				continue;
 
-					SortActorByDistance(sortedGeometry, distance, actor, i);
-				}
+			SharedReference<Material> material = AssetManager::GetAsset<Material>(materialHandle);
+			if (material == nullptr)
+				continue;
 
-				i++;
-			}
+			// Sort by the submesh bounds rather than the actor origin
+			const Math::AABB& boundingBox = submesh.GetBoundingBox();
+			const Math::vec3 center = Math::vec3(worldTransform.Transform * Math::vec4(boundingBox.GetCenter(), 1.0f));
+			const float distance = Math::Distance(cameraPosition, center);
+
+			DrawCommand command;
+			command.StaticMeshSubmesh = &submesh;
+			command.SubmeshShader = material->GetShader().Raw();
+			command.SubmeshMaterial = material.Raw();
+			command.MaterialHandle = materialHandle;
+			command.Transform = &worldTransform.Transform;
+			command.EntityID = (uint32_t)(entt::entity)actor;
+			command.Type = DrawCommandType::StaticMesh;
+
+			const bool transparent = material->GetOpacity() < 1.0f;
+			m_RenderQueue.Submit(DrawPass::Geometry, transparent, distance, command);
 		}
-
-		RenderTime& renderTime = Renderer::GetRenderTime();
-		renderTime.PreGeometryPassSortTime += timer.ElapsedMS();
 	}
 
-	void SceneRenderer::SortActorByDistance(std::map<float, Actor>& sortedActors, float distance, Actor actor, uint32_t offset)
+	void SceneRenderer::SortRenderQueue()
 	{
-		std::scoped_lock<std::mutex> lock(m_GeometrySortMutex);
-		if (sortedActors.find(distance) == sortedActors.end())
-		{
-			sortedActors[distance] = actor;
-			return;
-		}
+		VX_PROFILE_FUNCTION();
+
+		InstrumentationTimer timer("Pre-Geo-Pass Sort");
+
+		m_RenderQueue.Sort();
 
-		// slightly modify the distance
-		sortedActors[distance + (0.01f * offset)] = actor;
+		RenderTime& renderTime = Renderer::GetRenderTime();
+		renderTime.PreGeometryPassSortTime += timer.ElapsedMS();
 	}
 
-	void SceneRenderer::GeometryPass(const SceneRenderPacket& renderPacket, const std::map<float, Actor>& sortedGeometry)
+	void SceneRenderer::UploadInstanceData()
 	{
 		VX_PROFILE_FUNCTION();
 
-		Scene* scene = renderPacket.Scene;
+		m_InstanceData.clear();
 
-		InstrumentationTimer timer("Geometry Pass");
-		SceneLightDescription sceneLightDesc = Renderer::GetSceneLightDescription();
-		
-		// Render in reverse to blend correctly
-		for (auto it = sortedGeometry.crbegin(); it != sortedGeometry.crend(); it++)
+		// Instances are laid out in draw order so each batch is a contiguous range
+		const uint32_t drawCount = m_RenderQueue.GetDrawCount();
+		for (uint32_t i = 0; i < drawCount; i++)
 		{
-			Actor actor = it->second;
+			const DrawCommand& command = m_RenderQueue.GetDrawCommand(i);
 
-			if (!actor)
+			if (command.Type != DrawCommandType::StaticMesh)
 				continue;
-			
-			const bool hasRequiredComponent = actor.HasAny<MeshRendererComponent, StaticMeshRendererComponent>();
-			VX_CORE_ASSERT(hasRequiredComponent, "Actor doesn't have mesh component!");
 
-			if (actor.HasComponent<MeshRendererComponent>())
-			{
-				RenderMesh(scene, actor, sceneLightDesc);
-			}
-			else if (actor.HasComponent<StaticMeshRendererComponent>())
-			{
-				RenderStaticMesh(scene, actor, sceneLightDesc);
-			}
+			InstanceData& instance = m_InstanceData.emplace_back();
+			instance.Transform = *command.Transform;
+			instance.EntityID = (int)command.EntityID;
 		}
 
-		RenderTime& renderTime = Renderer::GetRenderTime();
-		renderTime.GeometryPassRenderTime += timer.ElapsedMS();
+		Renderer::SetInstanceData(m_InstanceData.data(), (uint32_t)m_InstanceData.size());
 	}
 
-	void SceneRenderer::RenderMesh(Scene* scene, Actor actor, const SceneLightDescription& sceneLightDesc)
+	void SceneRenderer::UploadBonePalette(Scene* scene)
 	{
 		VX_PROFILE_FUNCTION();
 
-		const MeshRendererComponent& meshRendererComponent = actor.GetComponent<MeshRendererComponent>();
+		m_BonePalette.clear();
 
-		AssetHandle meshHandle = meshRendererComponent.Mesh;
-		if (!AssetManager::IsHandleValid(meshHandle))
-			return;
+		const uint32_t drawCount = m_RenderQueue.GetDrawCount();
+		m_BoneOffsets.assign(drawCount, s_InvalidBoneOffset);
 
-		SharedReference<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
-		if (mesh == nullptr)
-			return;
+		// Every skinned draw's bones go into one palette, draws find theirs with an offset
+		for (uint32_t i = 0; i < drawCount; i++)
+		{
+			const DrawCommand& command = m_RenderQueue.GetDrawCommand(i);
+
+			if (command.Type != DrawCommandType::Mesh || !command.Animated)
+				continue;
 
-		const Math::mat4 worldSpaceTransform = scene->GetWorldSpaceTransformMatrix(actor);
-		const auto& submesh = mesh->GetSubmesh();
+			Actor actor{ (entt::entity)command.EntityID, scene };
 
-		SharedReference<Material> material = submesh.GetMaterial();
-		if (material == nullptr)
-			return;
+			if (!actor.HasComponent<AnimatorComponent, AnimationComponent>())
+				continue;
 
-		SetMaterialFlags(material);
+			const AnimatorComponent& animatorComponent = actor.GetComponent<AnimatorComponent>();
+			const std::vector<Math::mat4>& transforms = animatorComponent.Animator->GetFinalBoneMatrices();
 
-		SharedReference<Shader> shader = material->GetShader();
-		shader->Enable();
+			m_BoneOffsets[i] = (uint32_t)m_BonePalette.size();
+			m_BonePalette.insert(m_BonePalette.end(), transforms.begin(), transforms.end());
+		}
 
-		shader->SetBool("u_SceneProperties.HasSkyLight", sceneLightDesc.HasSkyLight);
-		shader->SetInt("u_SceneProperties.ActivePointLights", sceneLightDesc.ActivePointLights);
-		shader->SetInt("u_SceneProperties.ActiveSpotLights", sceneLightDesc.ActiveSpotLights);
-		shader->SetInt("u_SceneProperties.ActiveEmissiveMeshes", sceneLightDesc.ActiveEmissiveMeshes);
-		shader->SetMat4("u_Model", worldSpaceTransform); // should be submesh world transform
+		Renderer::SetBonePalette(m_BonePalette.data(), (uint32_t)m_BonePalette.size());
+	}
 
+	void SceneRenderer::GeometryPass(const SceneRenderPacket& renderPacket)
+	{
+		VX_PROFILE_FUNCTION();
+
+		Scene* scene = renderPacket.Scene;
+
+		InstrumentationTimer timer("Geometry Pass");
+		SceneLightDescription sceneLightDesc = Renderer::GetSceneLightDescription();
+
+		// Depth maps are bound to fixed slots, they don't change between draws
 		Renderer::BindSkyLightDepthMap();
 		Renderer::BindPointLightDepthMaps();
 		Renderer::BindSpotLightDepthMaps();
 
-		const bool isAnimated = mesh->HasAnimations();
-		const bool hasRequiredComponents = actor.HasComponent<AnimatorComponent, AnimationComponent>();
+		Renderer::UploadSceneLights();
+		UploadInstanceData();
+		UploadBonePalette(scene);
 
-		shader->SetBool("u_HasAnimations", isAnimated);
+		const Shader* lastShader = nullptr;
+		uint32_t baseInstance = 0;
 
-		if (isAnimated && hasRequiredComponents)
+		const uint32_t drawCount = m_RenderQueue.GetDrawCount();
+		for (uint32_t i = 0; i < drawCount; i++)
 		{
-			const AnimatorComponent& animatorComponent = actor.GetComponent<AnimatorComponent>();
-			const std::vector<Math::mat4>& transforms = animatorComponent.Animator->GetFinalBoneMatrices();
-			const uint32_t size = transforms.size();
+			const DrawCommand& command = m_RenderQueue.GetDrawCommand(i);
+			Shader* shader = command.SubmeshShader;
 
-			for (uint32_t i = 0; i < size; i++)
+			// Draws are grouped by shader, only upload scene properties when it changes
+			if (shader != lastShader)
 			{
-				shader->SetMat4("u_FinalBoneMatrices[" + std::to_string(i) + "]", transforms[i]);
+				shader->Enable();
+
+				shader->SetBool("u_SceneProperties.HasSkyLight", sceneLightDesc.HasSkyLight);
+				shader->SetInt("u_SceneProperties.ActivePointLights", sceneLightDesc.ActivePointLights);
+				shader->SetInt("u_SceneProperties.ActiveSpotLights", sceneLightDesc.ActiveSpotLights);
+				shader->SetInt("u_SceneProperties.ActiveEmissiveMeshes", sceneLightDesc.ActiveEmissiveMeshes);
+
+				m_MeshUniforms.Model = shader->GetUniformHandle("u_Model");
+				m_MeshUniforms.EntityID = shader->GetUniformHandle("u_EntityID");
+				m_MeshUniforms.HasAnimations = shader->GetUniformHandle("u_HasAnimations");
+				m_MeshUniforms.BoneOffset = shader->GetUniformHandle("u_BoneOffset");
+
+				lastShader = shader;
 			}
-		}
 
-		submesh.Render();
+			if (command.Type == DrawCommandType::Mesh)
+			{
+				RenderMesh(command, m_BoneOffsets[i]);
+				continue;
+			}
 
-		ResetMaterialFlags();
-	}
+			// The queue is sorted by state so identical static draws are adjacent, merge them into one instanced draw
+			uint32_t instanceCount = 1;
+			while (i + instanceCount < drawCount)
+			{
+				const DrawCommand& next = m_RenderQueue.GetDrawCommand(i + instanceCount);
 
-	void SceneRenderer::RenderStaticMesh(Scene* scene, Actor actor, const SceneLightDescription& sceneLightDesc)
-	{
-		VX_PROFILE_FUNCTION();
+				if (next.Type != DrawCommandType::StaticMesh)
+					break;
+				if (next.StaticMeshSubmesh != command.StaticMeshSubmesh || next.SubmeshMaterial != command.SubmeshMaterial)
+					break;
 
-		const StaticMeshRendererComponent& staticMeshRendererComponent = actor.GetComponent<StaticMeshRendererComponent>();
+				instanceCount++;
+			}
 
-		AssetHandle staticMeshHandle = staticMeshRendererComponent.StaticMesh;
-		if (!AssetManager::IsHandleValid(staticMeshHandle))
-			return;
+			RenderStaticMeshInstanced(command, instanceCount, baseInstance);
 
-		SharedReference<StaticMesh> staticMesh = AssetManager::GetAsset<StaticMesh>(staticMeshHandle);
-		if (staticMesh == nullptr)
-			return;
+			baseInstance += instanceCount;
+			i += instanceCount - 1;
+		}
 
-		const Math::mat4 worldSpaceTransform = scene->GetWorldSpaceTransformMatrix(actor);
-		const auto& submeshes = staticMesh->GetSubmeshes();
+		RenderTime& renderTime = Renderer::GetRenderTime();
+		renderTime.GeometryPassRenderTime += timer.ElapsedMS();
+	}
 
-		SharedReference<MaterialTable> materialTable = staticMeshRendererComponent.Materials;
+	void SceneRenderer::RenderMesh(const DrawCommand& command, uint32_t boneOffset)
+	{
+		VX_PROFILE_FUNCTION();
 
-		// render each submesh
-		for (const auto& [submeshIndex, submesh] : submeshes)
-		{
-			VX_CORE_ASSERT(materialTable->HasMaterial(submeshIndex), "Material table not synchronized with mesh!");
+		SharedReference<Material> material = command.SubmeshMaterial;
+		SetMaterialFlags(material);
 
-			AssetHandle materialHandle = materialTable->GetMaterial(submeshIndex);
-			if (!AssetManager::IsHandleValid(materialHandle))
-				continue;
+		Shader* shader = command.SubmeshShader;
+		shader->SetMat4(m_MeshUniforms.Model, *command.Transform); // should be submesh world transform
+		shader->SetInt(m_MeshUniforms.EntityID, (int)command.EntityID);
 
-			SharedReference<Material> material = AssetManager::GetAsset<Material>(materialHandle);
-			if (material == nullptr)
-				continue;
+		const bool isAnimated = boneOffset != s_InvalidBoneOffset;
+		shader->SetBool(m_MeshUniforms.HasAnimations, isAnimated);
 
-			SetMaterialFlags(material);
+		if (isAnimated)
+		{
+			shader->SetInt(m_MeshUniforms.BoneOffset, (int)boneOffset);
+		}
+
+		command.MeshSubmesh->Render();
 
-			SharedReference<Shader> shader = material->GetShader();
-			shader->Enable();
+		ResetMaterialFlags();
+	}
 
-			shader->SetBool("u_SceneProperties.HasSkyLight", sceneLightDesc.HasSkyLight);
-			shader->SetInt("u_SceneProperties.ActivePointLights", sceneLightDesc.ActivePointLights);
-			shader->SetInt("u_SceneProperties.ActiveSpotLights", sceneLightDesc.ActiveSpotLights);
-			shader->SetInt("u_SceneProperties.ActiveEmissiveMeshes", sceneLightDesc.ActiveEmissiveMeshes);
-			shader->SetMat4("u_Model", worldSpaceTransform); // should be submesh world transform
+	void SceneRenderer::RenderStaticMeshInstanced(const DrawCommand& command, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		VX_PROFILE_FUNCTION();
 
-			Renderer::BindSkyLightDepthMap();
-			Renderer::BindPointLightDepthMaps();
-			Renderer::BindSpotLightDepthMaps();
+		SharedReference<Material> material = command.SubmeshMaterial;
+		SetMaterialFlags(material);
 
-			submesh.Render(materialHandle);
+		command.StaticMeshSubmesh->RenderInstanced(command.SubmeshMaterial, instanceCount, baseInstance);
 
-			ResetMaterialFlags();
-		}
+		ResetMaterialFlags();
 	}
 
 	void SceneRenderer::FindCurrentEnvironment(const SceneRenderPacket& renderPacket, SkyboxComponent& skyboxComponent, SharedReference<Skybox>& environment)
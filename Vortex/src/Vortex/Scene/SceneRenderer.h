@@ -8,11 +8,10 @@
 
 #include "Vortex/Renderer/Renderer.h"
 #include "Vortex/Renderer/Renderer2D.h"
+#include "Vortex/Renderer/RenderQueue.h"
 
 #include "Vortex/ReferenceCounting/SharedRef.h"
 
-#include <map>
-
 namespace Vortex {
 
 	class Scene;
@@ -68,11 +67,15 @@ namespace Vortex {
 
 		void LightPass(const SceneRenderPacket& renderPacket);
 		void EmissiveMeshPass(const SceneRenderPacket& renderPacket);
-		void SortMeshGeometry(const SceneRenderPacket& renderPacket, std::map<float, Actor>& sortedGeometry);
-		void SortActorByDistance(std::map<float, Actor>& sortedActors, float distance, Actor actor, uint32_t offset = 0);
-		void GeometryPass(const SceneRenderPacket& renderPacket, const std::map<float, Actor>& sortedGeometry);
-		void RenderMesh(Scene* scene, Actor actor, const SceneLightDescription& sceneLightDesc);
-		void RenderStaticMesh(Scene* scene, Actor actor, const SceneLightDescription& sceneLightDesc);
+		void BuildRenderQueue(const SceneRenderPacket& renderPacket);
+		void SubmitMesh(Actor actor, const Math::vec3& cameraPosition);
+		void SubmitStaticMesh(Actor actor, const Math::vec3& cameraPosition);
+		void SortRenderQueue();
+		void UploadInstanceData();
+		void UploadBonePalette(Scene* scene);
+		void GeometryPass(const SceneRenderPacket& renderPacket);
+		void RenderMesh(const DrawCommand& command, uint32_t boneOffset);
+		void RenderStaticMeshInstanced(const DrawCommand& command, uint32_t instanceCount, uint32_t baseInstance);
 
 		// Environment
 
@@ -87,7 +90,20 @@ namespace Vortex {
 		void ResetMaterialFlags();
 
 	private:
-		std::mutex m_GeometrySortMutex;
+		RenderQueue m_RenderQueue;
+		std::vector<InstanceData> m_InstanceData;
+		std::vector<Math::mat4> m_BonePalette;
+		std::vector<uint32_t> m_BoneOffsets;
+
+		// Resolved whenever the geometry pass switches shaders
+		struct MeshUniformHandles
+		{
+			ShaderUniformHandle Model;
+			ShaderUniformHandle EntityID;
+			ShaderUniformHandle HasAnimations;
+			ShaderUniformHandle BoneOffset;
+		} m_MeshUniforms;
+		std::vector<entt::entity> m_VisibleActors;
 		RendererAPI::TriangleCullMode m_LastCullMode;
 
 	private:
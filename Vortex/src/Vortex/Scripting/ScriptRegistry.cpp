@@ -1221,7 +1221,7 @@ namespace Vortex {
 				physx::PxTransform physxTransform = pxActor->getGlobalPose();
 				physxTransform.p = PhysicsUtils::ToPhysXVector(*translation);
 
-				pxActor->setGlobalPose(physxTransform);
+				Physics::RT_TeleportActor(pxActor, physxTransform);
 
 				return;
 			}
@@ -1233,8 +1233,10 @@ namespace Vortex {
 				{
 					b2Body* body = (b2Body*)rigidbody.RuntimeBody;
 
-					body->SetTransform({ translation->x, translation->y }, body->GetAngle());
-					actor.GetTransform().Translation.z = translation->z;
+					TransformComponent& transform = actor.GetTransform();
+					transform.Translation = *translation;
+
+					Physics2D::RT_TeleportBody(body, transform);
 					
 					return;
 				}
@@ -1287,7 +1289,7 @@ namespace Vortex {
 				physx::PxTransform physxTransform = actor->getGlobalPose();
 				physxTransform.q = PhysicsUtils::ToPhysXQuat(*rotation);
 
-				actor->setGlobalPose(physxTransform);
+				Physics::RT_TeleportActor(actor, physxTransform);
 			}
 			else if (actor.HasComponent<RigidBody2DComponent>())
 			{
@@ -1297,9 +1299,10 @@ namespace Vortex {
 				{
 					b2Body* body = (b2Body*)rigidbody.RuntimeBody;
 
-					Math::vec3 translation = actor.GetTransform().Translation;
-					Math::vec3 eulerAngles = Math::EulerAngles(*rotation);
-					body->SetTransform({ translation.x, translation.y }, eulerAngles.z);
+					TransformComponent& transform = actor.GetTransform();
+					transform.SetRotation(*rotation);
+
+					Physics2D::RT_TeleportBody(body, transform);
 
 					return;
 				}
@@ -1361,7 +1364,7 @@ namespace Vortex {
 				physx::PxTransform physxTransform = actor->getGlobalPose();
 				physxTransform.q = PhysicsUtils::ToPhysXQuat(Math::quaternion(*eulerAngles));
 
-				actor->setGlobalPose(physxTransform);
+				Physics::RT_TeleportActor(actor, physxTransform);
 
 				return;
 			}
@@ -1373,8 +1376,10 @@ namespace Vortex {
 				{
 					b2Body* body = (b2Body*)rigidbody.RuntimeBody;
 
-					body->SetTransform(body->GetPosition(), Math::Deg2Rad(eulerAngles->z));
-					actor.GetTransform().SetRotationEuler(*eulerAngles);
+					TransformComponent& transform = actor.GetTransform();
+					transform.SetRotationEuler(*eulerAngles);
+
+					Physics2D::RT_TeleportBody(body, transform);
 
 					return;
 				}
@@ -1561,7 +1566,7 @@ namespace Vortex {
 					Math::Decompose(Math::Inverse(result), scale, rotation, translation, skew, perspective);
 					physxTransform.q = PhysicsUtils::ToPhysXQuat(rotation);
 
-					actor->setGlobalPose(physxTransform);
+					Physics::RT_TeleportActor(actor, physxTransform);
 
 					return;
 				}
@@ -5954,6 +5959,8 @@ namespace Vortex {
 			}
 
 			rigidbody.CollisionDetection = collisionDetectionType;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		float RigidBodyComponent_GetMass(UUID actorUUID)
@@ -5996,6 +6003,8 @@ namespace Vortex {
 			}
 
 			rigidbody.Mass = mass;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		void RigidBodyComponent_GetLinearVelocity(UUID actorUUID, Math::vec3* outVelocity)
@@ -6038,6 +6047,8 @@ namespace Vortex {
 			}
 
 			rigidbody.LinearVelocity = *velocity;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		float RigidBodyComponent_GetMaxLinearVelocity(UUID actorUUID)
@@ -6080,6 +6091,8 @@ namespace Vortex {
 			}
 
 			rigidbody.MaxLinearVelocity = maxLinearVelocity;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		float RigidBodyComponent_GetLinearDrag(UUID actorUUID)
@@ -6122,6 +6135,8 @@ namespace Vortex {
 			}
 
 			rigidbody.LinearDrag = drag;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		void RigidBodyComponent_GetAngularVelocity(UUID actorUUID, Math::vec3* outVelocity)
@@ -6164,6 +6179,8 @@ namespace Vortex {
 			}
 
 			rigidbody.AngularVelocity = *velocity;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		float RigidBodyComponent_GetMaxAngularVelocity(UUID actorUUID)
@@ -6206,6 +6223,8 @@ namespace Vortex {
 			}
 
 			rigidbody.MaxAngularVelocity = maxAngularVelocity;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		float RigidBodyComponent_GetAngularDrag(UUID actorUUID)
@@ -6248,6 +6267,8 @@ namespace Vortex {
 			}
 
 			rigidbody.AngularDrag = drag;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		bool RigidBodyComponent_GetDisableGravity(UUID actorUUID)
@@ -6290,6 +6311,8 @@ namespace Vortex {
 			}
 
 			rigidbody.DisableGravity = disabled;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		bool RigidBodyComponent_GetIsKinematic(UUID actorUUID)
@@ -6332,6 +6355,8 @@ namespace Vortex {
 			}
 
 			rigidbody.IsKinematic = isKinematic;
+
+			Physics::MarkActorDirty(actor);
 		}
 
 		void RigidBodyComponent_GetKinematicTargetTranslation(UUID actorUUID, Math::vec3* outTranslation)
@@ -6707,6 +6732,71 @@ namespace Vortex {
 			return (bool)result;
 		}
 
+		// Checks the managed arrays can hold maxHits results per query, returns the query count
+		static uint32_t ValidateSceneQueryBatch(const char* methodName, MonoArray* queries, MonoArray* outHits, MonoArray* outHitCounts, uint32_t maxHits)
+		{
+			if (!queries || !outHits || !outHitCounts)
+			{
+				VX_CONSOLE_LOG_ERROR("[Script Engine] Calling Physics.{} with a null array!", methodName);
+				return 0;
+			}
+
+			const uintptr_t queryCount = mono_array_length(queries);
+
+			if (mono_array_length(outHitCounts) < queryCount || mono_array_length(outHits) < queryCount * maxHits)
+			{
+				VX_CONSOLE_LOG_ERROR("[Script Engine] Calling Physics.{} with result arrays too small for {} queries and {} hits each!", methodName, queryCount, maxHits);
+				return 0;
+			}
+
+			return (uint32_t)queryCount;
+		}
+
+		void Physics_RaycastBatch(MonoArray* queries, MonoArray* outHits, MonoArray* outHitCounts, uint32_t layerMask, uint32_t maxHits)
+		{
+			Scene* contextScene = GetContextScene();
+
+			SceneQueryFilter filter;
+			filter.LayerMask = layerMask;
+			filter.MaxHits = Math::Max(maxHits, 1u);
+
+			const uint32_t count = ValidateSceneQueryBatch("RaycastBatch", queries, outHits, outHitCounts, filter.MaxHits);
+			if (count == 0)
+				return;
+
+			PhysicsScene::RaycastBatch(mono_array_addr(queries, RaycastQuery, 0), count, filter, mono_array_addr(outHits, RaycastHit, 0), mono_array_addr(outHitCounts, uint32_t, 0));
+		}
+
+		void Physics_SweepBatch(MonoArray* queries, MonoArray* outHits, MonoArray* outHitCounts, uint32_t layerMask, uint32_t maxHits)
+		{
+			Scene* contextScene = GetContextScene();
+
+			SceneQueryFilter filter;
+			filter.LayerMask = layerMask;
+			filter.MaxHits = Math::Max(maxHits, 1u);
+
+			const uint32_t count = ValidateSceneQueryBatch("SweepBatch", queries, outHits, outHitCounts, filter.MaxHits);
+			if (count == 0)
+				return;
+
+			PhysicsScene::SweepBatch(mono_array_addr(queries, SweepQuery, 0), count, filter, mono_array_addr(outHits, RaycastHit, 0), mono_array_addr(outHitCounts, uint32_t, 0));
+		}
+
+		void Physics_OverlapBatch(MonoArray* queries, MonoArray* outHits, MonoArray* outHitCounts, uint32_t layerMask, uint32_t maxHits)
+		{
+			Scene* contextScene = GetContextScene();
+
+			SceneQueryFilter filter;
+			filter.LayerMask = layerMask;
+			filter.MaxHits = Math::Max(maxHits, 1u);
+
+			const uint32_t count = ValidateSceneQueryBatch("OverlapBatch", queries, outHits, outHitCounts, filter.MaxHits);
+			if (count == 0)
+				return;
+
+			PhysicsScene::OverlapBatch(mono_array_addr(queries, OverlapQuery, 0), count, filter, mono_array_addr(outHits, OverlapHit, 0), mono_array_addr(outHitCounts, uint32_t, 0));
+		}
+
 		void Physics_GetSceneGravity(Math::vec3* outGravity)
 		{
 			Scene* contextScene = GetContextScene();
@@ -8025,6 +8115,10 @@ namespace Vortex {
 			RigidBody2DComponent& rigidbody = actor.GetComponent<RigidBody2DComponent>();
 
 			rigidbody.Velocity = *velocity;
+
+			b2Body* body = (b2Body*)rigidbody.RuntimeBody;
+
+			body->SetLinearVelocity(b2Vec2(velocity->x, velocity->y));
 		}
 
 		float RigidBody2DComponent_GetDrag(UUID actorUUID)
@@ -8743,7 +8837,7 @@ namespace Vortex {
 		bool Texture2D_LoadFromPath(MonoString* filepath, AssetHandle* outHandle)
 		{
 			ManagedString mstring(filepath);
-			AssetHandle textureHandle = Project::GetEditorAssetManager()->GetAssetHandleFromFilepath(mstring.String());
+			AssetHandle textureHandle = Project::GetAssetManager()->GetAssetHandleFromFilepath(mstring.String());
 
 			*outHandle = textureHandle;
 
@@ -8760,7 +8854,7 @@ namespace Vortex {
 			SharedReference<Texture2D> texture = Texture2D::Create(imageProps);
 			texture->Handle = AssetHandle();
 
-			Project::GetEditorAssetManager()->AddMemoryOnlyAsset(texture);
+			Project::GetAssetManager()->AddMemoryOnlyAsset(texture);
 			*outHandle = texture->Handle;
 		}
 
@@ -9729,6 +9823,9 @@ namespace Vortex {
 		VX_REGISTER_DEFAULT_INTERNAL_CALL(AudioCone_SetOuterGain);
 		
 		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_Raycast);
+		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_RaycastBatch);
+		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_SweepBatch);
+		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_OverlapBatch);
 		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_GetSceneGravity);
 		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_SetSceneGravity);
 		VX_REGISTER_DEFAULT_INTERNAL_CALL(Physics_GetScenePositionIterations);
@@ -20,7 +20,9 @@
 #include "Vortex/Renderer/ParticleSystem/ParticleEmitter.h"
 #include "Vortex/Renderer/Font/Font.h"
 
+#include "Vortex/Physics/3D/Physics.h"
 #include "Vortex/Physics/3D/PhysicsMaterial.h"
+#include "Vortex/Physics/3D/CookingFactory.h"
 
 #include "Vortex/Scripting/ScriptEngine.h"
 #include "Vortex/Scripting/ScriptUtils.h"
@@ -102,6 +104,27 @@ namespace Vortex {
 			return false;
 		}
 
+		return DeserializeFromYAML(data);
+	}
+
+	bool SceneSerializer::DeserializeFromMemory(const Buffer& data)
+	{
+		YAML::Node sceneData;
+		try
+		{
+			sceneData = YAML::Load(std::string((const char*)data.Data, data.Size));
+		}
+		catch (YAML::ParserException e)
+		{
+			VX_CONSOLE_LOG_ERROR("Failed to load scene from memory\n     {}", e.what());
+			return false;
+		}
+
+		return DeserializeFromYAML(sceneData);
+	}
+
+	bool SceneSerializer::DeserializeFromYAML(const YAML::Node& data)
+	{
 		if (!data["Scene"])
 		{
 			return false;
@@ -658,7 +681,22 @@ namespace Vortex {
 
 		if (actor.HasComponent<MeshColliderComponent>())
 		{
-			// TODO
+			out << YAML::Key << "MeshColliderComponent" << YAML::BeginMap; // MeshColliderComponent
+
+			const MeshColliderComponent& meshColliderComponent = actor.GetComponent<MeshColliderComponent>();
+			VX_SERIALIZE_PROPERTY(ColliderAsset, meshColliderComponent.ColliderAsset, out);
+			VX_SERIALIZE_PROPERTY(SubmeshIndex, meshColliderComponent.SubmeshIndex, out);
+			VX_SERIALIZE_PROPERTY(CollisionComplexity, (uint32_t)meshColliderComponent.CollisionComplexity, out);
+			VX_SERIALIZE_PROPERTY(IsTrigger, meshColliderComponent.IsTrigger, out);
+			VX_SERIALIZE_PROPERTY(UseSharedShape, meshColliderComponent.UseSharedShape, out);
+			VX_SERIALIZE_PROPERTY(Visible, meshColliderComponent.Visible, out);
+
+			if (AssetManager::IsHandleValid(meshColliderComponent.Material))
+			{
+				SerializePhysicsMaterialFn(meshColliderComponent.Material);
+			}
+
+			out << YAML::EndMap; // MeshColliderComponent
 		}
 
 		if (actor.HasComponent<RigidBody2DComponent>())
@@ -1004,7 +1042,7 @@ namespace Vortex {
 				if (staticMeshRendererComponent.Type != MeshType::Custom)
 				{
 					DefaultMesh::StaticMeshType defaultMesh = (DefaultMesh::StaticMeshType)staticMeshRendererComponent.Type;
-					staticMeshRendererComponent.StaticMesh = Project::GetEditorAssetManager()->GetDefaultStaticMesh(defaultMesh);
+					staticMeshRendererComponent.StaticMesh = DefaultMesh::DefaultStaticMeshes[(size_t)defaultMesh];
 				}
 				else
 				{
@@ -1381,7 +1419,35 @@ namespace Vortex {
 			{
 				MeshColliderComponent& meshColliderComponent = deserializedActor.AddComponent<MeshColliderComponent>();
 
-				// TODO
+				if (meshColliderComponentData["ColliderAsset"])
+				{
+					AssetHandle colliderHandle = meshColliderComponentData["ColliderAsset"].as<uint64_t>();
+					if (AssetManager::IsHandleValid(colliderHandle))
+					{
+						meshColliderComponent.ColliderAsset = colliderHandle;
+					}
+				}
+				if (meshColliderComponentData["SubmeshIndex"])
+					meshColliderComponent.SubmeshIndex = meshColliderComponentData["SubmeshIndex"].as<uint32_t>();
+				if (meshColliderComponentData["CollisionComplexity"])
+					meshColliderComponent.CollisionComplexity = (ECollisionComplexity)meshColliderComponentData["CollisionComplexity"].as<uint32_t>();
+				if (meshColliderComponentData["IsTrigger"])
+					meshColliderComponent.IsTrigger = meshColliderComponentData["IsTrigger"].as<bool>();
+				if (meshColliderComponentData["UseSharedShape"])
+					meshColliderComponent.UseSharedShape = meshColliderComponentData["UseSharedShape"].as<bool>();
+				if (meshColliderComponentData["Visible"])
+					meshColliderComponent.Visible = meshColliderComponentData["Visible"].as<bool>();
+
+				const YAML::Node physicsMaterialData = meshColliderComponentData["PhysicsMaterial"];
+
+				if (physicsMaterialData)
+				{
+					DeserializePhysicsMaterialFn(physicsMaterialData);
+				}
+
+				// Warm the cooked mesh cache in the background so play doesn't stall on cooking
+				SharedReference<StaticMesh> colliderMesh = Physics::GetMeshColliderAsset(deserializedActor);
+				CookingFactory::CookStaticMeshAsync(colliderMesh, Physics::GetMeshColliderType(deserializedActor));
 			}
 
 			const YAML::Node rigidBody2DComponentData = actor["Rigidbody2DComponent"];
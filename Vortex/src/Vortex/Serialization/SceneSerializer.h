@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
 
 #include "Vortex/Scene/Scene.h"
 
@@ -32,6 +33,12 @@ namespace Vortex {
 		bool Deserialize(const std::string& filepath);
 		bool DeserializeRuntime(const std::string& filepath);
 
+		// Scene file contents already in memory, e.g. a payload from an asset pack
+		bool DeserializeFromMemory(const Buffer& data);
+
+	private:
+		bool DeserializeFromYAML(const YAML::Node& data);
+
 	private:
 		SharedReference<Scene> m_Scene = nullptr;
 	};
@@ -3,6 +3,39 @@
 
 namespace Vortex {
 
-	
+	StreamReader::StreamReader(const Buffer& buffer)
+		: m_Buffer(buffer)
+	{
+	}
+
+	bool StreamReader::ReadData(void* destination, uint64_t size)
+	{
+		if (!m_IsGood || size > GetRemaining())
+		{
+			m_IsGood = false;
+			return false;
+		}
+
+		if (size > 0)
+		{
+			memcpy(destination, m_Buffer.Data + m_Position, size);
+			m_Position += size;
+		}
+
+		return true;
+	}
+
+	bool StreamReader::ReadString(std::string& value)
+	{
+		uint32_t length = 0;
+		if (!ReadRaw(length) || length > GetRemaining())
+		{
+			m_IsGood = false;
+			return false;
+		}
+
+		value.resize(length);
+		return ReadData(value.data(), length);
+	}
 
 }
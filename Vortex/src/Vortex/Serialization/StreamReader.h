@@ -1,15 +1,59 @@
 #pragma once
 
 #include "Vortex/Core/Base.h"
+#include "Vortex/Core/Buffer.h"
+
+#include <type_traits>
+#include <string>
+#include <vector>
 
 namespace Vortex {
 
-	class StreamReader
+	// Reads back what a StreamWriter produced, every read is bounds checked
+	// and once one fails the reader stays failed so callers can check once at the end
+	class VORTEX_API StreamReader
 	{
 	public:
+		StreamReader(const Buffer& buffer);
+		~StreamReader() = default;
 
-	private:
+		bool ReadData(void* destination, uint64_t size);
+		bool ReadString(std::string& value);
+
+		template <typename T>
+		VX_FORCE_INLINE bool ReadRaw(T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "ReadRaw only works with trivially copyable types!");
+
+			return ReadData(&value, sizeof(T));
+		}
+
+		template <typename T>
+		VX_FORCE_INLINE bool ReadArray(std::vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "ReadArray only works with trivially copyable types!");
 
+			uint64_t count = 0;
+			if (!ReadRaw(count) || count > GetRemaining() / sizeof(T))
+			{
+				m_IsGood = false;
+				return false;
+			}
+
+			values.resize(count);
+			return ReadData(values.data(), count * sizeof(T));
+		}
+
+		VX_FORCE_INLINE uint64_t GetPosition() const { return m_Position; }
+		VX_FORCE_INLINE uint64_t GetRemaining() const { return m_Buffer.Size - m_Position; }
+		VX_FORCE_INLINE bool IsGood() const { return m_IsGood; }
+
+		VX_FORCE_INLINE operator bool() const { return m_IsGood; }
+
+	private:
+		Buffer m_Buffer;
+		uint64_t m_Position = 0;
+		bool m_IsGood = true;
 	};
 
 }
@@ -1,8 +1,54 @@
 #include "vxpch.h"
 #include "StreamWriter.h"
 
+#include <fstream>
+
 namespace Vortex {
 
+	void StreamWriter::WriteData(const void* data, uint64_t size)
+	{
+		if (size == 0)
+			return;
+
+		const uint8_t* bytes = (const uint8_t*)data;
+		m_Data.insert(m_Data.end(), bytes, bytes + size);
+	}
+
+	void StreamWriter::WriteString(const std::string& value)
+	{
+		WriteRaw<uint32_t>((uint32_t)value.size());
+		WriteData(value.data(), value.size());
+	}
+
+	bool StreamWriter::WriteToFile(const Fs::Path& filepath) const
+	{
+		const Fs::Path directory = filepath.parent_path();
+		if (!directory.empty() && !FileSystem::Exists(directory))
+		{
+			FileSystem::CreateDirectoriesV(directory);
+		}
+
+		Fs::Path tempFilepath = filepath;
+		FileSystem::ReplaceExtension(tempFilepath, ".tmp");
+
+		{
+			std::ofstream stream(tempFilepath, std::ios::binary | std::ios::trunc);
+			if (!stream)
+			{
+				return false;
+			}
+
+			stream.write((const char*)m_Data.data(), m_Data.size());
+
+			if (!stream)
+			{
+				return false;
+			}
+		}
+
+		FileSystem::Rename(tempFilepath, filepath);
 
+		return true;
+	}
 
 }
@@ -1,15 +1,51 @@
 #pragma once
 
+#include "Vortex/Core/Base.h"
 #include "Vortex/Core/Buffer.h"
 
+#include "Vortex/Utils/FileSystem.h"
+
+#include <type_traits>
+#include <string>
+#include <vector>
+
 namespace Vortex {
 
-	class StreamWriter
+	// Appends plain data to a growable byte buffer so binary files can be written in one go
+	class VORTEX_API StreamWriter
 	{
 	public:
-		
-	private:
+		StreamWriter() = default;
+		~StreamWriter() = default;
+
+		void WriteData(const void* data, uint64_t size);
+		void WriteString(const std::string& value);
+
+		template <typename T>
+		VX_FORCE_INLINE void WriteRaw(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "WriteRaw only works with trivially copyable types!");
+
+			WriteData(&value, sizeof(T));
+		}
 
+		template <typename T>
+		VX_FORCE_INLINE void WriteArray(const std::vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "WriteArray only works with trivially copyable types!");
+
+			WriteRaw<uint64_t>(values.size());
+			WriteData(values.data(), values.size() * sizeof(T));
+		}
+
+		// Written next to the destination first, a reader never sees a half written file
+		bool WriteToFile(const Fs::Path& filepath) const;
+
+		VX_FORCE_INLINE const uint8_t* GetData() const { return m_Data.data(); }
+		VX_FORCE_INLINE uint64_t GetSize() const { return m_Data.size(); }
+
+	private:
+		std::vector<uint8_t> m_Data;
 	};
 
 }
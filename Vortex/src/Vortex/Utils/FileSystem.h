@@ -14,17 +14,36 @@ namespace Vortex {
 
 	}
 
+	// Read only view of a file mapped into memory, Data stays valid until the file is unmapped
+	struct VORTEX_API MappedFile
+	{
+		const uint8_t* Data = nullptr;
+		uint64_t Size = 0;
+
+		void* FileHandle = nullptr;
+		void* MappingHandle = nullptr;
+
+		inline operator bool() const { return Data != nullptr; }
+	};
+
 	class VORTEX_API FileSystem
 	{
 	public:
 		static Buffer ReadBinary(const Fs::Path& filepath);
 		static std::string ReadText(const Fs::Path& filepath);
 
+		static MappedFile MapFile(const Fs::Path& filepath);
+		static void UnmapFile(MappedFile& file);
+
 		static bool Exists(const Fs::Path& filepath);
 		static bool Equivalent(const Fs::Path& first, const Fs::Path& second);
 
 		static bool IsDirectory(const Fs::Path& filepath);
 
+		static uint64_t GetFileSize(const Fs::Path& filepath);
+		// Only meaningful when compared against another value from the same file system
+		static uint64_t GetLastWriteTime(const Fs::Path& filepath);
+
 		static bool CreateDirectoryV(const Fs::Path& directory);
 		static bool CreateDirectoriesV(const Fs::Path& directories);
 		static bool Remove(const Fs::Path& filepath);
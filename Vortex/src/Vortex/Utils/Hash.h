@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Vortex/Core/Base.h"
+
+#include <type_traits>
+#include <cstdint>
+
+namespace Vortex {
+
+	// Incremental 64 bit FNV-1a, values are fed one at a time so struct padding never ends up in the hash
+	class Fnv1a
+	{
+	public:
+		VX_FORCE_INLINE void AddBytes(const void* data, size_t size)
+		{
+			const uint8_t* bytes = (const uint8_t*)data;
+			for (size_t i = 0; i < size; i++)
+			{
+				m_Hash ^= bytes[i];
+				m_Hash *= s_Prime;
+			}
+		}
+
+		template <typename T>
+		VX_FORCE_INLINE void Add(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Add only works with trivially copyable types!");
+
+			AddBytes(&value, sizeof(T));
+		}
+
+		VX_FORCE_INLINE uint64_t GetHash() const { return m_Hash; }
+
+		// Cache keys reserve zero for 'no key'
+		VX_FORCE_INLINE uint64_t GetKey() const { return m_Hash != 0 ? m_Hash : 1; }
+
+	private:
+		static constexpr uint64_t s_OffsetBasis = 14695981039346656037ull;
+		static constexpr uint64_t s_Prime = 1099511628211ull;
+
+		uint64_t m_Hash = s_OffsetBasis;
+	};
+
+}
@@ -31,13 +31,19 @@ namespace Vortex::vxstl {
 			m_function_queue.emplace_back(fn);
 		}
 
+		// The queue is swapped out under the lock, functions may be queued from any thread
+		// while it runs (including by the functions themselves) and are kept for the next execute
 		VX_FORCE_INLINE void execute()
 		{
-			const size_t count = size();
+			std::vector<function_type> functions;
 
-			for (size_t i = 0; i < count; i++)
 			{
-				const function_type& fn = m_function_queue[i];
+				std::scoped_lock<mutex_type> lock(m_mutex);
+				std::swap(functions, m_function_queue);
+			}
+
+			for (const function_type& fn : functions)
+			{
 				std::invoke(fn);
 			}
 		}
@@ -56,17 +62,21 @@ namespace Vortex::vxstl {
 
 		VX_FORCE_INLINE bool empty() const
 		{
+			std::scoped_lock<mutex_type> lock(m_mutex);
+
 			return m_function_queue.empty();
 		}
 
 		VX_FORCE_INLINE size_t size() const
 		{
+			std::scoped_lock<mutex_type> lock(m_mutex);
+
 			return m_function_queue.size();
 		}
 
 	private:
 		std::vector<function_type> m_function_queue;
-		mutex_type m_mutex;
+		mutable mutex_type m_mutex;
 	};
 
 }